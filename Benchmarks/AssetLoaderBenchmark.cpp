@@ -0,0 +1,122 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/Assets/AssetLoader.hpp>
+#include <D3D12Engine/Core/BoundedQueue.hpp>
+
+#include <BenchmarkHarness.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <numeric>
+#include <thread>
+
+namespace {
+    using namespace D3D12Engine;
+    using namespace D3D12Engine::Benchmarks;
+
+    // Producers and consumers hammering one queue, the cost of the lock and the heap.
+    void MeasureQueue(const BenchmarkOptions& options) {
+        const uint32_t itemCount = options.Pick(1'000'000u, 20'000u);
+        constexpr uint32_t ProducerCount = 2;
+        constexpr uint32_t ConsumerCount = 2;
+
+        const double seconds = MeasureBest(3, [&] {
+            BoundedQueue<uint64_t> queue(64);
+            std::atomic<uint64_t> sum = 0;
+
+            std::vector<std::thread> threads;
+            for (uint32_t producer = 0; producer < ProducerCount; producer++) {
+                threads.emplace_back([&, producer] {
+                    for (uint32_t i = producer; i < itemCount; i += ProducerCount) {
+                        queue.Push(i);
+                    }
+                });
+            }
+
+            std::vector<std::thread> consumers;
+            for (uint32_t consumer = 0; consumer < ConsumerCount; consumer++) {
+                consumers.emplace_back([&] {
+                    uint64_t local = 0;
+                    while (const auto value = queue.Pop()) {
+                        local += *value;
+                    }
+
+                    sum += local;
+                });
+            }
+
+            for (auto& thread : threads) {
+                thread.join();
+            }
+
+            queue.Close();
+            for (auto& thread : consumers) {
+                thread.join();
+            }
+
+            DE_CHECK(sum == uint64_t{itemCount} * (itemCount - 1) / 2);
+        });
+
+        PrintResult("BoundedQueue push+pop", seconds * 1e9 / itemCount, "ns/item");
+    }
+
+    // Small files through the whole pipeline, what a request costs on top of the IO.
+    void MeasureLoader(const BenchmarkOptions& options) {
+        const uint32_t fileCount = options.Pick(64u, 8u);
+        const uint32_t requestCount = options.Pick(20'000u, 500u);
+
+        std::vector<std::filesystem::path> paths;
+        for (uint32_t i = 0; i < fileCount; i++) {
+            paths.push_back(std::filesystem::temp_directory_path() / ("D3D12EngineAssetLoaderBenchmark" + std::to_string(i) + ".bin"));
+            std::ofstream file(paths.back(), std::ios::binary);
+            const std::vector<char> bytes(16 * 1024, static_cast<char>(i));
+            file.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+        }
+
+        const auto decode = [](const std::span<const std::byte> data) {
+            return std::make_unique<uint64_t>(std::accumulate(data.begin(), data.end(), uint64_t{0},
+                                                              [](const uint64_t sum, const std::byte b) { return sum + static_cast<uint8_t>(b); }));
+        };
+
+        const double seconds = MeasureBest(3, [&] {
+            AssetLoader loader;
+            std::vector<AssetHandle<uint64_t>> handles;
+            handles.reserve(requestCount);
+
+            // Waves that fit the read queue, the way a level streams in batches.
+            constexpr uint32_t WaveSize = 128;
+            for (uint32_t first = 0; first < requestCount; first += WaveSize) {
+                const uint32_t last = std::min(first + WaveSize, requestCount);
+                for (uint32_t i = first; i < last; i++) {
+                    const auto priority = static_cast<AssetPriority>(i % 4);
+                    handles.push_back(loader.Load<uint64_t>(paths[i % fileCount], priority, decode));
+                }
+
+                for (uint32_t i = first; i < last; i++) {
+                    loader.Wait(handles[i].GetRequest());
+                    g_Sink = g_Sink + *handles[i].Get();
+                }
+            }
+
+            DE_CHECK(loader.GetStats().Completed == requestCount);
+        });
+
+        PrintResult("AssetLoader request, 16 KiB file", seconds * 1e6 / requestCount, "us/request");
+        PrintResult("AssetLoader throughput", requestCount / seconds, "requests/s");
+
+        for (const auto& path : paths) {
+            std::filesystem::remove(path);
+        }
+    }
+}
+
+int main(const int argc, char** argv) {
+    const BenchmarkOptions options = BenchmarkOptions::Parse(argc, argv);
+
+    MeasureQueue(options);
+    MeasureLoader(options);
+
+    return D3D12Engine::Tests::GetExitCode();
+}
@@ -0,0 +1,64 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef DE_BENCHMARKS_BENCHMARKHARNESS_HPP
+#define DE_BENCHMARKS_BENCHMARKHARNESS_HPP
+
+#include <TestCheck.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <string_view>
+
+namespace D3D12Engine::Benchmarks {
+    // Results are folded in here so the compiler can't drop the measured work.
+    inline volatile uint64_t g_Sink = 0;
+
+    struct BenchmarkOptions {
+        // Shrinks the workloads, CI runs every benchmark this way to check it still works.
+        bool Quick = false;
+
+        template <typename T>
+        [[nodiscard]] T Pick(const T full, const T quick) const {
+            return Quick ? quick : full;
+        }
+
+        [[nodiscard]] static BenchmarkOptions Parse(const int argc, char** argv) {
+            BenchmarkOptions options;
+            for (int i = 1; i < argc; i++) {
+                if (std::string_view(argv[i]) == "--quick") {
+                    options.Quick = true;
+                }
+            }
+
+            return options;
+        }
+    };
+
+    // Seconds taken by the fastest of the runs, the one least disturbed by the rest of the machine.
+    template <typename F>
+    double MeasureBest(const uint32_t runCount, F&& function) {
+        double best = std::numeric_limits<double>::max();
+        for (uint32_t run = 0; run < runCount; run++) {
+            const auto start = std::chrono::steady_clock::now();
+            function();
+            const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            best = std::min(best, elapsed.count());
+        }
+
+        return best;
+    }
+
+    inline void PrintResult(const std::string_view name, const double value, const std::string_view unit) {
+        std::printf("%-48.*s %12.3f %.*s\n", static_cast<int>(name.size()), name.data(), value,
+                    static_cast<int>(unit.size()), unit.data());
+    }
+}
+
+#endif // DE_BENCHMARKS_BENCHMARKHARNESS_HPP
@@ -0,0 +1,225 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/Core/JobSystem.hpp>
+#include <D3D12Engine/Scene/EntityCommandBuffer.hpp>
+#include <D3D12Engine/Scene/EntityRegistry.hpp>
+
+#include <BenchmarkHarness.hpp>
+
+#include <atomic>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace {
+    using namespace D3D12Engine;
+    using namespace D3D12Engine::Benchmarks;
+
+    struct Position {
+        float X, Y, Z;
+    };
+
+    struct Velocity {
+        float X, Y, Z;
+    };
+
+    struct Health {
+        float Value;
+    };
+
+    struct Tag {
+        uint32_t Value;
+    };
+
+    struct alignas(64) CacheLine {
+        uint32_t Values[16];
+    };
+
+    // Every fourth entity doesn't move, so queries go over several archetypes.
+    std::vector<Entity> CreateEntities(EntityRegistry& registry, const uint32_t count) {
+        std::vector<Entity> entities;
+        entities.reserve(count);
+        for (uint32_t i = 0; i < count; i++) {
+            const Position position = {static_cast<float>(i), 0.0f, 0.0f};
+            entities.push_back(i % 4 == 0 ? registry.Create(position) : registry.Create(position, Velocity{1.0f, 2.0f, 0.0f}));
+        }
+
+        return entities;
+    }
+
+    void CheckRegistry() {
+        EntityRegistry registry;
+        std::vector<Entity> entities = CreateEntities(registry, 10'000);
+        DE_CHECK(registry.GetEntityCount() == 10'000 && registry.GetArchetypeCount() >= 2);
+
+        // Structural changes keep the values of the components that stay.
+        for (uint32_t i = 0; i < entities.size(); i += 3) {
+            registry.Add(entities[i], Health{static_cast<float>(i)});
+        }
+
+        for (uint32_t i = 0; i < entities.size(); i += 6) {
+            registry.Remove<Health>(entities[i]);
+        }
+
+        for (uint32_t i = 0; i < entities.size(); i++) {
+            DE_CHECK(registry.Get<Position>(entities[i])->X == static_cast<float>(i));
+            DE_CHECK(registry.Has<Velocity>(entities[i]) == (i % 4 != 0));
+            const Health* pHealth = registry.Get<Health>(entities[i]);
+            DE_CHECK(i % 3 == 0 && i % 6 != 0 ? pHealth != nullptr && pHealth->Value == static_cast<float>(i) : pHealth == nullptr);
+        }
+
+        // Rows stay packed after removals, freed slots come back with another generation.
+        const Entity removed = entities[40];
+        registry.Destroy(removed);
+        DE_CHECK(!registry.IsAlive(removed));
+        const Entity reused = registry.Create(Position{});
+        DE_CHECK(reused.Index == removed.Index && reused.Generation != removed.Generation);
+        DE_CHECK_THROWS(registry.Add(removed, Health{}), std::invalid_argument);
+        entities[40] = reused;
+
+        uint32_t visited = 0;
+        registry.ForEachChunk<Position>([&](const std::span<const Entity> chunkEntities, std::span<Position>) {
+            visited += static_cast<uint32_t>(chunkEntities.size());
+        });
+        DE_CHECK(visited == registry.GetEntityCount());
+
+        // Over-aligned components get aligned arrays.
+        registry.Add(entities[0], CacheLine{});
+        registry.ForEachChunk<CacheLine>([&](std::span<const Entity>, const std::span<CacheLine> lines) {
+            DE_CHECK(reinterpret_cast<uintptr_t>(lines.data()) % alignof(CacheLine) == 0);
+        });
+
+        // The parallel query sees the same entities, changes recorded from it apply afterwards.
+        JobSystem jobs(3);
+        EntityCommandBuffer commands;
+        std::atomic<uint32_t> moving = 0;
+        registry.ParallelForEach<Position, Velocity>(jobs, [&](const Entity entity, Position& position, const Velocity& velocity) {
+            position.Y += velocity.Y;
+            moving++;
+            if (static_cast<uint32_t>(position.X) % 2 == 0) {
+                commands.Destroy(entity);
+
+                // A replacement, finished by later commands through its placeholder.
+                const Entity replacement = commands.Create(Position{-position.X, 0.0f, 0.0f});
+                commands.Add(replacement, Tag{entity.Index});
+                commands.Add(replacement, Health{1.0f});
+                commands.Remove<Health>(replacement);
+            }
+        });
+
+        DE_CHECK(moving == 7500);
+        const uint32_t entityCount = registry.GetEntityCount();
+        commands.Playback(registry);
+        DE_CHECK(commands.GetCommandCount() == 0);
+        DE_CHECK(registry.GetEntityCount() == entityCount);
+
+        uint32_t replacements = 0;
+        registry.ForEach<Position, Tag>([&](const Entity entity, const Position& position, const Tag& tag) {
+            replacements++;
+            DE_CHECK(position.X <= 0.0f && !registry.Has<Health>(entity) && !registry.Has<Velocity>(entity));
+            DE_CHECK(!registry.IsAlive(entities[static_cast<uint32_t>(-position.X)]) && tag.Value == entities[static_cast<uint32_t>(-position.X)].Index);
+        });
+        DE_CHECK(replacements == 2500);
+
+        // Commands on a placeholder created and destroyed in the same buffer are skipped.
+        const Entity created = commands.Create(Position{});
+        commands.Destroy(created);
+        commands.Add(created, Tag{});
+        commands.Playback(registry);
+        DE_CHECK(registry.GetEntityCount() == entityCount);
+
+        // Placeholders of another buffer are rejected even where this one has the same index,
+        // and so are those of an earlier playback.
+        EntityCommandBuffer other;
+        const Entity foreign = commands.Create(Position{});
+        DE_CHECK(other.Create(Position{}).Index == foreign.Index);
+        DE_CHECK_THROWS(other.Destroy(foreign), std::invalid_argument);
+        commands.Clear();
+        DE_CHECK_THROWS(commands.Add(foreign, Tag{}), std::invalid_argument);
+        other.Playback(registry);
+        DE_CHECK(registry.GetEntityCount() == entityCount + 1);
+    }
+
+    void MeasureRegistry(const BenchmarkOptions& options) {
+        const uint32_t entityCount = options.Pick(1'000'000u, 100'000u);
+        const uint32_t runCount = options.Pick(5u, 1u);
+        const std::string count = std::to_string(entityCount) + " entities";
+        const auto perEntity = [&](const double seconds) {
+            return seconds * 1e9 / entityCount;
+        };
+
+        EntityRegistry registry;
+        std::vector<Entity> entities;
+        const double createSeconds = MeasureBest(1, [&] { entities = CreateEntities(registry, entityCount); });
+        PrintResult("Create, " + count, perEntity(createSeconds), "ns/entity");
+
+        const auto integrate = [](Entity, Position& position, const Velocity& velocity) {
+            position.X += velocity.X * 0.016f;
+            position.Y += velocity.Y * 0.016f;
+            position.Z += velocity.Z * 0.016f;
+        };
+
+        JobSystem jobs;
+        const double forEachSeconds = MeasureBest(runCount, [&] { registry.ForEach<Position, Velocity>(integrate); });
+        const double chunkSeconds = MeasureBest(runCount, [&] {
+            registry.ForEachChunk<Position, Velocity>([](std::span<const Entity>, const std::span<Position> positions, const std::span<Velocity> velocities) {
+                for (size_t i = 0; i < positions.size(); i++) {
+                    positions[i].X += velocities[i].X * 0.016f;
+                    positions[i].Y += velocities[i].Y * 0.016f;
+                    positions[i].Z += velocities[i].Z * 0.016f;
+                }
+            });
+        });
+        const double parallelSeconds = MeasureBest(runCount, [&] { registry.ParallelForEach<Position, Velocity>(jobs, integrate); });
+        g_Sink = g_Sink + static_cast<uint64_t>(registry.Get<Position>(entities[1])->X);
+
+        PrintResult("ForEach, " + count, perEntity(forEachSeconds), "ns/entity");
+        PrintResult("ForEachChunk, " + count, perEntity(chunkSeconds), "ns/entity");
+        PrintResult("ParallelForEach, " + std::to_string(jobs.GetWorkerCount() + 1) + " threads", perEntity(parallelSeconds), "ns/entity");
+
+        // Each add and remove moves the entity to another archetype.
+        const double addSeconds = MeasureBest(1, [&] {
+            for (const Entity entity : entities) {
+                registry.Add(entity, Health{100.0f});
+            }
+        });
+        const double removeSeconds = MeasureBest(1, [&] {
+            for (const Entity entity : entities) {
+                registry.Remove<Health>(entity);
+            }
+        });
+
+        PrintResult("Add component, " + count, perEntity(addSeconds), "ns/entity");
+        PrintResult("Remove component, " + count, perEntity(removeSeconds), "ns/entity");
+
+        EntityCommandBuffer commands;
+        const double recordSeconds = MeasureBest(1, [&] {
+            registry.ParallelForEach<Position>(jobs, [&](const Entity entity, const Position&) { commands.Add(entity, Tag{entity.Index}); });
+        });
+        DE_CHECK(commands.GetCommandCount() == entityCount);
+        const double playbackSeconds = MeasureBest(1, [&] { commands.Playback(registry); });
+
+        PrintResult("Record command, " + count, perEntity(recordSeconds), "ns/entity");
+        PrintResult("Play back command, " + count, perEntity(playbackSeconds), "ns/entity");
+
+        const double destroySeconds = MeasureBest(1, [&] {
+            for (const Entity entity : entities) {
+                registry.Destroy(entity);
+            }
+        });
+        DE_CHECK(registry.GetEntityCount() == 0);
+
+        PrintResult("Destroy, " + count, perEntity(destroySeconds), "ns/entity");
+    }
+}
+
+int main(const int argc, char** argv) {
+    const BenchmarkOptions options = BenchmarkOptions::Parse(argc, argv);
+
+    CheckRegistry();
+    MeasureRegistry(options);
+
+    return D3D12Engine::Tests::GetExitCode();
+}
@@ -0,0 +1,158 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/Renderer/ClusteredLighting.hpp>
+
+#include <BenchmarkHarness.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+    using namespace D3D12Engine;
+    using namespace D3D12Engine::Benchmarks;
+
+    constexpr float VerticalFov = std::numbers::pi_v<float> / 3.0f;
+    constexpr float AspectRatio = 16.0f / 9.0f;
+    constexpr float NearZ = 0.1f;
+    constexpr float FarZ = 150.0f;
+
+    // Lights spread over the view frustum and a bit around it, some behind the camera.
+    std::vector<PointLight> MakeLights(const uint32_t count, const uint32_t seed) {
+        std::mt19937 random(seed);
+        std::uniform_real_distribution<float> depth(-2.0f, FarZ);
+        std::uniform_real_distribution<float> side(-1.1f, 1.1f);
+        std::uniform_real_distribution<float> radius(0.5f, 3.5f);
+        const float tanHalfFovY = std::tan(VerticalFov * 0.5f);
+
+        std::vector<PointLight> lights;
+        for (uint32_t i = 0; i < count; i++) {
+            const float z = depth(random);
+            const float extent = std::max(z, 1.0f);
+            lights.push_back({{side(random) * extent * tanHalfFovY * AspectRatio, side(random) * extent * tanHalfFovY, z}, radius(random),
+                              {1.0f, 1.0f, 1.0f}, 1.0f});
+        }
+
+        return lights;
+    }
+
+    float DistanceSquared(const std::array<float, 3>& a, const std::array<float, 3>& b) {
+        return (a[0] - b[0]) * (a[0] - b[0]) + (a[1] - b[1]) * (a[1] - b[1]) + (a[2] - b[2]) * (a[2] - b[2]);
+    }
+
+    // Every light touching a point is in the cluster of the point, and every light of a
+    // cluster touches its box, computed here from the shader constants.
+    void Validate(const LightBinner& binner, const std::span<const PointLight> lights) {
+        const ClusterShaderConstants& constants = binner.GetShaderConstants();
+        const std::span<const ClusterCell> cells = binner.GetCells();
+        const std::span<const uint32_t> indices = binner.GetLightIndices();
+        DE_CHECK(binner.GetOverflowCount() == 0);
+        DE_CHECK(constants.LightCount == lights.size());
+
+        std::mt19937 random(11);
+        std::uniform_real_distribution<float> ndc(-1.0f, 1.0f);
+        std::uniform_real_distribution<float> logDepth(std::log(NearZ), std::log(FarZ));
+        for (uint32_t i = 0; i < 2000; i++) {
+            const float z = std::exp(logDepth(random));
+            const std::array<float, 3> point = {ndc(random) * z * constants.TanHalfFovX, ndc(random) * z * constants.TanHalfFovY, z};
+            const ClusterCell& cell = cells[binner.GetClusterIndex(point)];
+            const auto binned = indices.subspan(cell.Offset, cell.Count);
+
+            for (uint32_t light = 0; light < lights.size(); light++) {
+                if (DistanceSquared(point, lights[light].Position) <= lights[light].Radius * lights[light].Radius * 0.999f) {
+                    DE_CHECK(std::ranges::find(binned, light) != binned.end());
+                }
+            }
+        }
+
+        const auto sliceDepth = [&](const uint32_t slice) {
+            return std::exp((static_cast<float>(slice) - constants.DepthSliceBias) / constants.DepthSliceScale);
+        };
+
+        for (uint32_t cluster = 0; cluster < cells.size(); cluster++) {
+            const uint32_t tileX = cluster % constants.TileCountX;
+            const uint32_t tileY = cluster / constants.TileCountX % constants.TileCountY;
+            const uint32_t slice = cluster / (constants.TileCountX * constants.TileCountY);
+            const float depths[2] = {sliceDepth(slice), sliceDepth(slice + 1)};
+            const float ndcX[2] = {-1.0f + 2.0f * static_cast<float>(tileX) / constants.TileCountX,
+                                   -1.0f + 2.0f * static_cast<float>(tileX + 1) / constants.TileCountX};
+            const float ndcY[2] = {1.0f - 2.0f * static_cast<float>(tileY + 1) / constants.TileCountY,
+                                   1.0f - 2.0f * static_cast<float>(tileY) / constants.TileCountY};
+
+            std::array<float, 3> min = {std::min(ndcX[0] * depths[0], ndcX[0] * depths[1]) * constants.TanHalfFovX,
+                                        std::min(ndcY[0] * depths[0], ndcY[0] * depths[1]) * constants.TanHalfFovY, depths[0]};
+            std::array<float, 3> max = {std::max(ndcX[1] * depths[0], ndcX[1] * depths[1]) * constants.TanHalfFovX,
+                                        std::max(ndcY[1] * depths[0], ndcY[1] * depths[1]) * constants.TanHalfFovY, depths[1]};
+
+            for (const uint32_t light : indices.subspan(cells[cluster].Offset, cells[cluster].Count)) {
+                std::array<float, 3> closest;
+                for (uint32_t axis = 0; axis < 3; axis++) {
+                    closest[axis] = std::clamp(lights[light].Position[axis], min[axis], max[axis]);
+                }
+
+                DE_CHECK(DistanceSquared(closest, lights[light].Position) <= lights[light].Radius * lights[light].Radius * 1.001f + 1e-4f);
+            }
+        }
+    }
+
+    void CheckBinning(const BenchmarkOptions& options) {
+        const std::vector<PointLight> lights = MakeLights(options.Pick(10'000u, 1'000u), 3);
+        LightBinner binner;
+        binner.SetProjection(VerticalFov, AspectRatio, NearZ, FarZ);
+        binner.Bin(lights);
+        Validate(binner, lights);
+
+        // The job system only changes who bins each slice, not the result.
+        const std::vector<ClusterCell> cells(binner.GetCells().begin(), binner.GetCells().end());
+        const std::vector<uint32_t> indices(binner.GetLightIndices().begin(), binner.GetLightIndices().end());
+        JobSystem jobs(3);
+        binner.Bin(lights, &jobs);
+        DE_CHECK(std::ranges::equal(binner.GetCells(), cells, [](const ClusterCell& a, const ClusterCell& b) {
+            return a.Offset == b.Offset && a.Count == b.Count;
+        }));
+        DE_CHECK(std::ranges::equal(binner.GetLightIndices(), indices));
+
+        // A full cluster drops lights and counts them.
+        ClusterGridSettings small;
+        small.MaxLightsPerCluster = 4;
+        LightBinner limited(small);
+        limited.SetProjection(VerticalFov, AspectRatio, NearZ, FarZ);
+        limited.Bin(lights);
+        DE_CHECK(limited.GetOverflowCount() > 0);
+        DE_CHECK(limited.GetLightIndices().size() + limited.GetOverflowCount() == indices.size());
+    }
+
+    void MeasureBinning(const BenchmarkOptions& options) {
+        LightBinner binner;
+        binner.SetProjection(VerticalFov, AspectRatio, NearZ, FarZ);
+        JobSystem jobs;
+
+        for (const uint32_t lightCount : {1'000u, options.Pick(10'000u, 2'000u)}) {
+            const std::vector<PointLight> lights = MakeLights(lightCount, 5);
+            const std::string name = std::to_string(lightCount) + " lights";
+
+            const double singleSeconds = MeasureBest(options.Pick(10u, 2u), [&] { binner.Bin(lights); });
+            const double jobSeconds = MeasureBest(options.Pick(10u, 2u), [&] { binner.Bin(lights, &jobs); });
+            g_Sink = g_Sink + binner.GetLightIndices().size();
+
+            PrintResult("Binning, " + name + ", one thread", singleSeconds * 1e3, "ms");
+            PrintResult("Binning, " + name + ", " + std::to_string(jobs.GetWorkerCount() + 1) + " threads", jobSeconds * 1e3, "ms");
+            PrintResult("Light indices, " + name, static_cast<double>(binner.GetLightIndices().size()), "indices");
+            PrintResult("Lights per cluster, " + name, static_cast<double>(binner.GetLightIndices().size()) / binner.GetClusterCount(), "avg");
+        }
+    }
+}
+
+int main(const int argc, char** argv) {
+    const BenchmarkOptions options = BenchmarkOptions::Parse(argc, argv);
+
+    CheckBinning(options);
+    MeasureBinning(options);
+
+    return D3D12Engine::Tests::GetExitCode();
+}
@@ -0,0 +1,226 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/Assets/MeshSimplifier.hpp>
+#include <D3D12Engine/Renderer/LodSelector.hpp>
+
+#include <BenchmarkHarness.hpp>
+
+#include <array>
+#include <cmath>
+#include <numbers>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+    using namespace D3D12Engine;
+    using namespace D3D12Engine::Benchmarks;
+
+    constexpr size_t FloatsPerVertex = 7;
+
+    // Unit sphere, position then color, red on one side and blue on the other.
+    struct TestMesh {
+        std::vector<float> Vertices;
+        std::vector<uint32_t> Indices;
+
+        [[nodiscard]] size_t GetVertexCount() const { return Vertices.size() / FloatsPerVertex; }
+        [[nodiscard]] const float* GetVertex(const uint32_t vertex) const { return Vertices.data() + vertex * FloatsPerVertex; }
+        [[nodiscard]] VertexAttributeStream GetPositions() const { return {Vertices.data(), FloatsPerVertex, 3}; }
+        [[nodiscard]] VertexAttributeStream GetColors() const { return {Vertices.data() + 3, FloatsPerVertex, 4}; }
+    };
+
+    TestMesh MakeSphere(const uint32_t segments) {
+        TestMesh mesh;
+        const uint32_t rings = segments / 2;
+        for (uint32_t ring = 0; ring <= rings; ring++) {
+            for (uint32_t segment = 0; segment <= segments; segment++) {
+                const float theta = std::numbers::pi_v<float> * static_cast<float>(ring) / static_cast<float>(rings);
+                const float phi = 2.0f * std::numbers::pi_v<float> * static_cast<float>(segment) / static_cast<float>(segments);
+                const float red = segment < segments / 2 ? 1.0f : 0.0f;
+                mesh.Vertices.insert(mesh.Vertices.end(), {std::sin(theta) * std::cos(phi), std::cos(theta), std::sin(theta) * std::sin(phi),
+                                                          red, 0.0f, 1.0f - red, 1.0f});
+            }
+        }
+
+        for (uint32_t ring = 0; ring < rings; ring++) {
+            for (uint32_t segment = 0; segment < segments; segment++) {
+                const uint32_t a = ring * (segments + 1) + segment;
+                const uint32_t b = a + 1;
+                const uint32_t c = a + segments + 1;
+                const uint32_t d = c + 1;
+                mesh.Indices.insert(mesh.Indices.end(), {a, b, c, b, d, c});
+            }
+        }
+
+        return mesh;
+    }
+
+    struct LodError {
+        // Largest distance from the simplified surface to the sphere, relative to the simplifier's
+        // radius, half the bounds diagonal.
+        double Geometric = 0.0;
+        // Share of the surface covered by triangles blending the two colors.
+        double ColorBleed = 0.0;
+    };
+
+    // Triangles are sampled at their corners, edge midpoints and centroid. The sphere is
+    // convex, the chords of the simplified mesh all lie inside it.
+    LodError MeasureError(const TestMesh& mesh, const std::span<const uint32_t> indices) {
+        LodError error;
+        double totalArea = 0.0;
+        double bleedArea = 0.0;
+        for (size_t i = 0; i < indices.size(); i += 3) {
+            const float* p[3] = {mesh.GetVertex(indices[i]), mesh.GetVertex(indices[i + 1]), mesh.GetVertex(indices[i + 2])};
+            const auto distanceToSphere = [&](const float a, const float b, const float c) {
+                double point[3];
+                for (uint32_t axis = 0; axis < 3; axis++) {
+                    point[axis] = a * p[0][axis] + b * p[1][axis] + c * p[2][axis];
+                }
+
+                return (1.0 - std::sqrt(point[0] * point[0] + point[1] * point[1] + point[2] * point[2])) / std::numbers::sqrt3;
+            };
+
+            for (const auto& [a, b, c] : {std::array{0.5f, 0.5f, 0.0f}, std::array{0.0f, 0.5f, 0.5f}, std::array{0.5f, 0.0f, 0.5f},
+                                          std::array{1.0f / 3.0f, 1.0f / 3.0f, 1.0f / 3.0f}}) {
+                error.Geometric = std::max(error.Geometric, distanceToSphere(a, b, c));
+            }
+
+            const double e1[3] = {p[1][0] - p[0][0], p[1][1] - p[0][1], p[1][2] - p[0][2]};
+            const double e2[3] = {p[2][0] - p[0][0], p[2][1] - p[0][1], p[2][2] - p[0][2]};
+            const double cross[3] = {e1[1] * e2[2] - e1[2] * e2[1], e1[2] * e2[0] - e1[0] * e2[2], e1[0] * e2[1] - e1[1] * e2[0]};
+            const double area = std::sqrt(cross[0] * cross[0] + cross[1] * cross[1] + cross[2] * cross[2]) * 0.5;
+            totalArea += area;
+            if (p[0][3] != p[1][3] || p[0][3] != p[2][3]) {
+                bleedArea += area;
+            }
+        }
+
+        error.ColorBleed = bleedArea / totalArea;
+        return error;
+    }
+
+    void CheckValidation() {
+        const TestMesh mesh = MakeSphere(16);
+        const std::vector<uint32_t> outOfRange = {0, 1, static_cast<uint32_t>(mesh.GetVertexCount())};
+        DE_CHECK_THROWS(MeshSimplifier::Simplify(mesh.GetPositions(), {}, mesh.GetVertexCount(), outOfRange, 0), std::invalid_argument);
+        DE_CHECK_THROWS(MeshSimplifier::BuildLodChain(mesh.GetPositions(), {}, mesh.GetVertexCount(), outOfRange), std::invalid_argument);
+        DE_CHECK_THROWS(MeshSimplifier::Simplify(mesh.GetPositions(), {}, mesh.GetVertexCount(), std::span(mesh.Indices).first(4), 0),
+                        std::invalid_argument);
+
+        // A mesh without LODs has nothing to pick from.
+        LodSelector selector;
+        DE_CHECK(selector.Select({}, {{0.0f, 0.0f, 10.0f}, 1.0f}, 3) == 0);
+
+        const LodInstance instances[2] = {};
+        uint8_t currentLods[1] = {};
+        DE_CHECK_THROWS(selector.Select({}, instances, currentLods), std::invalid_argument);
+    }
+
+    void MeasureSimplifier(const BenchmarkOptions& options) {
+        const TestMesh mesh = MakeSphere(options.Pick(256u, 64u));
+        const VertexAttributeStream colors = mesh.GetColors();
+        const size_t triangleCount = mesh.Indices.size() / 3;
+
+        MeshLodChain chain;
+        const double seconds = MeasureBest(options.Pick(3u, 1u), [&] {
+            chain = MeshSimplifier::BuildLodChain(mesh.GetPositions(), {&colors, 1}, mesh.GetVertexCount(), mesh.Indices);
+        });
+
+        uint64_t processedTriangles = 0;
+        for (const MeshLod& lod : chain.Lods) {
+            processedTriangles += lod.IndexOffset > 0 ? triangleCount : 0;
+        }
+
+        DE_CHECK(chain.Lods.size() >= 4);
+        PrintResult("LOD chain, " + std::to_string(triangleCount) + " triangles", seconds * 1e3, "ms");
+        PrintResult("Simplification throughput", static_cast<double>(processedTriangles) / seconds * 1e-6, "Mtriangles/s");
+
+        // Quadrics measure how far vertices move off the source planes, the sag of the flatter
+        // triangles between them comes on top. It stays within a small factor of the reported error.
+        const LodError fullError = MeasureError(mesh, mesh.Indices);
+        for (size_t i = 0; i < chain.Lods.size(); i++) {
+            const MeshLod& lod = chain.Lods[i];
+            const LodError error = MeasureError(mesh, std::span(chain.Indices).subspan(lod.IndexOffset, lod.IndexCount));
+            const std::string name = "LOD " + std::to_string(i) + ", " + std::to_string(lod.IndexCount / 3) + " triangles";
+
+            DE_CHECK(i == 0 || lod.IndexCount < chain.Lods[i - 1].IndexCount);
+            DE_CHECK(i == 0 || lod.Error >= chain.Lods[i - 1].Error);
+            DE_CHECK(error.Geometric <= 3.0 * lod.Error + fullError.Geometric);
+            DE_CHECK(error.ColorBleed <= fullError.ColorBleed * 4.0);
+
+            PrintResult(name + ", reported error", lod.Error * 100.0, "% radius");
+            PrintResult(name + ", measured error", error.Geometric * 100.0, "% radius");
+            PrintResult(name + ", color bleed", error.ColorBleed * 100.0, "% area");
+        }
+    }
+
+    void MeasureSelector(const BenchmarkOptions& options) {
+        const MeshLod lods[] = {{0, 0, 0.0f}, {0, 0, 0.001f}, {0, 0, 0.002f}, {0, 0, 0.004f}, {0, 0, 0.008f}, {0, 0, 0.016f}};
+        LodSelector selector;
+        selector.SetView({0.0f, 0.0f, 0.0f}, std::numbers::pi_v<float> / 3.0f, 1080.0f);
+
+        // Moving away only ever coarsens, coming back only refines. LOD 1 is 4.7 pixels off at the ends.
+        uint32_t lod = 0;
+        for (float distance = 1.2f; distance < 4000.0f; distance *= 1.05f) {
+            const uint32_t next = selector.Select(lods, {{0.0f, 0.0f, distance}, 1.0f}, lod);
+            DE_CHECK(next >= lod);
+            lod = next;
+        }
+
+        DE_CHECK(lod == std::size(lods) - 1);
+        for (float distance = 4000.0f; distance > 1.2f; distance /= 1.05f) {
+            const uint32_t next = selector.Select(lods, {{0.0f, 0.0f, distance}, 1.0f}, lod);
+            DE_CHECK(next <= lod);
+            lod = next;
+        }
+
+        DE_CHECK(lod == 0);
+
+        // Jittering around a threshold within the hysteresis never switches.
+        const float threshold = 0.004f * 1080.0f / (2.0f * std::tan(std::numbers::pi_v<float> / 6.0f)) + 1.0f;
+        std::mt19937 random(3);
+        std::uniform_real_distribution<float> jitter(0.9f, 1.1f);
+        lod = selector.Select(lods, {{0.0f, 0.0f, threshold}, 1.0f}, 0);
+        uint32_t switches = 0;
+        for (uint32_t frame = 0; frame < 1000; frame++) {
+            const uint32_t next = selector.Select(lods, {{0.0f, 0.0f, threshold * jitter(random)}, 1.0f}, lod);
+            switches += next != lod;
+            lod = next;
+        }
+
+        DE_CHECK(switches == 0);
+
+        // Selection over a field of instances, the per frame cost.
+        const uint32_t instanceCount = options.Pick(1'000'000u, 10'000u);
+        std::uniform_real_distribution<float> position(-2000.0f, 2000.0f);
+        std::vector<LodInstance> instances;
+        for (uint32_t i = 0; i < instanceCount; i++) {
+            instances.push_back({{position(random), position(random), position(random)}, 1.0f});
+        }
+
+        std::vector<uint8_t> currentLods(instanceCount, 0);
+        const uint32_t frameCount = options.Pick(10u, 2u);
+        const double seconds = MeasureBest(3, [&] {
+            for (uint32_t frame = 0; frame < frameCount; frame++) {
+                selector.SetView({static_cast<float>(frame), 0.0f, 0.0f}, std::numbers::pi_v<float> / 3.0f, 1080.0f);
+                selector.Select(lods, instances, currentLods);
+            }
+        });
+
+        g_Sink = g_Sink + currentLods[0];
+        PrintResult("LOD selection", seconds * 1e9 / (static_cast<double>(frameCount) * instanceCount), "ns/instance");
+    }
+}
+
+int main(const int argc, char** argv) {
+    const BenchmarkOptions options = BenchmarkOptions::Parse(argc, argv);
+
+    CheckValidation();
+    MeasureSimplifier(options);
+    MeasureSelector(options);
+
+    return D3D12Engine::Tests::GetExitCode();
+}
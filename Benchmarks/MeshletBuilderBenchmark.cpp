@@ -0,0 +1,238 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/Assets/MeshletBuilder.hpp>
+
+#include <BenchmarkHarness.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <numbers>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+    using namespace D3D12Engine;
+    using namespace D3D12Engine::Benchmarks;
+
+    using Float3 = std::array<float, 3>;
+
+    struct TestMesh {
+        std::vector<float> Positions;
+        std::vector<uint32_t> Indices;
+
+        [[nodiscard]] Float3 GetPosition(const uint32_t vertex) const {
+            return {Positions[vertex * 3], Positions[vertex * 3 + 1], Positions[vertex * 3 + 2]};
+        }
+
+        [[nodiscard]] size_t GetVertexCount() const { return Positions.size() / 3; }
+    };
+
+    // Bumpy sphere with outward facing triangles, so every view direction has back faces to cull.
+    TestMesh MakeSphere(const uint32_t segments) {
+        TestMesh mesh;
+        const uint32_t rings = segments / 2;
+        for (uint32_t ring = 0; ring <= rings; ring++) {
+            for (uint32_t segment = 0; segment <= segments; segment++) {
+                const float theta = std::numbers::pi_v<float> * static_cast<float>(ring) / static_cast<float>(rings);
+                const float phi = 2.0f * std::numbers::pi_v<float> * static_cast<float>(segment) / static_cast<float>(segments);
+                const float radius = 1.0f + 0.05f * std::sin(phi * 7.0f) * std::sin(theta * 5.0f);
+                mesh.Positions.insert(mesh.Positions.end(), {radius * std::sin(theta) * std::cos(phi), radius * std::cos(theta),
+                                                            radius * std::sin(theta) * std::sin(phi)});
+            }
+        }
+
+        for (uint32_t ring = 0; ring < rings; ring++) {
+            for (uint32_t segment = 0; segment < segments; segment++) {
+                const uint32_t a = ring * (segments + 1) + segment;
+                const uint32_t b = a + 1;
+                const uint32_t c = a + segments + 1;
+                const uint32_t d = c + 1;
+                mesh.Indices.insert(mesh.Indices.end(), {a, b, c, b, d, c});
+            }
+        }
+
+        return mesh;
+    }
+
+    // Same triangles in random order, the builder can't rely on the index order for locality.
+    TestMesh Shuffle(TestMesh mesh) {
+        std::vector<std::array<uint32_t, 3>> triangles(mesh.Indices.size() / 3);
+        std::memcpy(triangles.data(), mesh.Indices.data(), mesh.Indices.size() * sizeof(uint32_t));
+        std::ranges::shuffle(triangles, std::mt19937(5));
+        std::memcpy(mesh.Indices.data(), triangles.data(), mesh.Indices.size() * sizeof(uint32_t));
+
+        return mesh;
+    }
+
+    Float3 Sub(const Float3& a, const Float3& b) {
+        return {a[0] - b[0], a[1] - b[1], a[2] - b[2]};
+    }
+
+    float Dot(const Float3& a, const Float3& b) {
+        return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+    }
+
+    Float3 Cross(const Float3& a, const Float3& b) {
+        return {a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2], a[0] * b[1] - a[1] * b[0]};
+    }
+
+    std::vector<std::array<uint32_t, 3>> GetSortedTriangles(std::span<const uint32_t> indices) {
+        std::vector<std::array<uint32_t, 3>> triangles;
+        for (size_t i = 0; i < indices.size(); i += 3) {
+            triangles.push_back({indices[i], indices[i + 1], indices[i + 2]});
+        }
+
+        std::ranges::sort(triangles);
+        return triangles;
+    }
+
+    // Checks the meshlets hold the mesh, respect the limits and that the culling data is
+    // conservative. Returns the fraction of meshlets culled as back facing from outside.
+    double Validate(const TestMesh& mesh, const MeshletMesh& meshlets, const MeshletBuilderSettings& settings) {
+        std::vector<uint32_t> indices;
+        for (const Meshlet& meshlet : meshlets.Meshlets) {
+            DE_CHECK(meshlet.VertexCount <= settings.MaxVertices);
+            DE_CHECK(meshlet.TriangleCount <= settings.MaxTriangles);
+            MeshletBuilder::AppendIndices(meshlets, meshlet, indices);
+        }
+
+        // Every triangle exactly once, winding kept.
+        DE_CHECK(GetSortedTriangles(indices) == GetSortedTriangles(mesh.Indices));
+
+        // Cameras all around the mesh and one inside it.
+        std::vector<Float3> cameras = {{0.0f, 0.0f, 0.0f}};
+        for (const float x : {-3.0f, 0.0f, 3.0f}) {
+            for (const float y : {-3.0f, 0.0f, 3.0f}) {
+                for (const float z : {-3.0f, 0.0f, 3.0f}) {
+                    if (x != 0.0f || y != 0.0f || z != 0.0f) {
+                        cameras.push_back({x, y, z});
+                    }
+                }
+            }
+        }
+
+        uint32_t culled = 0;
+        uint32_t tested = 0;
+        // Below the z = 0 plane.
+        const std::array<float, 4> plane = {0.0f, 0.0f, 1.0f, 0.0f};
+        for (size_t i = 0; i < meshlets.Meshlets.size(); i++) {
+            const Meshlet& meshlet = meshlets.Meshlets[i];
+            const MeshletBounds& bounds = meshlets.Bounds[i];
+
+            bool allBelowPlane = true;
+            for (uint32_t vertex = 0; vertex < meshlet.VertexCount; vertex++) {
+                const Float3 position = mesh.GetPosition(meshlets.VertexIndices[meshlet.VertexOffset + vertex]);
+                const Float3 offset = Sub(position, bounds.Center);
+                DE_CHECK(std::sqrt(Dot(offset, offset)) <= bounds.Radius * 1.0001f + 1e-6f);
+                allBelowPlane = allBelowPlane && position[2] < 0.0f;
+            }
+
+            // Frustum culling never drops a meshlet with a vertex inside.
+            if (bounds.IsOutsideFrustum({&plane, 1})) {
+                DE_CHECK(allBelowPlane);
+            }
+
+            // Back face culling never drops a meshlet with a triangle facing the camera.
+            for (const Float3& camera : cameras) {
+                const bool outside = Dot(camera, camera) > 0.0f;
+                tested += outside;
+                if (!bounds.IsBackfacing(camera)) {
+                    continue;
+                }
+
+                culled += outside;
+                for (uint32_t triangle = 0; triangle < meshlet.TriangleCount; triangle++) {
+                    Float3 corners[3];
+                    for (uint32_t corner = 0; corner < 3; corner++) {
+                        const uint8_t local = meshlets.PrimitiveIndices[meshlet.TriangleOffset + triangle * 3 + corner];
+                        corners[corner] = mesh.GetPosition(meshlets.VertexIndices[meshlet.VertexOffset + local]);
+                    }
+
+                    const Float3 normal = Cross(Sub(corners[1], corners[0]), Sub(corners[2], corners[0]));
+                    DE_CHECK(Dot(normal, Sub(corners[0], camera)) >= -1e-7f);
+                }
+            }
+        }
+
+        return static_cast<double>(culled) / tested;
+    }
+
+    void CheckCones() {
+        // A cone that can't cull anything never does, even seen from its apex.
+        const MeshletBounds wide = {{0.0f, 0.0f, 0.0f}, 1.0f, {0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}, 1.0f};
+        DE_CHECK(!wide.IsBackfacing(wide.ConeApex));
+        DE_CHECK(!wide.IsBackfacing({0.0f, 0.0f, -5.0f}));
+
+        // A flat patch facing +z is culled from anywhere behind it, and only from there.
+        const std::vector<float> positions = {0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f};
+        const std::vector<uint32_t> indices = {0, 1, 2, 1, 3, 2};
+        const MeshletMesh patch = MeshletBuilder::Build({positions.data(), 3, 3}, 4, indices);
+        DE_CHECK(patch.Meshlets.size() == 1);
+        DE_CHECK(patch.Bounds[0].IsBackfacing({0.5f, 0.5f, -1.0f}));
+        DE_CHECK(patch.Bounds[0].IsBackfacing({5.0f, -3.0f, -0.1f}));
+        DE_CHECK(!patch.Bounds[0].IsBackfacing({0.5f, 0.5f, 1.0f}));
+
+        const std::vector<uint32_t> outOfRange = {0, 1, 4};
+        DE_CHECK_THROWS(MeshletBuilder::Build({positions.data(), 3, 3}, 4, outOfRange), std::invalid_argument);
+        DE_CHECK_THROWS(MeshletBuilder::Build({positions.data(), 3, 3}, 4, std::span(indices).first(4)), std::invalid_argument);
+    }
+
+    void MeasureBuild(const BenchmarkOptions& options) {
+        const TestMesh sphere = MakeSphere(options.Pick(600u, 60u));
+        const TestMesh shuffled = Shuffle(sphere);
+        const MeshletBuilderSettings settings;
+
+        for (const auto& [name, mesh] : {std::pair<std::string, const TestMesh&>{"ordered", sphere}, {"shuffled", shuffled}}) {
+            MeshletMesh meshlets;
+            const double seconds = MeasureBest(3, [&] {
+                meshlets = MeshletBuilder::Build({mesh.Positions.data(), 3, 3}, mesh.GetVertexCount(), mesh.Indices, settings);
+            });
+
+            const double culledFraction = Validate(mesh, meshlets, settings);
+            const size_t triangleCount = mesh.Indices.size() / 3;
+
+            PrintResult("Build, " + name, seconds * 1e9 / static_cast<double>(triangleCount), "ns/triangle");
+            PrintResult("Triangles per meshlet, " + name, static_cast<double>(triangleCount) / meshlets.Meshlets.size(), "avg");
+            PrintResult("Vertices per meshlet, " + name, static_cast<double>(meshlets.VertexIndices.size()) / meshlets.Meshlets.size(), "avg");
+            PrintResult("Back facing from outside, " + name, culledFraction * 100.0, "% meshlets");
+        }
+    }
+
+    // What the culling pass costs per meshlet on the CPU fallback.
+    void MeasureCulling(const BenchmarkOptions& options) {
+        const TestMesh sphere = MakeSphere(options.Pick(600u, 60u));
+        const MeshletMesh meshlets = MeshletBuilder::Build({sphere.Positions.data(), 3, 3}, sphere.GetVertexCount(), sphere.Indices);
+        const std::array<float, 4> planes[] = {{1.0f, 0.0f, 0.0f, 0.5f}, {-1.0f, 0.0f, 0.0f, 0.5f}, {0.0f, 1.0f, 0.0f, 0.5f},
+                                               {0.0f, -1.0f, 0.0f, 0.5f}, {0.0f, 0.0f, -1.0f, 4.0f}, {0.0f, 0.0f, 1.0f, 0.0f}};
+        const uint32_t passCount = options.Pick(1'000u, 10u);
+
+        const double seconds = MeasureBest(3, [&] {
+            uint64_t visible = 0;
+            for (uint32_t pass = 0; pass < passCount; pass++) {
+                const Float3 camera = {0.0f, 0.0f, 3.0f + static_cast<float>(pass % 2)};
+                for (const MeshletBounds& bounds : meshlets.Bounds) {
+                    visible += !bounds.IsOutsideFrustum(planes) && !bounds.IsBackfacing(camera);
+                }
+            }
+
+            g_Sink = g_Sink + visible;
+        });
+
+        PrintResult("Cull test", seconds * 1e9 / (static_cast<double>(passCount) * meshlets.Bounds.size()), "ns/meshlet");
+    }
+}
+
+int main(const int argc, char** argv) {
+    const BenchmarkOptions options = BenchmarkOptions::Parse(argc, argv);
+
+    CheckCones();
+    MeasureBuild(options);
+    MeasureCulling(options);
+
+    return D3D12Engine::Tests::GetExitCode();
+}
@@ -0,0 +1,341 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/RHI/VertexLayout.hpp>
+#include <D3D12Engine/RHI/Null/NullCommandRecorder.hpp>
+#include <D3D12Engine/RHI/Null/NullRenderDevice.hpp>
+#include <D3D12Engine/Renderer/IndirectDrawBuilder.hpp>
+#include <D3D12Engine/Renderer/SceneRenderer.hpp>
+
+#include <BenchmarkHarness.hpp>
+
+#include <cstring>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+    using namespace D3D12Engine;
+    using namespace D3D12Engine::Benchmarks;
+
+    // VertexPosColorPacked, which lives with the DirectXMath vertex types.
+    using SceneVertexLayout = VertexLayout<VertexAttribute<"POSITION", VertexFormat::R16G16B16A16Snorm>,
+                                           VertexAttribute<"COLOR", VertexFormat::R8G8B8A8Unorm>>;
+
+    // Same root parameters as the application's pipelines.
+    constexpr RootParameterDesc SceneRootParameters[] = {
+        {RootParameterType::Constants, 0, 8, ShaderVisibility::Vertex}
+    };
+
+    constexpr RootParameterDesc UpscaleRootParameters[] = {
+        {RootParameterType::ShaderResource, 0, 0, ShaderVisibility::Pixel},
+        {RootParameterType::Constants, 0, 4, ShaderVisibility::Pixel}
+    };
+
+    // Drives the application's frames on the null backend: the indirect draw arguments
+    // are built and written, the frame recorded and its barriers resolved, without a GPU.
+    class NullFrameDriver {
+    public:
+        static constexpr uint32_t BackBufferCount = 2;
+        static constexpr RenderSize OutputSize = {1920, 1080};
+
+        NullFrameDriver(const uint32_t maxDrawCount, const uint32_t maxIndirectDrawCount)
+            : m_Recorder(m_Stream),
+              m_States(m_Device.GetResourceStates()),
+              m_IndirectDrawBuilder(maxIndirectDrawCount) {
+            PipelineDesc sceneDesc;
+            sceneDesc.InputLayout = SceneVertexLayout::Elements;
+            sceneDesc.RootParameters = SceneRootParameters;
+            sceneDesc.Name = "Scene";
+            m_ScenePipeline = m_Device.CreatePipeline(sceneDesc);
+
+            PipelineDesc upscaleDesc;
+            upscaleDesc.RootParameters = UpscaleRootParameters;
+            upscaleDesc.LinearClampSampler = true;
+            upscaleDesc.Name = "Upscale";
+            m_UpscalePipeline = m_Device.CreatePipeline(upscaleDesc);
+
+            m_IndirectSignature = m_Device.CreateCommandSignature(
+                IndirectDrawBuilder::GetSignatureDesc(m_ScenePipeline, SceneRenderer::PositionTransformRootIndex));
+
+            TextureDesc sceneColorDesc;
+            sceneColorDesc.Width = OutputSize.Width;
+            sceneColorDesc.Height = OutputSize.Height;
+            sceneColorDesc.Usage = TextureUsage::ShaderResource | TextureUsage::RenderTarget;
+            m_SceneColor = m_Device.CreateTexture(sceneColorDesc);
+
+            TextureDesc backBufferDesc = sceneColorDesc;
+            backBufferDesc.Usage = TextureUsage::RenderTarget;
+            backBufferDesc.InitialState = ResourceState::Present;
+            for (ResourceHandle& backBuffer : m_BackBuffers) {
+                backBuffer = m_Device.CreateTexture(backBufferDesc);
+            }
+
+            // Every per-draw mesh in its own GPU buffer, left in the copy destination state by its upload.
+            BufferDesc vertexBufferDesc;
+            vertexBufferDesc.Size = 3 * sizeof(SceneVertexLayout::Vertex);
+            vertexBufferDesc.Memory = MemoryType::Default;
+            vertexBufferDesc.Usage = BufferUsage::Vertex;
+            vertexBufferDesc.InitialState = ResourceState::CopyDest;
+            for (uint32_t i = 0; i < maxDrawCount; i++) {
+                const ResourceHandle buffer = m_Device.CreateBuffer(vertexBufferDesc);
+                m_Draws.push_back({{buffer, sizeof(SceneVertexLayout::Vertex), static_cast<uint32_t>(vertexBufferDesc.Size)}, 3, {}});
+            }
+
+            m_IndirectVertexBuffer = m_Device.CreateBuffer(vertexBufferDesc);
+
+            BufferDesc argumentDesc;
+            argumentDesc.Size = m_IndirectDrawBuilder.GetBufferSize();
+            m_IndirectArguments = m_Device.CreateBuffer(argumentDesc);
+            m_pIndirectArgumentData = m_Device.Map(m_IndirectArguments);
+        }
+
+        // One frame with the first drawCount per-draw meshes and indirectDrawCount indirect draws.
+        void RunFrame(const uint32_t drawCount, const uint32_t indirectDrawCount) {
+            m_IndirectDrawBuilder.Reset();
+            for (uint32_t i = 0; i < indirectDrawCount; i++) {
+                const float offset = static_cast<float>(i) * 0.001f;
+                m_IndirectDrawBuilder.Add({{1.0f, 1.0f, 1.0f, 1.0f}, {offset, offset, 0.0f, 0.0f}}, {3, 1, 0, 0});
+            }
+
+            m_IndirectDrawBuilder.Write({m_pIndirectArgumentData, m_IndirectDrawBuilder.GetBufferSize()});
+
+            m_Stream.Reset();
+            m_States.Reset();
+
+            SceneIndirectDraws indirectDraws;
+            indirectDraws.Signature = m_IndirectSignature;
+            indirectDraws.VertexBuffer = {m_IndirectVertexBuffer, sizeof(SceneVertexLayout::Vertex), 3 * sizeof(SceneVertexLayout::Vertex)};
+            indirectDraws.MaxCommandCount = m_IndirectDrawBuilder.GetMaxCommandCount();
+            indirectDraws.ArgumentBuffer = m_IndirectArguments;
+            indirectDraws.CountBuffer = m_IndirectArguments;
+            indirectDraws.CountOffset = m_IndirectDrawBuilder.GetCountOffset();
+
+            SceneFrame frame;
+            frame.SceneColor = m_SceneColor;
+            frame.SceneTargetSize = OutputSize;
+            frame.SceneSize = {OutputSize.Width * 3 / 4, OutputSize.Height * 3 / 4};
+            frame.BackBuffer = m_BackBuffers[m_FrameIndex];
+            frame.OutputSize = OutputSize;
+            frame.ScenePipeline = m_ScenePipeline;
+            frame.UpscalePipeline = m_UpscalePipeline;
+            frame.Draws = std::span(m_Draws).first(drawCount);
+            frame.pIndirectDraws = indirectDrawCount > 0 ? &indirectDraws : nullptr;
+
+            SceneRenderer::RecordFrame(m_Recorder, m_States, frame);
+
+            m_Transitions.clear();
+            m_States.Resolve(m_Transitions);
+
+            m_FrameIndex = (m_FrameIndex + 1) % BackBufferCount;
+            g_Sink = g_Sink + m_Stream.GetByteSize();
+        }
+
+        [[nodiscard]] const CommandStream& GetStream() const { return m_Stream; }
+        [[nodiscard]] const ResourceStateTracker& GetStates() const { return m_States; }
+        [[nodiscard]] std::span<const ResourceTransition> GetTransitions() const { return m_Transitions; }
+        [[nodiscard]] NullRenderDevice& GetDevice() { return m_Device; }
+        [[nodiscard]] std::span<const uint8_t> GetIndirectArguments() const { return m_Device.GetBufferData(m_IndirectArguments); }
+        [[nodiscard]] uint64_t GetIndirectCountOffset() const { return m_IndirectDrawBuilder.GetCountOffset(); }
+
+    private:
+        NullRenderDevice m_Device;
+        CommandStream m_Stream;
+        NullCommandRecorder m_Recorder;
+        ResourceStateTracker m_States;
+        IndirectDrawBuilder m_IndirectDrawBuilder;
+        PipelineHandle m_ScenePipeline;
+        PipelineHandle m_UpscalePipeline;
+        CommandSignatureHandle m_IndirectSignature;
+        ResourceHandle m_SceneColor;
+        ResourceHandle m_BackBuffers[BackBufferCount];
+        ResourceHandle m_IndirectVertexBuffer;
+        ResourceHandle m_IndirectArguments;
+        uint8_t* m_pIndirectArgumentData = nullptr;
+        std::vector<SceneDraw> m_Draws;
+        std::pmr::vector<ResourceTransition> m_Transitions;
+        uint32_t m_FrameIndex = 0;
+    };
+
+    void CheckFrame(NullFrameDriver& driver, const uint32_t drawCount) {
+        // The first frame moves the meshes out of their upload state, after that only the
+        // scene color and the back buffer change state, whatever the draw count.
+        driver.RunFrame(drawCount, 1);
+        driver.RunFrame(drawCount, 1);
+
+        const CommandStream& stream = driver.GetStream();
+        DE_CHECK(stream.GetCommandCount(RecordedCommand::Draw) == drawCount + 1);
+        DE_CHECK(stream.GetCommandCount(RecordedCommand::ExecuteIndirect) == 1);
+        DE_CHECK(stream.GetCommandCount(RecordedCommand::SetRootConstants) == drawCount * 2 + 1);
+        DE_CHECK(driver.GetStates().GetBarrierCount() == 2);
+        DE_CHECK(driver.GetTransitions().size() == 2);
+    }
+
+    void CheckPipelines() {
+        NullRenderDevice device;
+        PipelineDesc desc;
+        desc.RootParameters = SceneRootParameters;
+        desc.Name = "Scene";
+        const PipelineHandle pipeline = device.CreatePipeline(desc);
+        DE_CHECK(device.GetPipelineName(pipeline) == "Scene");
+
+        // The indirect transform takes all 8 constants, the upscale pipeline has no room for them.
+        const PipelineHandle upscale = device.CreatePipeline({.RootParameters = UpscaleRootParameters});
+        DE_CHECK(device.CreateCommandSignature(IndirectDrawBuilder::GetSignatureDesc(pipeline, 0)).IsValid());
+        DE_CHECK_THROWS(device.CreateCommandSignature(IndirectDrawBuilder::GetSignatureDesc(upscale, 1)), std::invalid_argument);
+        DE_CHECK_THROWS(device.CreateCommandSignature(IndirectDrawBuilder::GetSignatureDesc(upscale, 0)), std::invalid_argument);
+
+        // Reloads keep the root parameters the command signatures were created against.
+        desc.Name = "Scene reloaded";
+        device.ReplacePipeline(pipeline, desc);
+        DE_CHECK(device.GetPipelineName(pipeline) == "Scene reloaded");
+        DE_CHECK_THROWS(device.ReplacePipeline(pipeline, {.RootParameters = UpscaleRootParameters}), std::invalid_argument);
+    }
+
+    // The frame the application records: a few dozen meshes and the rest indirect.
+    void MeasureFrame(const BenchmarkOptions& options) {
+        const uint32_t frameCount = options.Pick(20'000u, 200u);
+        NullFrameDriver driver(32, 1024);
+        CheckFrame(driver, 32);
+
+        const double seconds = MeasureBest(3, [&] {
+            for (uint32_t frame = 0; frame < frameCount; frame++) {
+                driver.RunFrame(32, 1024);
+            }
+        });
+
+        PrintResult("Frame, 32 draws + 1024 indirect", seconds * 1e6 / frameCount, "us/frame");
+    }
+
+    // Cost of one more draw recorded on the CPU, from frames with and without them.
+    void MeasureDraws(const BenchmarkOptions& options) {
+        const uint32_t drawCount = 4096;
+        const uint32_t frameCount = options.Pick(500u, 10u);
+        NullFrameDriver driver(drawCount, 1);
+        CheckFrame(driver, drawCount);
+
+        const auto measure = [&](const uint32_t draws) {
+            return MeasureBest(3, [&] {
+                for (uint32_t frame = 0; frame < frameCount; frame++) {
+                    driver.RunFrame(draws, 1);
+                }
+            }) / frameCount;
+        };
+
+        const double emptyFrame = measure(0);
+        const double fullFrame = measure(drawCount);
+
+        PrintResult("Empty frame", emptyFrame * 1e6, "us/frame");
+        PrintResult("Per-draw recording", (fullFrame - emptyFrame) * 1e9 / drawCount, "ns/draw");
+    }
+
+    // The same draws recorded one by one or written to the argument buffer of a single
+    // ExecuteIndirect, what moving the scene to indirect draws saves on the CPU.
+    void MeasureIndirectVersusPerDraw(const BenchmarkOptions& options) {
+        for (const uint32_t drawCount : {256u, 4096u}) {
+            const uint32_t frameCount = options.Pick(2'000'000u / drawCount, 10u);
+            NullFrameDriver driver(drawCount, drawCount);
+
+            driver.RunFrame(drawCount, 0);
+            const size_t perDrawBytes = driver.GetStream().GetByteSize();
+            DE_CHECK(driver.GetStream().GetCommandCount(RecordedCommand::Draw) == drawCount + 1);
+
+            // Every draw lands in the argument buffer, behind the one ExecuteIndirect.
+            driver.RunFrame(0, drawCount);
+            const size_t indirectBytes = driver.GetStream().GetByteSize();
+            DE_CHECK(driver.GetStream().GetCommandCount(RecordedCommand::ExecuteIndirect) == 1);
+            DE_CHECK(driver.GetStream().GetCommandCount(RecordedCommand::Draw) == 1);
+
+            uint32_t writtenCount;
+            std::memcpy(&writtenCount, driver.GetIndirectArguments().data() + driver.GetIndirectCountOffset(), sizeof(writtenCount));
+            DE_CHECK(writtenCount == drawCount);
+
+            const auto measure = [&](const uint32_t draws, const uint32_t indirectDraws) {
+                return MeasureBest(3, [&] {
+                    for (uint32_t frame = 0; frame < frameCount; frame++) {
+                        driver.RunFrame(draws, indirectDraws);
+                    }
+                }) / frameCount;
+            };
+
+            const double perDraw = measure(drawCount, 0);
+            const double indirect = measure(0, drawCount);
+
+            const std::string count = std::to_string(drawCount);
+            PrintResult("Per-draw frame, " + count + " draws", perDraw * 1e6, "us/frame");
+            PrintResult("Indirect frame, " + count + " draws", indirect * 1e6, "us/frame");
+            PrintResult("Indirect speedup, " + count + " draws", perDraw / indirect, "x");
+            PrintResult("Per-draw command bytes, " + count + " draws", static_cast<double>(perDrawBytes) / drawCount, "B/draw");
+            PrintResult("Indirect argument + command bytes, " + count + " draws",
+                        static_cast<double>(IndirectDrawBuilder::CommandStride) + static_cast<double>(indirectBytes) / drawCount, "B/draw");
+        }
+    }
+
+    // Transitions of many render targets back and forth, tracked and recorded.
+    void MeasureBarriers(const BenchmarkOptions& options) {
+        const uint32_t textureCount = 1024;
+        const uint32_t iterationCount = options.Pick(2'000u, 20u);
+        NullFrameDriver driver(0, 1);
+        NullRenderDevice& device = driver.GetDevice();
+
+        TextureDesc desc;
+        desc.Width = 256;
+        desc.Height = 256;
+        desc.Usage = TextureUsage::ShaderResource | TextureUsage::RenderTarget;
+        std::vector<ResourceHandle> textures;
+        for (uint32_t i = 0; i < textureCount; i++) {
+            textures.push_back(device.CreateTexture(desc));
+        }
+
+        CommandStream stream;
+        NullCommandRecorder recorder(stream);
+        ResourceStateTracker states(device.GetResourceStates());
+
+        // Every texture written then sampled, each transition flushed on its own or all in one call.
+        const auto measure = [&](const bool batched) {
+            uint32_t barrierCount = 0;
+            const double seconds = MeasureBest(3, [&] {
+                barrierCount = 0;
+                for (uint32_t iteration = 0; iteration < iterationCount; iteration++) {
+                    stream.Reset();
+                    states.Reset();
+                    for (const ResourceState state : {ResourceState::RenderTarget, ResourceState::PixelShaderResource}) {
+                        for (const ResourceHandle texture : textures) {
+                            states.Require(texture, state);
+                            if (!batched) {
+                                states.FlushBarriers(recorder);
+                            }
+                        }
+
+                        states.FlushBarriers(recorder);
+                    }
+
+                    barrierCount += states.GetBarrierCount();
+                }
+            });
+
+            // The first use of each texture is resolved at submit, the second is a barrier.
+            DE_CHECK(barrierCount == textureCount * iterationCount);
+            DE_CHECK(stream.GetCommandCount(RecordedCommand::ResourceBarrier) == (batched ? 1 : textureCount));
+
+            return seconds / barrierCount;
+        };
+
+        PrintResult("Barrier, one per call", measure(false) * 1e9, "ns/barrier");
+        PrintResult("Barrier, batched", measure(true) * 1e9, "ns/barrier");
+    }
+}
+
+int main(const int argc, char** argv) {
+    const BenchmarkOptions options = BenchmarkOptions::Parse(argc, argv);
+
+    CheckPipelines();
+    MeasureFrame(options);
+    MeasureDraws(options);
+    MeasureIndirectVersusPerDraw(options);
+    MeasureBarriers(options);
+
+    return D3D12Engine::Tests::GetExitCode();
+}
@@ -0,0 +1,123 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/Assets/BlockCompressor.hpp>
+#include <D3D12Engine/Assets/MipChainGenerator.hpp>
+#include <D3D12Engine/Assets/TextureCooker.hpp>
+#include <D3D12Engine/Core/JobSystem.hpp>
+
+#include <BenchmarkHarness.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+    using namespace D3D12Engine;
+    using namespace D3D12Engine::Benchmarks;
+
+    struct FormatCase {
+        std::string_view Name;
+        TextureFormat Format;
+        // Channels the format stores, compared by the PSNR.
+        uint32_t ChannelCount;
+        double MinPsnr;
+    };
+
+    constexpr FormatCase Formats[] = {
+        {"BC1", TextureFormat::BC1Unorm, 3, 35.0},
+        {"BC5", TextureFormat::BC5Unorm, 2, 45.0},
+        {"BC7", TextureFormat::BC7Unorm, 4, 38.0},
+    };
+
+    // Smooth waves with a little noise, like most albedo and normal maps, at any size.
+    TextureImage MakeImage(const uint32_t width, const uint32_t height) {
+        std::mt19937 random(7);
+        std::uniform_int_distribution<int> noise(-3, 3);
+        TextureImage image{width, height, {}};
+        image.Pixels.reserve(static_cast<size_t>(width) * height * 4);
+        for (uint32_t y = 0; y < height; y++) {
+            for (uint32_t x = 0; x < width; x++) {
+                const float u = static_cast<float>(x) * 0.02f;
+                const float v = static_cast<float>(y) * 0.03f;
+                const float values[4] = {128.0f + 100.0f * std::sin(u) * std::cos(v), 128.0f + 90.0f * std::cos(u + v),
+                                         128.0f + 60.0f * std::sin(v * 1.7f), 200.0f + 50.0f * std::sin(u * 0.5f)};
+                for (const float value : values) {
+                    image.Pixels.push_back(static_cast<uint8_t>(std::clamp(static_cast<int>(value) + noise(random), 0, 255)));
+                }
+            }
+        }
+
+        return image;
+    }
+
+    std::vector<std::byte> Compress(const TextureImage& image, const TextureFormat format, JobSystem* pJobSystem) {
+        std::vector<std::byte> blocks(GetSurfaceByteSize(format, image.Width, image.Height));
+        BlockCompressor::Compress(image, format, blocks, pJobSystem);
+
+        return blocks;
+    }
+
+    // The job system only changes who encodes each block row, the quality holds on partial edge blocks.
+    void CheckCompression() {
+        const TextureImage image = MakeImage(70, 37);
+        JobSystem jobs(3);
+        for (const FormatCase& format : Formats) {
+            const std::vector<std::byte> blocks = Compress(image, format.Format, nullptr);
+            DE_CHECK(blocks == Compress(image, format.Format, &jobs));
+
+            const TextureImage decoded = BlockCompressor::Decompress(blocks, format.Format, image.Width, image.Height);
+            DE_CHECK(TextureCooker::ComputePsnr(image, decoded, format.ChannelCount) > format.MinPsnr);
+        }
+    }
+
+    void MeasureCompression(const BenchmarkOptions& options) {
+        const uint32_t size = options.Pick(2048u, 256u);
+        const uint32_t runCount = options.Pick(3u, 1u);
+        const TextureImage image = MakeImage(size, size);
+        const double megaPixels = static_cast<double>(size) * size / 1e6;
+        const std::string imageName = std::to_string(size) + "x" + std::to_string(size);
+
+        JobSystem jobs;
+        const std::string threadName = "job system, " + std::to_string(jobs.GetWorkerCount() + 1) + " threads";
+        for (const FormatCase& format : Formats) {
+            std::vector<std::byte> blocks;
+            const double singleSeconds = MeasureBest(runCount, [&] { blocks = Compress(image, format.Format, nullptr); });
+            const double parallelSeconds = MeasureBest(runCount, [&] { blocks = Compress(image, format.Format, &jobs); });
+
+            const TextureImage decoded = BlockCompressor::Decompress(blocks, format.Format, size, size);
+            const double psnr = TextureCooker::ComputePsnr(image, decoded, format.ChannelCount);
+            DE_CHECK(psnr > format.MinPsnr);
+
+            const std::string name = std::string(format.Name) + ", " + imageName;
+            PrintResult(name + ", single thread", megaPixels / singleSeconds, "MPix/s");
+            PrintResult(name + ", " + threadName, megaPixels / parallelSeconds, "MPix/s");
+            PrintResult(name + ", PSNR", psnr, "dB");
+        }
+
+        // Mips and compression together on the job system, what the cooker does for each texture.
+        TextureCookSettings settings;
+        settings.Format = TextureFormat::BC7UnormSrgb;
+        uint32_t mipCount = 0;
+        const double cookSeconds = MeasureBest(runCount, [&] {
+            mipCount = static_cast<uint32_t>(TextureCooker::Cook(image, settings, &jobs).SourceMips.size());
+        });
+        DE_CHECK(mipCount == MipChainGenerator::GetFullMipCount(size, size));
+
+        PrintResult("Cook BC7 sRGB with mips, " + imageName + ", job system", megaPixels / cookSeconds, "MPix/s");
+    }
+}
+
+int main(const int argc, char** argv) {
+    const BenchmarkOptions options = BenchmarkOptions::Parse(argc, argv);
+
+    CheckCompression();
+    MeasureCompression(options);
+
+    return D3D12Engine::Tests::GetExitCode();
+}
@@ -9,10 +9,26 @@
 
 
 #include <D3D12Engine/pch.hpp>
+#include <D3D12Engine/Assets/AssetLoader.hpp>
+#include <D3D12Engine/Assets/ShaderHotReloader.hpp>
+#include <D3D12Engine/Assets/ShaderPermutation.hpp>
+#include <D3D12Engine/Core/Benchmark.hpp>
+#include <D3D12Engine/Core/DynamicResolution.hpp>
+#include <D3D12Engine/Core/InputEventQueue.hpp>
+#include <D3D12Engine/Core/JobSystem.hpp>
+#include <D3D12Engine/Core/LinearArena.hpp>
+#include <D3D12Engine/Core/ResizeCoalescer.hpp>
+#include <D3D12Engine/Core/ScriptedCamera.hpp>
 #include <D3D12Engine/Core/StepTimer.hpp>
 #include <D3D12Engine/Core/Window.hpp>
+#include <D3D12Engine/RHI/GpuTimer.hpp>
+#include <D3D12Engine/RHI/ResourceStateTracker.hpp>
 #include <D3D12Engine/RHI/Vertex.hpp>
+#include <D3D12Engine/RHI/D3D12/D3D12RenderDevice.hpp>
+#include <D3D12Engine/Renderer/IndirectDrawBuilder.hpp>
+#include <D3D12Engine/Scene/EntityRegistry.hpp>
 #include <D3D12Engine/RHI/VertexBuffer.hpp>
+#include <D3D12Engine/RHI/VertexQuantizer.hpp>
 
 #include <directxtk12/Keyboard.h>
 #include <directxtk12/Mouse.h>
@@ -35,12 +51,27 @@ namespace D3D12Engine {
         void OnDestroy();
 
         void OnWindowSizeChanged(int width, int height);
+        void OnBeginInteractiveResize();
+        void OnEndInteractiveResize();
+        void OnInputMessage(UINT msg, WPARAM wParam, LPARAM lParam);
 
     private:
+        struct ShaderVariant {
+            ComPtr<ID3DBlob> VertexShader;
+            ComPtr<ID3DBlob> PixelShader;
+        };
+
+        struct ShaderProgram {
+            ShaderVariantTable<ShaderVariant> Variants;
+        };
+
         std::unique_ptr<Window> m_Window;
         static constexpr UINT FrameCount = 2;
+        static constexpr uint32_t MaxIndirectDraws = 1024;
+        static constexpr size_t FrameArenaSize = 1024 * 1024;
         bool m_UseWarpDevice = false;
         float m_AspectRatio;
+        ResizeCoalescer m_ResizeCoalescer;
 
 #ifdef DE_DEBUG
         ComPtr<ID3D12Debug> m_Debug;
@@ -48,32 +79,89 @@ namespace D3D12Engine {
         ComPtr<ID3D12InfoQueue> m_DxgiInfoQueue;
 #endif
         
-        CD3DX12_VIEWPORT m_Viewport;
-        CD3DX12_RECT m_ScissorRect;
+        RenderSize m_OutputSize;
+        ComPtr<IDXGIAdapter> m_Adapter;
+        // Null when the adapter can't report its memory budget, which needs DXGI 1.4.
+        ComPtr<IDXGIAdapter3> m_BudgetAdapter;
         ComPtr<IDXGISwapChain3> m_SwapChain;
         ComPtr<ID3D12Device> m_Device;
-        ComPtr<ID3D12Resource> m_RenderTargets[FrameCount];
+        std::unique_ptr<D3D12RenderDevice> m_RenderDevice;
+        ResourceHandle m_RenderTargets[FrameCount];
         ComPtr<ID3D12CommandAllocator> m_CommandAllocator;
         ComPtr<ID3D12CommandQueue> m_CommandQueue;
-        ComPtr<ID3D12RootSignature> m_RootSignature;
-        ComPtr<ID3D12DescriptorHeap> m_RtvHeap;
-        ComPtr<ID3D12PipelineState> m_PipelineState;
+        // One pipeline per compiled variant of the scene shader.
+        ShaderVariantTable<PipelineHandle> m_ScenePipelines;
         ComPtr<ID3D12GraphicsCommandList> m_CommandList;
-        UINT m_RtvDescriptorSize;
+        // Transitions into the states the frame's command list starts with, resolved at
+        // submit and executed just before it.
+        ComPtr<ID3D12GraphicsCommandList> m_BarrierCommandList;
+        std::unique_ptr<ResourceStateTracker> m_ResourceStateTracker;
+
+        // Dynamic resolution: the scene is rendered into part of an offscreen target
+        // sized for the window, then upscaled to the back buffer.
+        RenderSize m_SceneSize;
+        RenderSize m_SceneTargetSize;
+        ResourceHandle m_SceneColor;
+        PipelineHandle m_UpscalePipelineState;
+        DynamicResolutionController m_ResolutionController;
+        std::unique_ptr<GpuTimer> m_GpuTimer;
+
+        // App resources. Shader variants compile in parallel on the job system, from the
+        // asset loader threads, which are stopped first.
+        std::unique_ptr<JobSystem> m_ShaderJobs;
+        std::unique_ptr<AssetLoader> m_AssetLoader;
+        AssetHandle<ShaderProgram> m_BasicShader;
+        AssetHandle<ShaderProgram> m_UpscaleShader;
+        // Features of basic.hlsl, and the variants the scene materials refer to, which are
+        // the only ones compiled.
+        ShaderPermutationSpace m_BasicShaderFeatures;
+        std::vector<ShaderPermutationKey> m_BasicShaderVariants;
+        ShaderPermutationKey m_SceneMaterial;
+#ifdef DE_DEBUG
+        // Shaders are recompiled in the background when their sources change, the pipeline
+        // states are swapped by the PumpUploads() at the start of a later frame.
+        std::unique_ptr<ShaderHotReloader> m_ShaderHotReloader;
+#endif
+        std::unique_ptr<VertexBuffer<VertexPosColorPacked::Vertex>> m_VertexBuffer;
+        // Scene objects, each one drawn with the IndirectDrawCommand component it has.
+        EntityRegistry m_Scene;
 
-        // App resources.
-        std::unique_ptr<VertexBuffer<VertexPosColor>> m_VertexBuffer;
+        // Scene draws are issued with one ExecuteIndirect, the arguments are built on the CPU
+        // into a persistently mapped upload buffer.
+        IndirectDrawBuilder m_IndirectDrawBuilder;
+        ResourceHandle m_IndirectArguments;
+        uint8_t* m_pIndirectArgumentData;
+        CommandSignatureHandle m_IndirectSignature;
 
         // Application timer.
         StepTimer m_Timer;
 
+        // Set by --benchmark: every frame then advances the scripted camera by one fixed step,
+        // and is measured once the scene is loaded. The app closes when the report is written.
+        std::unique_ptr<BenchmarkRun> m_Benchmark;
+        std::unique_ptr<ScriptedCamera> m_BenchmarkCamera;
+        std::array<float, 3> m_CameraPosition;
+        double m_FrameStartTime;
+        double m_PreviousFrameStartTime;
+        double m_FrameCpuMs;
+
+        // Set by --memory-report: the GPU memory statistics are written to a file periodically
+        // and when the app closes.
+        std::optional<GpuMemoryReportSettings> m_MemoryReport;
+        double m_LastMemoryReportTime;
+
+        // Transient CPU data of the frame being built, released when the next frame starts.
+        LinearArena m_FrameArena;
+
         // Synchronisation objects.
         UINT m_FrameIndex;
         HANDLE m_FrameEvent;
         ComPtr<ID3D12Fence> m_Fence;
         UINT64 m_FenceValue;
 
-        // Input objects.
+        // Input objects. Input messages are queued by the window procedure and handed to the
+        // devices by the update step they fall into.
+        InputEventQueue m_InputEvents;
         std::unique_ptr<DirectX::Mouse> m_Mouse;
         std::unique_ptr<DirectX::Keyboard> m_Keyboard;
 
@@ -83,10 +171,35 @@ namespace D3D12Engine {
 
         void LoadPipeline();
         void LoadAssets();
+        void CreatePipelineState(const ShaderProgram& program);
+        void CreateUpscalePipelineState(const ShaderProgram& program);
+        void CreateSceneColorTarget(UINT width, UINT height);
+        void UpdateSceneSize();
+        void ReloadChangedShaders();
+        void BuildIndirectDraws();
         void PopulateCommandList() const;
+        void ExecuteCommandList();
         void WaitForPreviousFrame();
-
-        static std::wstring GetAssetFullPath(const std::wstring& assetName);
+        void CreateRenderTargetViews();
+        void Resize(WindowSize size);
+        void StartBenchmark(const BenchmarkSettings& settings);
+        void RecordBenchmarkFrame();
+        void UpdateMemoryStatistics();
+        [[nodiscard]] std::string GetAdapterName() const;
+
+        static void ProcessInputEvent(const InputEvent& event);
+        static double GetTimeSeconds();
+        static uint64_t GetProcessMemoryUsage();
+
+        // Compiles the given variants, only the one without features by default.
+        AssetHandle<ShaderProgram> LoadShaderProgram(const std::filesystem::path& shaderPath, void (Application::*onLoaded)(const ShaderProgram&),
+                                                     const ShaderPermutationSpace& features = {},
+                                                     std::vector<ShaderPermutationKey> variants = {ShaderPermutationKey{}});
+        static ComPtr<ID3DBlob> CompileShader(std::span<const std::byte> source, const std::string& sourceName,
+                                              std::span<const ShaderDefine> defines, const char* entryPoint, const char* target);
+
+        static std::filesystem::path GetAssetFullPath(std::wstring_view assetName);
+        static std::filesystem::path GetShaderPath(std::wstring_view assetName);
     };
 }
 
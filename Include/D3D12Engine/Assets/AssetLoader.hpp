@@ -0,0 +1,168 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef DE_ASSETS_ASSETLOADER_HPP
+#define DE_ASSETS_ASSETLOADER_HPP
+
+#include <D3D12Engine/Core/BoundedQueue.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace D3D12Engine {
+    enum class AssetPriority : uint8_t {
+        Low,
+        Normal,
+        High,
+        Critical
+    };
+
+    enum class AssetState : uint8_t {
+        Queued,
+        Reading,
+        Decoding,
+        WaitingForUpload,
+        Ready,
+        Failed,
+        Cancelled
+    };
+
+    struct AssetTimings {
+        using Clock = std::chrono::steady_clock;
+
+        Clock::time_point Queued;
+        Clock::time_point ReadFinished;
+        Clock::time_point DecodeFinished;
+        Clock::time_point Ready;
+    };
+
+    struct AssetLoaderSettings {
+        uint32_t DecodeThreadCount = 2;
+        // Capacity of the queues between stages, a full queue stalls the stage feeding it.
+        // Load() never waits though, requests that don't fit the read queue fail right away.
+        size_t ReadQueueCapacity = 256;
+        size_t DecodeQueueCapacity = 8;
+        size_t UploadQueueCapacity = 8;
+    };
+
+    struct AssetLoaderStats {
+        std::atomic<uint64_t> BytesRead = 0;
+        std::atomic<uint32_t> Completed = 0;
+        std::atomic<uint32_t> Failed = 0;
+        std::atomic<uint32_t> Cancelled = 0;
+    };
+
+    // Shared between a handle and the loader stages.
+    class AssetRequest {
+    public:
+        std::filesystem::path Path;
+        AssetPriority Priority = AssetPriority::Normal;
+        uint64_t Sequence = 0;
+        std::atomic<AssetState> State = AssetState::Queued;
+        std::vector<std::byte> FileData;
+        std::shared_ptr<void> Asset;
+        std::string Error;
+        AssetTimings Timings;
+
+        std::function<std::shared_ptr<void>(std::span<const std::byte>)> Decode;
+        std::function<void(void*)> Upload;
+
+        // Moves to the given state unless the request already reached a terminal one.
+        bool Advance(AssetState state);
+    };
+
+    template <typename T>
+    class AssetHandle {
+    public:
+        AssetHandle() = default;
+        explicit AssetHandle(std::shared_ptr<AssetRequest> request);
+
+        [[nodiscard]] inline bool IsValid() const;
+        [[nodiscard]] inline AssetState GetState() const;
+        [[nodiscard]] inline bool IsReady() const;
+        [[nodiscard]] inline bool IsDone() const;
+        // Null until the asset is ready.
+        [[nodiscard]] inline T* Get() const;
+        [[nodiscard]] inline const std::string& GetError() const;
+        [[nodiscard]] inline const AssetTimings& GetTimings() const;
+        [[nodiscard]] inline const std::shared_ptr<AssetRequest>& GetRequest() const;
+
+        // Best effort, has no effect once the asset is ready.
+        inline void Cancel() const;
+
+    private:
+        std::shared_ptr<AssetRequest> m_Request;
+    };
+
+    // Loads assets through three stages connected by bounded queues: a file read
+    // on a dedicated IO thread, a CPU decode on a pool of worker threads, and an
+    // upload step run by whoever calls PumpUploads(), the render thread in practice
+    // since that is where the command lists live. Higher priorities overtake lower
+    // ones at every stage, requests of equal priority keep their submission order.
+    // Destroying the loader cancels everything still queued.
+    class AssetLoader {
+    public:
+        explicit AssetLoader(const AssetLoaderSettings& settings = {});
+        ~AssetLoader();
+
+        AssetLoader(const AssetLoader&) = delete;
+        AssetLoader(AssetLoader&&) = delete;
+
+        // decode runs on a worker thread and returns nullptr on failure, upload is optional.
+        // The request fails immediately when the read queue is full.
+        template <typename T>
+        AssetHandle<T> Load(std::filesystem::path path,
+                            AssetPriority priority,
+                            std::function<std::unique_ptr<T>(std::span<const std::byte>)> decode,
+                            std::function<void(T&)> upload = {});
+
+        // Runs pending uploads until none are left or maxUploads were done, returns how many ran.
+        uint32_t PumpUploads(uint32_t maxUploads = ~0u);
+
+        // Pumps uploads until the request is done, only call this from the upload thread.
+        void Wait(const std::shared_ptr<AssetRequest>& request);
+
+        [[nodiscard]] inline const AssetLoaderStats& GetStats() const;
+
+        AssetLoader& operator=(const AssetLoader&) = delete;
+        AssetLoader& operator=(AssetLoader&&) = delete;
+
+    private:
+        struct RequestOrder {
+            bool operator()(const std::shared_ptr<AssetRequest>& a, const std::shared_ptr<AssetRequest>& b) const;
+        };
+
+        using RequestQueue = BoundedQueue<std::shared_ptr<AssetRequest>, RequestOrder>;
+
+        void Submit(std::shared_ptr<AssetRequest> request);
+        void ReadMain();
+        void DecodeMain();
+        void Finish(AssetRequest& request, AssetState state);
+
+        AssetLoaderStats m_Stats;
+        std::atomic<uint64_t> m_NextSequence = 0;
+
+        RequestQueue m_ReadQueue;
+        RequestQueue m_DecodeQueue;
+        RequestQueue m_UploadQueue;
+
+        std::thread m_ReadThread;
+        std::vector<std::thread> m_DecodeThreads;
+    };
+}
+
+#include <D3D12Engine/Assets/AssetLoader.inl>
+
+#endif // DE_ASSETS_ASSETLOADER_HPP
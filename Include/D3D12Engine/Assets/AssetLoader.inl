@@ -0,0 +1,85 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+namespace D3D12Engine {
+    template <typename T>
+    AssetHandle<T>::AssetHandle(std::shared_ptr<AssetRequest> request)
+        : m_Request(std::move(request)) {
+    }
+
+    template <typename T>
+    inline bool AssetHandle<T>::IsValid() const {
+        return m_Request != nullptr;
+    }
+
+    template <typename T>
+    inline AssetState AssetHandle<T>::GetState() const {
+        return m_Request->State.load(std::memory_order_acquire);
+    }
+
+    template <typename T>
+    inline bool AssetHandle<T>::IsReady() const {
+        return m_Request && GetState() == AssetState::Ready;
+    }
+
+    template <typename T>
+    inline bool AssetHandle<T>::IsDone() const {
+        const AssetState state = GetState();
+        return state == AssetState::Ready || state == AssetState::Failed || state == AssetState::Cancelled;
+    }
+
+    template <typename T>
+    inline T* AssetHandle<T>::Get() const {
+        return IsReady() ? static_cast<T*>(m_Request->Asset.get()) : nullptr;
+    }
+
+    template <typename T>
+    inline const std::string& AssetHandle<T>::GetError() const {
+        return m_Request->Error;
+    }
+
+    template <typename T>
+    inline const AssetTimings& AssetHandle<T>::GetTimings() const {
+        return m_Request->Timings;
+    }
+
+    template <typename T>
+    inline const std::shared_ptr<AssetRequest>& AssetHandle<T>::GetRequest() const {
+        return m_Request;
+    }
+
+    template <typename T>
+    inline void AssetHandle<T>::Cancel() const {
+        m_Request->Advance(AssetState::Cancelled);
+    }
+
+    template <typename T>
+    AssetHandle<T> AssetLoader::Load(std::filesystem::path path,
+                                     const AssetPriority priority,
+                                     std::function<std::unique_ptr<T>(std::span<const std::byte>)> decode,
+                                     std::function<void(T&)> upload) {
+        auto request = std::make_shared<AssetRequest>();
+        request->Path = std::move(path);
+        request->Priority = priority;
+        request->Decode = [decode = std::move(decode)](const std::span<const std::byte> data) -> std::shared_ptr<void> {
+            return std::shared_ptr<T>(decode(data));
+        };
+
+        if (upload) {
+            request->Upload = [upload = std::move(upload)](void* asset) {
+                upload(*static_cast<T*>(asset));
+            };
+        }
+
+        Submit(request);
+
+        return AssetHandle<T>(std::move(request));
+    }
+
+    inline const AssetLoaderStats& AssetLoader::GetStats() const {
+        return m_Stats;
+    }
+}
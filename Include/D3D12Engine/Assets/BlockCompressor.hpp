@@ -0,0 +1,51 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef DE_ASSETS_BLOCKCOMPRESSOR_HPP
+#define DE_ASSETS_BLOCKCOMPRESSOR_HPP
+
+#include <D3D12Engine/Assets/TextureFormat.hpp>
+#include <D3D12Engine/Assets/TextureImage.hpp>
+
+#include <cstddef>
+#include <span>
+
+namespace D3D12Engine {
+    class JobSystem;
+
+    // BC1, BC5 and BC7 encoders for the texture cooker. Blocks are 4x4 RGBA8 pixels, rows
+    // first. Endpoints come from the principal axis of the block colors and are refined by
+    // least squares, palette indices are picked four pixels at a time with SSE.
+    //  - BC1 encodes RGB only, in four color mode.
+    //  - BC5 encodes R and G as two BC4 blocks.
+    //  - BC7 only uses mode 6, one RGBA subset with 16 levels: far from the best encoders
+    //    on blocks with several distinct colors, but fast and always as good as BC1.
+    class BlockCompressor {
+    public:
+        static constexpr uint32_t BlockPixelCount = 16;
+
+        BlockCompressor() = delete;
+
+        [[nodiscard]] static bool IsSupported(TextureFormat format);
+
+        static void EncodeBC1Block(const uint8_t* pPixels, std::byte* pBlock);
+        static void EncodeBC5Block(const uint8_t* pPixels, std::byte* pBlock);
+        static void EncodeBC7Block(const uint8_t* pPixels, std::byte* pBlock);
+
+        // Decodes blocks of the supported formats. Only BC7 mode 6 blocks are decoded,
+        // other modes throw std::runtime_error.
+        static void DecodeBlock(TextureFormat format, const std::byte* pBlock, uint8_t* pPixels);
+
+        // Compresses the whole image, edge blocks repeat the last row and column. The output
+        // must hold GetSurfaceByteSize() bytes. Block rows are spread over the job system
+        // when there is one.
+        static void Compress(const TextureImage& image, TextureFormat format, std::span<std::byte> output,
+                             JobSystem* pJobSystem = nullptr);
+        static TextureImage Decompress(std::span<const std::byte> data, TextureFormat format, uint32_t width, uint32_t height);
+    };
+}
+
+#endif // DE_ASSETS_BLOCKCOMPRESSOR_HPP
@@ -0,0 +1,59 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef DE_ASSETS_DDSFILE_HPP
+#define DE_ASSETS_DDSFILE_HPP
+
+#include <D3D12Engine/Assets/TextureFormat.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace D3D12Engine {
+    struct DdsMipLevel {
+        uint32_t Width;
+        uint32_t Height;
+        uint64_t FileOffset;
+        uint64_t ByteSize;
+    };
+
+    // Describes where each mip of a 2D DDS texture lives in the file, so that single
+    // levels can be read without loading the whole chain.
+    struct DdsLayout {
+        TextureFormat Format = TextureFormat::Unknown;
+        uint32_t Width = 0;
+        uint32_t Height = 0;
+        std::vector<DdsMipLevel> Mips;
+
+        [[nodiscard]] inline uint32_t GetMipCount() const;
+        [[nodiscard]] inline uint64_t GetTotalByteSize() const;
+    };
+
+    class DdsFile {
+    public:
+        // Magic + DDS_HEADER + DDS_HEADER_DXT10, enough to parse any header we support.
+        static constexpr size_t MaxHeaderSize = 4 + 124 + 20;
+
+        DdsFile() = delete;
+
+        // Parses the header at the start of the given bytes. Throws std::runtime_error
+        // on malformed files and on layouts we don't stream (cube maps, arrays, volumes).
+        static DdsLayout ParseHeader(std::span<const std::byte> data);
+
+        // Builds a header for the given format and mip dimensions, always using the
+        // DX10 extension. The mip offsets of the layout are filled in accordingly.
+        static std::vector<std::byte> WriteHeader(DdsLayout& layout);
+
+        // Computes the mip chain of a tightly packed texture whose data starts at dataOffset.
+        static void BuildMipChain(DdsLayout& layout, uint32_t mipCount, uint64_t dataOffset);
+    };
+}
+
+#include <D3D12Engine/Assets/DdsFile.inl>
+
+#endif // DE_ASSETS_DDSFILE_HPP
@@ -0,0 +1,20 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+namespace D3D12Engine {
+    inline uint32_t DdsLayout::GetMipCount() const {
+        return static_cast<uint32_t>(Mips.size());
+    }
+
+    inline uint64_t DdsLayout::GetTotalByteSize() const {
+        uint64_t total = 0;
+        for (const auto& mip : Mips) {
+            total += mip.ByteSize;
+        }
+
+        return total;
+    }
+}
@@ -0,0 +1,34 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef DE_ASSETS_IMAGEFILE_HPP
+#define DE_ASSETS_IMAGEFILE_HPP
+
+#include <D3D12Engine/Assets/TextureImage.hpp>
+
+#include <cstddef>
+#include <filesystem>
+#include <span>
+
+namespace D3D12Engine {
+    // Source images of the texture cooker. Only formats that can be read without a platform
+    // codec are supported, so the cooker runs anywhere.
+    class ImageFile {
+    public:
+        ImageFile() = delete;
+
+        // Picks the format from the extension: .tga or .dds. Throws std::runtime_error on
+        // unreadable or unsupported files.
+        static TextureImage Load(const std::filesystem::path& path);
+
+        // Truecolor and grayscale TGA, raw or run-length encoded.
+        static TextureImage LoadTga(std::span<const std::byte> data);
+        // Top mip of an uncompressed RGBA8 or BGRA8 DDS.
+        static TextureImage LoadDds(std::span<const std::byte> data);
+    };
+}
+
+#endif // DE_ASSETS_IMAGEFILE_HPP
@@ -0,0 +1,69 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef DE_ASSETS_MESHSIMPLIFIER_HPP
+#define DE_ASSETS_MESHSIMPLIFIER_HPP
+
+#include <D3D12Engine/RHI/VertexQuantizer.hpp>
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace D3D12Engine {
+    struct MeshSimplifierSettings {
+        // Attribute components per unit of position, positions being normalized to the
+        // mesh radius. Higher values preserve color boundaries at the expense of shape.
+        float AttributeWeight = 0.1f;
+        // Collapses whose error exceeds this, relative to the mesh radius, are never done.
+        float MaxError = 0.05f;
+        // Each LOD targets this fraction of the previous LOD's triangles.
+        float LodReduction = 0.5f;
+        uint32_t MaxLodCount = 6;
+        uint32_t MinTriangleCount = 16;
+    };
+
+    struct MeshLod {
+        // Into MeshLodChain::Indices.
+        uint32_t IndexOffset;
+        uint32_t IndexCount;
+        // Error of the LOD against the full mesh, relative to the mesh radius.
+        float Error;
+    };
+
+    // LODs only differ by their indices, they all reference the mesh's vertex buffer.
+    struct MeshLodChain {
+        std::vector<uint32_t> Indices;
+        std::vector<MeshLod> Lods;
+    };
+
+    // Offline simplification with quadric error metrics. Positions and attributes form a
+    // single vector per vertex, and the quadrics measure the squared distance to the
+    // triangles in that space (Garland and Heckbert's extension to attributes), which
+    // keeps colors from bleeding across the surface. Edges collapse onto one of their
+    // vertices, so the vertex buffer is shared by every LOD. Border vertices only slide
+    // along the border, and collapses that would flip a triangle are rejected.
+    class MeshSimplifier {
+    public:
+        // Position plus up to this many attribute components.
+        static constexpr uint32_t MaxAttributeComponents = 4;
+
+        MeshSimplifier() = delete;
+
+        // Simplifies towards targetIndexCount, stopping earlier when no collapse under the
+        // error limit remains. Returns the new indices, pError receives the error reached.
+        // Throws std::invalid_argument on indices out of range or that aren't a triangle list.
+        static std::vector<uint32_t> Simplify(const VertexAttributeStream& positions, std::span<const VertexAttributeStream> attributes,
+                                              size_t vertexCount, std::span<const uint32_t> indices, size_t targetIndexCount,
+                                              const MeshSimplifierSettings& settings = {}, float* pError = nullptr);
+
+        // LOD 0 is the mesh itself, each following LOD is simplified from the full mesh.
+        static MeshLodChain BuildLodChain(const VertexAttributeStream& positions, std::span<const VertexAttributeStream> attributes,
+                                          size_t vertexCount, std::span<const uint32_t> indices, const MeshSimplifierSettings& settings = {});
+    };
+}
+
+#endif // DE_ASSETS_MESHSIMPLIFIER_HPP
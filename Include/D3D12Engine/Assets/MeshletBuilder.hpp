@@ -0,0 +1,83 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef DE_ASSETS_MESHLETBUILDER_HPP
+#define DE_ASSETS_MESHLETBUILDER_HPP
+
+#include <D3D12Engine/RHI/VertexQuantizer.hpp>
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace D3D12Engine {
+    struct Meshlet {
+        // Into MeshletMesh::VertexIndices.
+        uint32_t VertexOffset;
+        // Into MeshletMesh::PrimitiveIndices, three entries per triangle.
+        uint32_t TriangleOffset;
+        uint32_t VertexCount;
+        uint32_t TriangleCount;
+    };
+
+    // Culling data of one meshlet. The normal cone holds every triangle normal: seen from
+    // anywhere inside the cone opposite to the axis, starting at the apex, all triangles
+    // are back facing.
+    struct MeshletBounds {
+        std::array<float, 3> Center;
+        float Radius;
+        std::array<float, 3> ConeApex;
+        std::array<float, 3> ConeAxis;
+        // Sine of the cone half angle, 1 when the triangles face too many ways to cull.
+        float ConeCutoff;
+
+        [[nodiscard]] inline bool IsBackfacing(const std::array<float, 3>& cameraPosition) const;
+        // Planes are (normal, distance) with the normals pointing inside the frustum.
+        [[nodiscard]] inline bool IsOutsideFrustum(std::span<const std::array<float, 4>> planes) const;
+    };
+
+    struct MeshletMesh {
+        std::vector<Meshlet> Meshlets;
+        std::vector<MeshletBounds> Bounds;
+        // Mesh vertex index of each meshlet vertex.
+        std::vector<uint32_t> VertexIndices;
+        // Meshlet local vertex index of each triangle corner.
+        std::vector<uint8_t> PrimitiveIndices;
+    };
+
+    struct MeshletBuilderSettings {
+        // Defaults fit mesh shader output limits with room for per-primitive data.
+        uint32_t MaxVertices = 64;
+        uint32_t MaxTriangles = 124;
+        // How much triangle orientation matters against distance when growing a meshlet.
+        // Higher values give tighter normal cones at the cost of rounder meshlets.
+        float ConeWeight = 0.25f;
+    };
+
+    // Splits an indexed triangle list into meshlets, offline. Meshlets are grown greedily:
+    // the next triangle is picked among the ones sharing a vertex with the meshlet,
+    // preferring those adding the fewest vertices, then the closest and best oriented.
+    // When none is left the closest unused triangle is found through a k-d tree over
+    // triangle centroids, so meshlets stay spatially compact.
+    class MeshletBuilder {
+    public:
+        MeshletBuilder() = delete;
+
+        // Positions need at least 3 components. Throws std::invalid_argument on limits that
+        // don't fit the 8 bit local indices or on an index count that isn't a multiple of 3.
+        static MeshletMesh Build(const VertexAttributeStream& positions, size_t vertexCount,
+                                 std::span<const uint32_t> indices, const MeshletBuilderSettings& settings = {});
+
+        // Appends the triangles of one meshlet as mesh indices, for drawing visible
+        // meshlets from a compacted index buffer where mesh shaders aren't available.
+        static void AppendIndices(const MeshletMesh& mesh, const Meshlet& meshlet, std::vector<uint32_t>& indices);
+    };
+}
+
+#include <D3D12Engine/Assets/MeshletBuilder.inl>
+
+#endif // DE_ASSETS_MESHLETBUILDER_HPP
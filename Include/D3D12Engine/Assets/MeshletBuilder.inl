@@ -0,0 +1,33 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <cmath>
+
+namespace D3D12Engine {
+    inline bool MeshletBounds::IsBackfacing(const std::array<float, 3>& cameraPosition) const {
+        // The test below would still pass at the apex, where the distance is 0.
+        if (ConeCutoff >= 1.0f) {
+            return false;
+        }
+
+        const float dx = ConeApex[0] - cameraPosition[0];
+        const float dy = ConeApex[1] - cameraPosition[1];
+        const float dz = ConeApex[2] - cameraPosition[2];
+        const float distance = std::sqrt(dx * dx + dy * dy + dz * dz);
+
+        return dx * ConeAxis[0] + dy * ConeAxis[1] + dz * ConeAxis[2] >= ConeCutoff * distance;
+    }
+
+    inline bool MeshletBounds::IsOutsideFrustum(const std::span<const std::array<float, 4>> planes) const {
+        for (const auto& plane : planes) {
+            if (plane[0] * Center[0] + plane[1] * Center[1] + plane[2] * Center[2] + plane[3] < -Radius) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+}
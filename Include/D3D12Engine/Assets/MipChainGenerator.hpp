@@ -0,0 +1,42 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef DE_ASSETS_MIPCHAINGENERATOR_HPP
+#define DE_ASSETS_MIPCHAINGENERATOR_HPP
+
+#include <D3D12Engine/Assets/TextureImage.hpp>
+
+#include <vector>
+
+namespace D3D12Engine {
+    class JobSystem;
+
+    struct MipChainSettings {
+        // The image holds sRGB encoded colors, they are filtered in linear space.
+        bool Srgb = false;
+        // RGB hold a unit vector, each mip is renormalized.
+        bool NormalMap = false;
+        // Levels to generate, the top one included. 0 generates the full chain down to 1x1.
+        uint32_t MaxMipCount = 0;
+    };
+
+    // Generates mip chains with a 2x2 box filter, widened to 3 taps along odd sized axes so
+    // every texel contributes. Each level is filtered from the unrounded previous level, in
+    // linear space, with colors weighted by their alpha so transparent texels don't bleed
+    // into their neighbours.
+    class MipChainGenerator {
+    public:
+        MipChainGenerator() = delete;
+
+        // Returns the levels from the top one, which is a copy of the image.
+        static std::vector<TextureImage> Generate(const TextureImage& image, const MipChainSettings& settings = {},
+                                                  JobSystem* pJobSystem = nullptr);
+
+        [[nodiscard]] static uint32_t GetFullMipCount(uint32_t width, uint32_t height);
+    };
+}
+
+#endif // DE_ASSETS_MIPCHAINGENERATOR_HPP
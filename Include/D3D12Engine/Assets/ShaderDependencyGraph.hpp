@@ -0,0 +1,70 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef DE_ASSETS_SHADERDEPENDENCYGRAPH_HPP
+#define DE_ASSETS_SHADERDEPENDENCYGRAPH_HPP
+
+#include <filesystem>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace D3D12Engine {
+    // Which shader source files include which, to find the programs to recompile when
+    // a file changes. Programs are the files compiled directly, everything else is only
+    // reached through includes. Include cycles are allowed, the compiler rejects them.
+    class ShaderDependencyGraph {
+    public:
+        ShaderDependencyGraph() = default;
+        ~ShaderDependencyGraph() = default;
+
+        ShaderDependencyGraph(const ShaderDependencyGraph&) = delete;
+        ShaderDependencyGraph(ShaderDependencyGraph&&) = delete;
+
+        // Names of the #include directives of a source, in order. Comments are skipped but
+        // conditional compilation isn't evaluated, a file may be reported that is never included.
+        [[nodiscard]] static std::vector<std::string> FindIncludes(std::string_view source);
+        // Includes are relative to the including file, as with D3D_COMPILE_STANDARD_FILE_INCLUDE.
+        [[nodiscard]] static std::filesystem::path ResolveInclude(const std::filesystem::path& includingFile, std::string_view name);
+        // Form paths are stored and returned in, two spellings of the same file compare equal once normalized.
+        [[nodiscard]] static std::filesystem::path Normalize(const std::filesystem::path& path);
+
+        void AddProgram(const std::filesystem::path& program);
+        // Replaces the files the given one includes directly.
+        void SetIncludes(const std::filesystem::path& file, std::span<const std::filesystem::path> includes);
+
+        // Programs that are one of the changed files or include one, directly or not.
+        [[nodiscard]] std::vector<std::filesystem::path> GetAffectedPrograms(std::span<const std::filesystem::path> changedFiles) const;
+
+        [[nodiscard]] inline bool Contains(const std::filesystem::path& file) const;
+        [[nodiscard]] inline size_t GetFileCount() const;
+
+        ShaderDependencyGraph& operator=(const ShaderDependencyGraph&) = delete;
+        ShaderDependencyGraph& operator=(ShaderDependencyGraph&&) = delete;
+
+    private:
+        static constexpr uint32_t NotFound = ~0u;
+
+        struct Node {
+            std::filesystem::path Path;
+            std::vector<uint32_t> Includes;
+            std::vector<uint32_t> IncludedBy;
+            bool IsProgram = false;
+        };
+
+        [[nodiscard]] uint32_t Find(const std::filesystem::path& path) const;
+        uint32_t GetOrAddNode(const std::filesystem::path& path);
+
+        std::unordered_map<std::filesystem::path::string_type, uint32_t> m_Indices;
+        std::vector<Node> m_Nodes;
+    };
+}
+
+#include <D3D12Engine/Assets/ShaderDependencyGraph.inl>
+
+#endif // DE_ASSETS_SHADERDEPENDENCYGRAPH_HPP
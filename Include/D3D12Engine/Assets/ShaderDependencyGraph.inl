@@ -0,0 +1,15 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+namespace D3D12Engine {
+    inline bool ShaderDependencyGraph::Contains(const std::filesystem::path& file) const {
+        return Find(file) != NotFound;
+    }
+
+    inline size_t ShaderDependencyGraph::GetFileCount() const {
+        return m_Nodes.size();
+    }
+}
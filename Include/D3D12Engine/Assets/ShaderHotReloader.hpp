@@ -0,0 +1,57 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef DE_ASSETS_SHADERHOTRELOADER_HPP
+#define DE_ASSETS_SHADERHOTRELOADER_HPP
+
+#include <D3D12Engine/Assets/ShaderDependencyGraph.hpp>
+#include <D3D12Engine/Core/FileWatcher.hpp>
+
+namespace D3D12Engine {
+    struct ShaderHotReloaderSettings {
+        // How often the files are checked, a change is seen after at most two checks.
+        double PollIntervalSeconds = 0.25;
+    };
+
+    // Watches shader programs and the files they include, and tells which programs to
+    // recompile when some of them change. Compiling and swapping the pipeline states is
+    // left to the caller, the programs are only reported once per change.
+    class ShaderHotReloader {
+    public:
+        explicit ShaderHotReloader(const ShaderHotReloaderSettings& settings = {});
+        ~ShaderHotReloader() = default;
+
+        ShaderHotReloader(const ShaderHotReloader&) = delete;
+        ShaderHotReloader(ShaderHotReloader&&) = delete;
+
+        // Watches the program and every file it includes.
+        void AddProgram(const std::filesystem::path& program);
+
+        // Programs to recompile since the last call, in normalized form. Only looks at the
+        // files once per poll interval. Times are in seconds from any monotonic clock.
+        std::span<const std::filesystem::path> Poll(double time);
+
+        [[nodiscard]] inline const ShaderDependencyGraph& GetDependencies() const;
+
+        ShaderHotReloader& operator=(const ShaderHotReloader&) = delete;
+        ShaderHotReloader& operator=(ShaderHotReloader&&) = delete;
+
+    private:
+        // Updates the includes of the file and watches those seen for the first time.
+        void ScanIncludes(const std::filesystem::path& file);
+
+        ShaderHotReloaderSettings m_Settings;
+        FileWatcher m_Watcher;
+        ShaderDependencyGraph m_Dependencies;
+        std::vector<std::filesystem::path> m_ChangedFiles;
+        std::vector<std::filesystem::path> m_ChangedPrograms;
+        double m_LastPollTime;
+    };
+}
+
+#include <D3D12Engine/Assets/ShaderHotReloader.inl>
+
+#endif // DE_ASSETS_SHADERHOTRELOADER_HPP
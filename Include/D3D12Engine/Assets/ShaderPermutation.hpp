@@ -0,0 +1,118 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef DE_ASSETS_SHADERPERMUTATION_HPP
+#define DE_ASSETS_SHADERPERMUTATION_HPP
+
+#include <compare>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace D3D12Engine {
+    // Identifies a variant of a shader program: one bit per feature, in the order the
+    // program declares them.
+    struct ShaderPermutationKey {
+        uint32_t Bits = 0;
+
+        auto operator<=>(const ShaderPermutationKey&) const = default;
+    };
+
+    struct ShaderFeature {
+        // Defined to 1 in the variants that have the feature.
+        std::string Define;
+        // Features this one can't go without, as bits of the same program. Keys with the
+        // feature get them too.
+        uint32_t Requires = 0;
+    };
+
+    struct ShaderDefine {
+        std::string Name;
+        std::string Value;
+    };
+
+    // Features a shader program can be compiled with. Materials refer to a variant by a key,
+    // built from define names once when they are loaded, and only the variants some content
+    // refers to are ever compiled.
+    class ShaderPermutationSpace {
+    public:
+        static constexpr uint32_t MaxFeatureCount = 32;
+
+        ShaderPermutationSpace() = default;
+        // Throws if there are too many features, duplicate defines or requirements on
+        // features that don't exist.
+        explicit ShaderPermutationSpace(std::vector<ShaderFeature> features);
+        ~ShaderPermutationSpace() = default;
+
+        ShaderPermutationSpace(const ShaderPermutationSpace&) = default;
+        ShaderPermutationSpace(ShaderPermutationSpace&&) = default;
+
+        // Throws if a define isn't one of the features.
+        [[nodiscard]] ShaderPermutationKey MakeKey(std::span<const std::string_view> defines) const;
+        // Adds the required features, directly or not. Throws on bits past the features.
+        [[nodiscard]] ShaderPermutationKey Normalize(ShaderPermutationKey key) const;
+        [[nodiscard]] std::vector<ShaderDefine> GetDefines(ShaderPermutationKey key) const;
+
+        // Variants to compile for the keys content refers to: normalized, without duplicates,
+        // sorted. Variants nothing refers to are unreachable.
+        [[nodiscard]] std::vector<ShaderPermutationKey> GetReachableKeys(std::span<const ShaderPermutationKey> referencedKeys) const;
+
+        [[nodiscard]] inline uint32_t GetFeatureCount() const;
+        [[nodiscard]] inline const ShaderFeature& GetFeature(uint32_t index) const;
+        // Number of variants if every combination was compiled.
+        [[nodiscard]] inline uint64_t GetPermutationCount() const;
+
+        ShaderPermutationSpace& operator=(const ShaderPermutationSpace&) = default;
+        ShaderPermutationSpace& operator=(ShaderPermutationSpace&&) = default;
+
+    private:
+        std::vector<ShaderFeature> m_Features;
+        // Per feature, the feature and everything it requires, directly or not.
+        std::vector<uint32_t> m_Closures;
+        uint32_t m_ValidBits = 0;
+    };
+
+    // Compiled variants of a program, looked up by key with a binary search over the sorted
+    // keys. Keys must be normalized, which is done once when content is loaded, so lookups
+    // only compare integers.
+    template <typename T>
+    class ShaderVariantTable {
+    public:
+        ShaderVariantTable() = default;
+        ~ShaderVariantTable() = default;
+
+        ShaderVariantTable(const ShaderVariantTable&) = default;
+        ShaderVariantTable(ShaderVariantTable&&) = default;
+
+        // Replaces the variant if the key is already there.
+        void Insert(ShaderPermutationKey key, T value);
+
+        // Null if the variant wasn't compiled.
+        [[nodiscard]] T* Find(ShaderPermutationKey key);
+        [[nodiscard]] const T* Find(ShaderPermutationKey key) const;
+
+        [[nodiscard]] inline std::span<const ShaderPermutationKey> GetKeys() const;
+        [[nodiscard]] inline std::span<T> GetVariants();
+        [[nodiscard]] inline std::span<const T> GetVariants() const;
+        [[nodiscard]] inline size_t GetSize() const;
+
+        ShaderVariantTable& operator=(const ShaderVariantTable&) = default;
+        ShaderVariantTable& operator=(ShaderVariantTable&&) = default;
+
+    private:
+        [[nodiscard]] size_t LowerBound(ShaderPermutationKey key) const;
+
+        // Kept apart so the search only touches the keys.
+        std::vector<ShaderPermutationKey> m_Keys;
+        std::vector<T> m_Variants;
+    };
+}
+
+#include <D3D12Engine/Assets/ShaderPermutation.inl>
+
+#endif // DE_ASSETS_SHADERPERMUTATION_HPP
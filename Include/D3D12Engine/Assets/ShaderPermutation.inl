@@ -0,0 +1,71 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <algorithm>
+#include <iterator>
+
+namespace D3D12Engine {
+    inline uint32_t ShaderPermutationSpace::GetFeatureCount() const {
+        return static_cast<uint32_t>(m_Features.size());
+    }
+
+    inline const ShaderFeature& ShaderPermutationSpace::GetFeature(const uint32_t index) const {
+        return m_Features[index];
+    }
+
+    inline uint64_t ShaderPermutationSpace::GetPermutationCount() const {
+        return uint64_t{1} << m_Features.size();
+    }
+
+    template <typename T>
+    void ShaderVariantTable<T>::Insert(const ShaderPermutationKey key, T value) {
+        const size_t index = LowerBound(key);
+        if (index < m_Keys.size() && m_Keys[index] == key) {
+            m_Variants[index] = std::move(value);
+            return;
+        }
+
+        m_Keys.insert(m_Keys.begin() + static_cast<std::ptrdiff_t>(index), key);
+        m_Variants.insert(m_Variants.begin() + static_cast<std::ptrdiff_t>(index), std::move(value));
+    }
+
+    template <typename T>
+    T* ShaderVariantTable<T>::Find(const ShaderPermutationKey key) {
+        const size_t index = LowerBound(key);
+        return index < m_Keys.size() && m_Keys[index] == key ? &m_Variants[index] : nullptr;
+    }
+
+    template <typename T>
+    const T* ShaderVariantTable<T>::Find(const ShaderPermutationKey key) const {
+        const size_t index = LowerBound(key);
+        return index < m_Keys.size() && m_Keys[index] == key ? &m_Variants[index] : nullptr;
+    }
+
+    template <typename T>
+    inline std::span<const ShaderPermutationKey> ShaderVariantTable<T>::GetKeys() const {
+        return m_Keys;
+    }
+
+    template <typename T>
+    inline std::span<T> ShaderVariantTable<T>::GetVariants() {
+        return m_Variants;
+    }
+
+    template <typename T>
+    inline std::span<const T> ShaderVariantTable<T>::GetVariants() const {
+        return m_Variants;
+    }
+
+    template <typename T>
+    inline size_t ShaderVariantTable<T>::GetSize() const {
+        return m_Keys.size();
+    }
+
+    template <typename T>
+    size_t ShaderVariantTable<T>::LowerBound(const ShaderPermutationKey key) const {
+        return static_cast<size_t>(std::distance(m_Keys.begin(), std::ranges::lower_bound(m_Keys, key)));
+    }
+}
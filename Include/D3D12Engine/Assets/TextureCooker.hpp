@@ -0,0 +1,56 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef DE_ASSETS_TEXTURECOOKER_HPP
+#define DE_ASSETS_TEXTURECOOKER_HPP
+
+#include <D3D12Engine/Assets/DdsFile.hpp>
+#include <D3D12Engine/Assets/TextureImage.hpp>
+
+#include <cstddef>
+#include <filesystem>
+#include <vector>
+
+namespace D3D12Engine {
+    class JobSystem;
+
+    struct TextureCookSettings {
+        // BC1, BC5 or BC7. sRGB formats filter the mips in linear space.
+        TextureFormat Format = TextureFormat::BC7UnormSrgb;
+        bool GenerateMips = true;
+        // RGB hold a tangent space normal, mips are renormalized. Goes with BC5.
+        bool NormalMap = false;
+    };
+
+    struct CookedTexture {
+        // Mip offsets are relative to the start of the DDS file.
+        DdsLayout Layout;
+        // Uncompressed levels the blocks were encoded from.
+        std::vector<TextureImage> SourceMips;
+        // Compressed levels, tightly packed from the top one.
+        std::vector<std::byte> Data;
+    };
+
+    // Offline texture pipeline: generates the mips of an image and block compresses them
+    // into a DDS the streamer can read level by level.
+    class TextureCooker {
+    public:
+        TextureCooker() = delete;
+
+        // Throws std::invalid_argument for formats the block compressor doesn't encode.
+        static CookedTexture Cook(const TextureImage& image, const TextureCookSettings& settings, JobSystem* pJobSystem = nullptr);
+
+        static std::vector<std::byte> WriteDds(const CookedTexture& texture);
+        // Throws std::runtime_error if the file can't be written.
+        static void WriteDds(const CookedTexture& texture, const std::filesystem::path& path);
+
+        // Peak signal to noise ratio in dB over the first channelCount channels, infinite
+        // for identical images.
+        [[nodiscard]] static double ComputePsnr(const TextureImage& reference, const TextureImage& image, uint32_t channelCount);
+    };
+}
+
+#endif // DE_ASSETS_TEXTURECOOKER_HPP
@@ -0,0 +1,130 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef DE_ASSETS_TEXTUREFORMAT_HPP
+#define DE_ASSETS_TEXTUREFORMAT_HPP
+
+#include <cstdint>
+
+namespace D3D12Engine {
+    // Subset of DXGI_FORMAT we know how to lay out. The values match DXGI_FORMAT so
+    // the enum can be static_cast straight into resource descriptions, while still
+    // being usable by the asset code that doesn't include any Windows header.
+    enum class TextureFormat : uint32_t {
+        Unknown = 0,
+        R32G32B32A32Float = 2,
+        R16G16B16A16Float = 10,
+        R8G8B8A8Unorm = 28,
+        R8G8B8A8UnormSrgb = 29,
+        R8G8Unorm = 49,
+        R8Unorm = 61,
+        BC1Unorm = 71,
+        BC1UnormSrgb = 72,
+        BC2Unorm = 74,
+        BC2UnormSrgb = 75,
+        BC3Unorm = 77,
+        BC3UnormSrgb = 78,
+        BC4Unorm = 80,
+        BC4Snorm = 81,
+        BC5Unorm = 83,
+        BC5Snorm = 84,
+        B8G8R8A8Unorm = 87,
+        B8G8R8A8UnormSrgb = 91,
+        BC6HUf16 = 95,
+        BC6HSf16 = 96,
+        BC7Unorm = 98,
+        BC7UnormSrgb = 99
+    };
+
+    constexpr bool IsBlockCompressed(const TextureFormat format) {
+        switch (format) {
+        case TextureFormat::BC1Unorm:
+        case TextureFormat::BC1UnormSrgb:
+        case TextureFormat::BC2Unorm:
+        case TextureFormat::BC2UnormSrgb:
+        case TextureFormat::BC3Unorm:
+        case TextureFormat::BC3UnormSrgb:
+        case TextureFormat::BC4Unorm:
+        case TextureFormat::BC4Snorm:
+        case TextureFormat::BC5Unorm:
+        case TextureFormat::BC5Snorm:
+        case TextureFormat::BC6HUf16:
+        case TextureFormat::BC6HSf16:
+        case TextureFormat::BC7Unorm:
+        case TextureFormat::BC7UnormSrgb:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    constexpr bool IsSrgbFormat(const TextureFormat format) {
+        switch (format) {
+        case TextureFormat::R8G8B8A8UnormSrgb:
+        case TextureFormat::B8G8R8A8UnormSrgb:
+        case TextureFormat::BC1UnormSrgb:
+        case TextureFormat::BC2UnormSrgb:
+        case TextureFormat::BC3UnormSrgb:
+        case TextureFormat::BC7UnormSrgb:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    // Bytes per 4x4 block for block compressed formats, bytes per pixel otherwise.
+    // Returns 0 for formats we don't support.
+    constexpr uint32_t GetFormatElementSize(const TextureFormat format) {
+        switch (format) {
+        case TextureFormat::BC1Unorm:
+        case TextureFormat::BC1UnormSrgb:
+        case TextureFormat::BC4Unorm:
+        case TextureFormat::BC4Snorm:
+            return 8;
+        case TextureFormat::BC2Unorm:
+        case TextureFormat::BC2UnormSrgb:
+        case TextureFormat::BC3Unorm:
+        case TextureFormat::BC3UnormSrgb:
+        case TextureFormat::BC5Unorm:
+        case TextureFormat::BC5Snorm:
+        case TextureFormat::BC6HUf16:
+        case TextureFormat::BC6HSf16:
+        case TextureFormat::BC7Unorm:
+        case TextureFormat::BC7UnormSrgb:
+            return 16;
+        case TextureFormat::R32G32B32A32Float:
+            return 16;
+        case TextureFormat::R16G16B16A16Float:
+            return 8;
+        case TextureFormat::R8G8B8A8Unorm:
+        case TextureFormat::R8G8B8A8UnormSrgb:
+        case TextureFormat::B8G8R8A8Unorm:
+        case TextureFormat::B8G8R8A8UnormSrgb:
+            return 4;
+        case TextureFormat::R8G8Unorm:
+            return 2;
+        case TextureFormat::R8Unorm:
+            return 1;
+        default:
+            return 0;
+        }
+    }
+
+    // Size in bytes of one tightly packed mip level.
+    constexpr uint64_t GetSurfaceByteSize(const TextureFormat format, const uint32_t width, const uint32_t height) {
+        const uint64_t elementSize = GetFormatElementSize(format);
+
+        if (IsBlockCompressed(format)) {
+            const uint64_t blocksWide = (static_cast<uint64_t>(width) + 3) / 4;
+            const uint64_t blocksHigh = (static_cast<uint64_t>(height) + 3) / 4;
+            return (blocksWide > 0 ? blocksWide : 1) * (blocksHigh > 0 ? blocksHigh : 1) * elementSize;
+        }
+
+        return static_cast<uint64_t>(width) * height * elementSize;
+    }
+}
+
+#endif // DE_ASSETS_TEXTUREFORMAT_HPP
@@ -0,0 +1,22 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef DE_ASSETS_TEXTUREIMAGE_HPP
+#define DE_ASSETS_TEXTUREIMAGE_HPP
+
+#include <cstdint>
+#include <vector>
+
+namespace D3D12Engine {
+    // Uncompressed image the texture tools work on, 8 bit RGBA with rows tightly packed.
+    struct TextureImage {
+        uint32_t Width = 0;
+        uint32_t Height = 0;
+        std::vector<uint8_t> Pixels;
+    };
+}
+
+#endif // DE_ASSETS_TEXTUREIMAGE_HPP
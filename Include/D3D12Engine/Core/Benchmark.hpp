@@ -0,0 +1,80 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef DE_CORE_BENCHMARK_HPP
+#define DE_CORE_BENCHMARK_HPP
+
+#include <D3D12Engine/Core/FrameStatistics.hpp>
+
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+namespace D3D12Engine {
+    struct BenchmarkSettings {
+        // Frames measured after the warmup.
+        uint32_t FrameCount = 1000;
+        // Frames rendered before measuring, so caches, pipelines and clocks have settled.
+        uint32_t WarmupFrameCount = 60;
+        // Simulation time each frame advances by, the scene is the same on every run.
+        double StepSeconds = 1.0 / 60.0;
+        std::filesystem::path ReportPath = "benchmark.json";
+
+        // Settings from the command line arguments, none without --benchmark. Also reads
+        // --benchmark-frames=N, --benchmark-warmup=N and --benchmark-report=path.
+        [[nodiscard]] static std::optional<BenchmarkSettings> Parse(std::span<const std::wstring_view> arguments);
+    };
+
+    // What the numbers of a report were measured on.
+    struct BenchmarkEnvironment {
+        std::string Build;
+        std::string Adapter;
+        uint32_t Width = 0;
+        uint32_t Height = 0;
+    };
+
+    // Collects the frames of a benchmark run and writes their distribution as JSON, to
+    // compare builds against each other.
+    class BenchmarkRun {
+    public:
+        explicit BenchmarkRun(const BenchmarkSettings& settings);
+        ~BenchmarkRun() = default;
+
+        BenchmarkRun(const BenchmarkRun&) = delete;
+        BenchmarkRun(BenchmarkRun&&) = delete;
+
+        // Records the frame once the warmup is over, frames after the end are ignored.
+        void AddFrame(const FrameSample& sample);
+
+        void WriteReport(std::ostream& stream, const BenchmarkEnvironment& environment) const;
+        // Throws if the file can't be written.
+        void WriteReport(const std::filesystem::path& path, const BenchmarkEnvironment& environment) const;
+
+        [[nodiscard]] inline bool IsFinished() const;
+        // Frames added so far, warmup included.
+        [[nodiscard]] inline uint32_t GetFrameIndex() const;
+        // Simulation time of the next frame.
+        [[nodiscard]] inline double GetSimulationTime() const;
+        [[nodiscard]] inline const BenchmarkSettings& GetSettings() const;
+        [[nodiscard]] inline const FrameStatistics& GetStatistics() const;
+
+        BenchmarkRun& operator=(const BenchmarkRun&) = delete;
+        BenchmarkRun& operator=(BenchmarkRun&&) = delete;
+
+    private:
+        BenchmarkSettings m_Settings;
+        FrameStatistics m_Statistics;
+        uint32_t m_FrameIndex;
+        uint64_t m_FinalMemory;
+    };
+}
+
+#include <D3D12Engine/Core/Benchmark.inl>
+
+#endif // DE_CORE_BENCHMARK_HPP
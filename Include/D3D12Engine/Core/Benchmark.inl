@@ -0,0 +1,27 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+namespace D3D12Engine {
+    inline bool BenchmarkRun::IsFinished() const {
+        return m_FrameIndex >= m_Settings.WarmupFrameCount + m_Settings.FrameCount;
+    }
+
+    inline uint32_t BenchmarkRun::GetFrameIndex() const {
+        return m_FrameIndex;
+    }
+
+    inline double BenchmarkRun::GetSimulationTime() const {
+        return static_cast<double>(m_FrameIndex) * m_Settings.StepSeconds;
+    }
+
+    inline const BenchmarkSettings& BenchmarkRun::GetSettings() const {
+        return m_Settings;
+    }
+
+    inline const FrameStatistics& BenchmarkRun::GetStatistics() const {
+        return m_Statistics;
+    }
+}
@@ -0,0 +1,63 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef DE_CORE_BOUNDEDQUEUE_HPP
+#define DE_CORE_BOUNDEDQUEUE_HPP
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace D3D12Engine {
+    // Blocking multi-producer/multi-consumer priority queue with a fixed capacity.
+    // Push() blocks while the queue is full, which is what gives a pipeline its
+    // back-pressure. A capacity of 0 means unbounded. Once closed, Push() fails
+    // and Pop() drains what is left before returning std::nullopt.
+    template <typename T, typename Compare = std::less<T>>
+    class BoundedQueue {
+    public:
+        explicit BoundedQueue(size_t capacity, Compare compare = Compare());
+        ~BoundedQueue() = default;
+
+        BoundedQueue(const BoundedQueue&) = delete;
+        BoundedQueue(BoundedQueue&&) = delete;
+
+        bool Push(T value);
+        bool TryPush(T value);
+        std::optional<T> Pop();
+        std::optional<T> TryPop();
+
+        void Close();
+        // Removes everything queued at once, to drop pending work on shutdown.
+        std::vector<T> TakeAll();
+
+        [[nodiscard]] size_t GetSize() const;
+        [[nodiscard]] inline size_t GetCapacity() const;
+
+        BoundedQueue& operator=(const BoundedQueue&) = delete;
+        BoundedQueue& operator=(BoundedQueue&&) = delete;
+
+    private:
+        [[nodiscard]] inline bool IsFull() const;
+
+        mutable std::mutex m_Mutex;
+        std::condition_variable m_NotEmpty;
+        std::condition_variable m_NotFull;
+        // Heap ordered by m_Compare, the next item to pop is at the front.
+        std::vector<T> m_Items;
+        Compare m_Compare;
+        size_t m_Capacity;
+        bool m_Closed = false;
+    };
+}
+
+#include <D3D12Engine/Core/BoundedQueue.inl>
+
+#endif // DE_CORE_BOUNDEDQUEUE_HPP
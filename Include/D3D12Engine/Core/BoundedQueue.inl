@@ -0,0 +1,124 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+namespace D3D12Engine {
+    template <typename T, typename Compare>
+    BoundedQueue<T, Compare>::BoundedQueue(const size_t capacity, Compare compare)
+        : m_Compare(std::move(compare)),
+          m_Capacity(capacity) {
+    }
+
+    template <typename T, typename Compare>
+    bool BoundedQueue<T, Compare>::Push(T value) {
+        {
+            std::unique_lock lock(m_Mutex);
+            m_NotFull.wait(lock, [this] { return m_Closed || !IsFull(); });
+
+            if (m_Closed) {
+                return false;
+            }
+
+            m_Items.push_back(std::move(value));
+            std::ranges::push_heap(m_Items, m_Compare);
+        }
+
+        m_NotEmpty.notify_one();
+        return true;
+    }
+
+    template <typename T, typename Compare>
+    bool BoundedQueue<T, Compare>::TryPush(T value) {
+        {
+            std::lock_guard lock(m_Mutex);
+            if (m_Closed || IsFull()) {
+                return false;
+            }
+
+            m_Items.push_back(std::move(value));
+            std::ranges::push_heap(m_Items, m_Compare);
+        }
+
+        m_NotEmpty.notify_one();
+        return true;
+    }
+
+    template <typename T, typename Compare>
+    std::optional<T> BoundedQueue<T, Compare>::Pop() {
+        std::optional<T> value;
+        {
+            std::unique_lock lock(m_Mutex);
+            m_NotEmpty.wait(lock, [this] { return m_Closed || !m_Items.empty(); });
+
+            if (m_Items.empty()) {
+                return std::nullopt;
+            }
+
+            std::ranges::pop_heap(m_Items, m_Compare);
+            value.emplace(std::move(m_Items.back()));
+            m_Items.pop_back();
+        }
+
+        m_NotFull.notify_one();
+        return value;
+    }
+
+    template <typename T, typename Compare>
+    std::optional<T> BoundedQueue<T, Compare>::TryPop() {
+        std::optional<T> value;
+        {
+            std::lock_guard lock(m_Mutex);
+            if (m_Items.empty()) {
+                return std::nullopt;
+            }
+
+            std::ranges::pop_heap(m_Items, m_Compare);
+            value.emplace(std::move(m_Items.back()));
+            m_Items.pop_back();
+        }
+
+        m_NotFull.notify_one();
+        return value;
+    }
+
+    template <typename T, typename Compare>
+    void BoundedQueue<T, Compare>::Close() {
+        {
+            std::lock_guard lock(m_Mutex);
+            m_Closed = true;
+        }
+
+        m_NotEmpty.notify_all();
+        m_NotFull.notify_all();
+    }
+
+    template <typename T, typename Compare>
+    std::vector<T> BoundedQueue<T, Compare>::TakeAll() {
+        std::vector<T> items;
+        {
+            std::lock_guard lock(m_Mutex);
+            items.swap(m_Items);
+        }
+
+        m_NotFull.notify_all();
+        return items;
+    }
+
+    template <typename T, typename Compare>
+    size_t BoundedQueue<T, Compare>::GetSize() const {
+        std::lock_guard lock(m_Mutex);
+        return m_Items.size();
+    }
+
+    template <typename T, typename Compare>
+    inline size_t BoundedQueue<T, Compare>::GetCapacity() const {
+        return m_Capacity;
+    }
+
+    template <typename T, typename Compare>
+    inline bool BoundedQueue<T, Compare>::IsFull() const {
+        return m_Capacity != 0 && m_Items.size() >= m_Capacity;
+    }
+}
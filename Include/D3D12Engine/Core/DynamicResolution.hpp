@@ -0,0 +1,78 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef DE_CORE_DYNAMICRESOLUTION_HPP
+#define DE_CORE_DYNAMICRESOLUTION_HPP
+
+#include <cstdint>
+
+namespace D3D12Engine {
+    struct DynamicResolutionSettings {
+        // GPU time we want a frame to take, leave some headroom below the refresh interval.
+        double TargetFrameTimeMs = 14.0;
+        // Bounds of the per-axis resolution scale.
+        float MinScale = 0.5f;
+        float MaxScale = 1.0f;
+        // Gains of the incremental PID, applied to the error relative to the target.
+        float ProportionalGain = 0.25f;
+        float IntegralGain = 0.15f;
+        float DerivativeGain = 0.05f;
+        // Relative errors smaller than this are ignored so the scale settles instead of dithering.
+        float Deadband = 0.05f;
+        // Weight of the newest sample in the exponential average of the measured frame time.
+        float SmoothingFactor = 0.3f;
+        // Largest change of the rendered area allowed in one frame.
+        float MaxAreaStep = 0.1f;
+        // Render sizes are rounded to multiples of this.
+        uint32_t SizeGranularity = 8;
+    };
+
+    struct RenderSize {
+        uint32_t Width;
+        uint32_t Height;
+    };
+
+    // Chooses the resolution the scene is rendered at from the measured GPU frame time.
+    // GPU cost is roughly proportional to the number of shaded pixels, so the controller
+    // works on the rendered area (scale squared). It uses the incremental form of a PID,
+    // which needs no integral clamping: saturating the output simply stops accumulating.
+    // The input is smoothed and a deadband around the target keeps the output steady.
+    class DynamicResolutionController {
+    public:
+        explicit DynamicResolutionController(const DynamicResolutionSettings& settings = {});
+        ~DynamicResolutionController() = default;
+
+        DynamicResolutionController(const DynamicResolutionController&) = default;
+        DynamicResolutionController(DynamicResolutionController&&) = default;
+
+        // Feeds one GPU frame time measurement and returns the new per-axis scale.
+        float Update(double gpuFrameTimeMs);
+        void Reset();
+
+        [[nodiscard]] inline float GetScale() const;
+        [[nodiscard]] inline double GetFilteredFrameTimeMs() const;
+        [[nodiscard]] inline const DynamicResolutionSettings& GetSettings() const;
+        inline void SetTargetFrameTimeMs(double targetMs);
+
+        // Size to render at for an output of the given size with the current scale.
+        [[nodiscard]] RenderSize ComputeRenderSize(uint32_t outputWidth, uint32_t outputHeight) const;
+
+        DynamicResolutionController& operator=(const DynamicResolutionController&) = default;
+        DynamicResolutionController& operator=(DynamicResolutionController&&) = default;
+
+    private:
+        DynamicResolutionSettings m_Settings;
+        float m_Area;
+        float m_PreviousError = 0.0f;
+        float m_PreviousPreviousError = 0.0f;
+        double m_FilteredFrameTimeMs = 0.0;
+        bool m_HasSample = false;
+    };
+}
+
+#include <D3D12Engine/Core/DynamicResolution.inl>
+
+#endif // DE_CORE_DYNAMICRESOLUTION_HPP
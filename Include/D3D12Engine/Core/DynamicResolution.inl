@@ -0,0 +1,25 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <cmath>
+
+namespace D3D12Engine {
+    inline float DynamicResolutionController::GetScale() const {
+        return std::sqrt(m_Area);
+    }
+
+    inline double DynamicResolutionController::GetFilteredFrameTimeMs() const {
+        return m_FilteredFrameTimeMs;
+    }
+
+    inline const DynamicResolutionSettings& DynamicResolutionController::GetSettings() const {
+        return m_Settings;
+    }
+
+    inline void DynamicResolutionController::SetTargetFrameTimeMs(const double targetMs) {
+        m_Settings.TargetFrameTimeMs = targetMs;
+    }
+}
@@ -0,0 +1,66 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef DE_CORE_FILEWATCHER_HPP
+#define DE_CORE_FILEWATCHER_HPP
+
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+namespace D3D12Engine {
+    // Detects changes to a set of files by polling their write time and size, which works
+    // the same on every platform and costs one stat per file and poll. Editors often save
+    // in several steps, so a change is only reported once the file stopped changing for
+    // one poll, the caller decides how often that is.
+    class FileWatcher {
+    public:
+        FileWatcher() = default;
+        ~FileWatcher() = default;
+
+        FileWatcher(const FileWatcher&) = delete;
+        FileWatcher(FileWatcher&&) = delete;
+
+        // Files that don't exist yet are watched for their creation. Watching a file twice has no effect.
+        void Watch(const std::filesystem::path& path);
+        void Unwatch(const std::filesystem::path& path);
+
+        // Appends the files that were modified, created or removed since they were last reported.
+        void Poll(std::vector<std::filesystem::path>& changedFiles);
+
+        [[nodiscard]] inline bool IsWatching(const std::filesystem::path& path) const;
+        [[nodiscard]] inline size_t GetWatchCount() const;
+
+        FileWatcher& operator=(const FileWatcher&) = delete;
+        FileWatcher& operator=(FileWatcher&&) = delete;
+
+    private:
+        struct FileStamp {
+            std::filesystem::file_time_type WriteTime;
+            uintmax_t Size = 0;
+            bool Exists = false;
+
+            bool operator==(const FileStamp&) const = default;
+        };
+
+        struct WatchedFile {
+            std::filesystem::path Path;
+            // Last reported state, and the one seen by the previous poll when it differs.
+            FileStamp Stamp;
+            FileStamp PendingStamp;
+            bool HasPending = false;
+        };
+
+        [[nodiscard]] static FileStamp GetStamp(const std::filesystem::path& path);
+        [[nodiscard]] inline std::vector<WatchedFile>::const_iterator Find(const std::filesystem::path& path) const;
+
+        std::vector<WatchedFile> m_Files;
+    };
+}
+
+#include <D3D12Engine/Core/FileWatcher.inl>
+
+#endif // DE_CORE_FILEWATCHER_HPP
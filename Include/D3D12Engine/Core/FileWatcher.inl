@@ -0,0 +1,21 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <algorithm>
+
+namespace D3D12Engine {
+    inline bool FileWatcher::IsWatching(const std::filesystem::path& path) const {
+        return Find(path) != m_Files.end();
+    }
+
+    inline size_t FileWatcher::GetWatchCount() const {
+        return m_Files.size();
+    }
+
+    inline std::vector<FileWatcher::WatchedFile>::const_iterator FileWatcher::Find(const std::filesystem::path& path) const {
+        return std::ranges::find(m_Files, path, &WatchedFile::Path);
+    }
+}
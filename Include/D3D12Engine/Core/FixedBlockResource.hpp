@@ -0,0 +1,62 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef DE_CORE_FIXEDBLOCKRESOURCE_HPP
+#define DE_CORE_FIXEDBLOCKRESOURCE_HPP
+
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
+
+namespace D3D12Engine {
+    // Pool of same-sized blocks carved from larger chunks, with freed blocks kept on an
+    // intrusive free list. Allocations that don't fit a block go to the upstream resource.
+    // Suits node based pmr containers. Not thread safe.
+    class FixedBlockResource final : public std::pmr::memory_resource {
+    public:
+        FixedBlockResource(size_t blockSize, size_t blockAlignment, size_t blocksPerChunk = 64,
+                           std::pmr::memory_resource* pUpstream = std::pmr::get_default_resource());
+        ~FixedBlockResource() override;
+
+        FixedBlockResource(const FixedBlockResource&) = delete;
+        FixedBlockResource(FixedBlockResource&&) = delete;
+
+        // Makes sure blockCount blocks can be allocated without going upstream.
+        void Reserve(size_t blockCount);
+
+        [[nodiscard]] inline size_t GetBlockSize() const;
+        [[nodiscard]] inline size_t GetBlockCount() const;
+        [[nodiscard]] inline size_t GetFreeBlockCount() const;
+
+        FixedBlockResource& operator=(const FixedBlockResource&) = delete;
+        FixedBlockResource& operator=(FixedBlockResource&&) = delete;
+
+    protected:
+        void* do_allocate(size_t bytes, size_t alignment) override;
+        void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+        [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+    private:
+        struct FreeBlock {
+            FreeBlock* Next;
+        };
+
+        void AddChunk(size_t blockCount);
+
+        std::pmr::memory_resource* m_Upstream;
+        size_t m_BlockSize;
+        size_t m_BlockAlignment;
+        size_t m_BlocksPerChunk;
+        size_t m_BlockCount = 0;
+        size_t m_FreeBlockCount = 0;
+        FreeBlock* m_FreeList = nullptr;
+        std::vector<std::pair<void*, size_t>> m_Chunks;
+    };
+}
+
+#include <D3D12Engine/Core/FixedBlockResource.inl>
+
+#endif // DE_CORE_FIXEDBLOCKRESOURCE_HPP
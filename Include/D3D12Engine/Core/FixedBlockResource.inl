@@ -0,0 +1,19 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+namespace D3D12Engine {
+    inline size_t FixedBlockResource::GetBlockSize() const {
+        return m_BlockSize;
+    }
+
+    inline size_t FixedBlockResource::GetBlockCount() const {
+        return m_BlockCount;
+    }
+
+    inline size_t FixedBlockResource::GetFreeBlockCount() const {
+        return m_FreeBlockCount;
+    }
+}
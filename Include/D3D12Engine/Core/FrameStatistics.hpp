@@ -0,0 +1,69 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef DE_CORE_FRAMESTATISTICS_HPP
+#define DE_CORE_FRAMESTATISTICS_HPP
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace D3D12Engine {
+    struct FrameSample {
+        // Time between the starts of two consecutive frames.
+        double FrameMs;
+        // CPU time spent updating, recording and submitting the frame.
+        double CpuMs;
+        double GpuMs;
+        // Process memory at the end of the frame.
+        uint64_t MemoryBytes;
+    };
+
+    struct StatisticSummary {
+        double Min = 0.0;
+        double Mean = 0.0;
+        double P50 = 0.0;
+        double P95 = 0.0;
+        double P99 = 0.0;
+        double Max = 0.0;
+    };
+
+    // Per frame timings of a run, and their distribution.
+    class FrameStatistics {
+    public:
+        FrameStatistics() = default;
+        ~FrameStatistics() = default;
+
+        FrameStatistics(const FrameStatistics&) = default;
+        FrameStatistics(FrameStatistics&&) = default;
+
+        void Reserve(size_t frameCount);
+        void Add(const FrameSample& sample);
+        void Clear();
+
+        // Distribution of one timing of the samples, e.g. Summarize(&FrameSample::GpuMs).
+        [[nodiscard]] StatisticSummary Summarize(double FrameSample::* timing) const;
+        [[nodiscard]] uint64_t GetPeakMemory() const;
+
+        [[nodiscard]] inline size_t GetFrameCount() const;
+        [[nodiscard]] inline std::span<const FrameSample> GetSamples() const;
+
+        // Sorts the values in place.
+        [[nodiscard]] static StatisticSummary Summarize(std::span<double> values);
+        // Percentile in [0, 100] of sorted values, interpolated linearly between the closest ranks.
+        [[nodiscard]] static double Percentile(std::span<const double> sortedValues, double percentile);
+
+        FrameStatistics& operator=(const FrameStatistics&) = default;
+        FrameStatistics& operator=(FrameStatistics&&) = default;
+
+    private:
+        std::vector<FrameSample> m_Samples;
+    };
+}
+
+#include <D3D12Engine/Core/FrameStatistics.inl>
+
+#endif // DE_CORE_FRAMESTATISTICS_HPP
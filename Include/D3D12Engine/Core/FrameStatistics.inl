@@ -0,0 +1,15 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+namespace D3D12Engine {
+    inline size_t FrameStatistics::GetFrameCount() const {
+        return m_Samples.size();
+    }
+
+    inline std::span<const FrameSample> FrameStatistics::GetSamples() const {
+        return m_Samples;
+    }
+}
@@ -0,0 +1,72 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef DE_CORE_INPUTEVENTQUEUE_HPP
+#define DE_CORE_INPUTEVENTQUEUE_HPP
+
+#include <D3D12Engine/Core/SpscRing.hpp>
+
+#include <atomic>
+#include <cstdint>
+
+namespace D3D12Engine {
+    // A window message carrying input, stamped with the time it was received.
+    struct InputEvent {
+        double Time;
+        uint32_t Message;
+        uintptr_t WParam;
+        intptr_t LParam;
+    };
+
+    // Carries input events from the window to the simulation, which consumes them step by
+    // step: each fixed update only sees the events received before the wall clock time its
+    // end corresponds to, so input arriving between two frames is spread over the steps
+    // instead of all landing on the first one. Push() is the producer side, everything else
+    // is the consumer side. Times are in seconds from any monotonic clock, simulation times
+    // in seconds from the start of the simulation.
+    class InputEventQueue {
+    public:
+        explicit InputEventQueue(size_t capacity = DefaultCapacity);
+        ~InputEventQueue() = default;
+
+        InputEventQueue(const InputEventQueue&) = delete;
+        InputEventQueue(InputEventQueue&&) = delete;
+
+        // Returns false and counts the event as dropped when the simulation fell too far behind.
+        bool Push(const InputEvent& event);
+
+        // Records that the simulation, including the time it has accumulated but not stepped
+        // yet, caught up with the given time. Call it after each timer tick.
+        void Synchronize(double time, double simulationTime);
+
+        [[nodiscard]] double ToSimulationTime(double time) const;
+        [[nodiscard]] double ToTime(double simulationTime) const;
+
+        // Calls handler(event, simulationTime) for every event received before the step ends,
+        // oldest first. Events older than the step are reported at its start. Returns the
+        // number of events handled.
+        template <typename F>
+        size_t DrainStep(double stepStart, double stepEnd, F&& handler);
+
+        [[nodiscard]] inline size_t GetPendingCount() const;
+        [[nodiscard]] inline uint64_t GetDroppedCount() const;
+
+        InputEventQueue& operator=(const InputEventQueue&) = delete;
+        InputEventQueue& operator=(InputEventQueue&&) = delete;
+
+    private:
+        static constexpr size_t DefaultCapacity = 4096;
+
+        SpscRing<InputEvent> m_Events;
+        std::atomic<uint64_t> m_DroppedCount = 0;
+        // Simulation time minus wall clock time, as of the last Synchronize().
+        double m_SimulationOffset = 0.0;
+    };
+}
+
+#include <D3D12Engine/Core/InputEventQueue.inl>
+
+#endif // DE_CORE_INPUTEVENTQUEUE_HPP
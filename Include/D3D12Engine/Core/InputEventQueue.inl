@@ -0,0 +1,35 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <algorithm>
+
+namespace D3D12Engine {
+    template <typename F>
+    size_t InputEventQueue::DrainStep(const double stepStart, const double stepEnd, F&& handler) {
+        const double endTime = ToTime(stepEnd);
+
+        size_t handledCount = 0;
+        while (const InputEvent* event = m_Events.Peek()) {
+            if (event->Time > endTime) {
+                break;
+            }
+
+            handler(*event, std::clamp(ToSimulationTime(event->Time), stepStart, stepEnd));
+            m_Events.Pop();
+            ++handledCount;
+        }
+
+        return handledCount;
+    }
+
+    inline size_t InputEventQueue::GetPendingCount() const {
+        return m_Events.GetSize();
+    }
+
+    inline uint64_t InputEventQueue::GetDroppedCount() const {
+        return m_DroppedCount.load(std::memory_order_relaxed);
+    }
+}
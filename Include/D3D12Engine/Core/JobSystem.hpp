@@ -0,0 +1,74 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef DE_CORE_JOBSYSTEM_HPP
+#define DE_CORE_JOBSYSTEM_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace D3D12Engine {
+    // Pool of worker threads running data parallel loops. The calling thread takes part
+    // in the work and returns once every chunk ran, so loops can be used like a plain for
+    // loop from any frame stage. Loops from different threads run one after the other.
+    class JobSystem {
+    public:
+        // One worker less than there are cores by default, the calling thread is the last one.
+        explicit JobSystem(uint32_t workerCount = GetDefaultWorkerCount());
+        ~JobSystem();
+
+        JobSystem(const JobSystem&) = delete;
+        JobSystem(JobSystem&&) = delete;
+
+        // Calls function(begin, end) over [0, count) in chunks of grainSize indices. The function
+        // must not throw nor start another loop on this job system.
+        template <typename F>
+        void ParallelFor(uint32_t count, uint32_t grainSize, F&& function);
+
+        [[nodiscard]] inline uint32_t GetWorkerCount() const;
+        [[nodiscard]] static uint32_t GetDefaultWorkerCount();
+
+        JobSystem& operator=(const JobSystem&) = delete;
+        JobSystem& operator=(JobSystem&&) = delete;
+
+    private:
+        using ChunkFunction = void (*)(void* pContext, uint32_t begin, uint32_t end);
+
+        struct Loop {
+            ChunkFunction Function;
+            void* pContext;
+            uint32_t Count;
+            uint32_t GrainSize;
+            uint32_t ChunkCount;
+            std::atomic<uint32_t> NextChunk = 0;
+            // Workers still running chunks, guarded by m_Mutex.
+            uint32_t ActiveWorkers = 0;
+        };
+
+        void Run(uint32_t count, uint32_t grainSize, ChunkFunction function, void* pContext);
+        static void RunChunks(Loop& loop);
+        void WorkerMain();
+
+        std::vector<std::thread> m_Workers;
+        // Only one loop at a time.
+        std::mutex m_RunMutex;
+
+        std::mutex m_Mutex;
+        std::condition_variable m_LoopStarted;
+        std::condition_variable m_LoopFinished;
+        Loop* m_pLoop = nullptr;
+        uint64_t m_LoopIndex = 0;
+        bool m_Stop = false;
+    };
+}
+
+#include <D3D12Engine/Core/JobSystem.inl>
+
+#endif // DE_CORE_JOBSYSTEM_HPP
@@ -0,0 +1,24 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <memory>
+#include <type_traits>
+
+namespace D3D12Engine {
+    template <typename F>
+    void JobSystem::ParallelFor(const uint32_t count, const uint32_t grainSize, F&& function) {
+        using Function = std::remove_reference_t<F>;
+
+        // The function stays on the caller's stack, the workers only see a pointer to it.
+        Run(count, grainSize, [](void* pContext, const uint32_t begin, const uint32_t end) {
+            (*static_cast<Function*>(pContext))(begin, end);
+        }, const_cast<void*>(static_cast<const void*>(std::addressof(function))));
+    }
+
+    inline uint32_t JobSystem::GetWorkerCount() const {
+        return static_cast<uint32_t>(m_Workers.size());
+    }
+}
@@ -0,0 +1,84 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef DE_CORE_LINEARARENA_HPP
+#define DE_CORE_LINEARARENA_HPP
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace D3D12Engine {
+    // Bump allocator for transient data: allocating is a pointer increment, nothing is
+    // freed individually and Reset() releases everything at once. When the block runs out,
+    // allocations fall back to the heap and the next Reset() grows the block to fit, so a
+    // steady state workload stops touching the heap after its first frames.
+    // It is also a std::pmr::memory_resource, for pmr containers that live within a frame.
+    class LinearArena final : public std::pmr::memory_resource {
+    public:
+        // Position to rewind to, for nested temporary allocations.
+        struct Marker {
+            size_t Offset;
+            size_t OverflowCount;
+        };
+
+        explicit LinearArena(size_t capacity);
+        ~LinearArena() override;
+
+        LinearArena(const LinearArena&) = delete;
+        LinearArena(LinearArena&&) = delete;
+
+        [[nodiscard]] void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+        // Objects are never destroyed, only trivially destructible types are allowed.
+        template <typename T, typename... Args>
+        [[nodiscard]] T* New(Args&&... args);
+        template <typename T>
+        [[nodiscard]] std::span<T> NewArray(size_t count);
+
+        void Reset();
+
+        [[nodiscard]] inline Marker GetMarker() const;
+        void Rewind(Marker marker);
+
+        [[nodiscard]] inline size_t GetUsed() const;
+        [[nodiscard]] inline size_t GetCapacity() const;
+        // Most bytes used since creation, overflow included.
+        [[nodiscard]] inline size_t GetHighWaterMark() const;
+
+        LinearArena& operator=(const LinearArena&) = delete;
+        LinearArena& operator=(LinearArena&&) = delete;
+
+    protected:
+        void* do_allocate(size_t bytes, size_t alignment) override;
+        void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+        [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+    private:
+        static constexpr size_t BlockAlignment = 64;
+
+        struct Overflow {
+            void* Memory;
+            size_t Size;
+            size_t Alignment;
+        };
+
+        void FreeOverflow(size_t keepCount);
+
+        std::byte* m_Memory;
+        size_t m_Capacity;
+        size_t m_Offset = 0;
+        size_t m_OverflowBytes = 0;
+        size_t m_HighWaterMark = 0;
+        std::vector<Overflow> m_Overflow;
+    };
+}
+
+#include <D3D12Engine/Core/LinearArena.inl>
+
+#endif // DE_CORE_LINEARARENA_HPP
@@ -0,0 +1,43 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <new>
+#include <utility>
+
+namespace D3D12Engine {
+    template <typename T, typename... Args>
+    T* LinearArena::New(Args&&... args) {
+        static_assert(std::is_trivially_destructible_v<T>, "Arena objects are never destroyed.");
+
+        return ::new (Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+    }
+
+    template <typename T>
+    std::span<T> LinearArena::NewArray(const size_t count) {
+        static_assert(std::is_trivially_destructible_v<T>, "Arena objects are never destroyed.");
+
+        T* pArray = static_cast<T*>(Allocate(sizeof(T) * count, alignof(T)));
+        std::uninitialized_default_construct_n(pArray, count);
+
+        return {pArray, count};
+    }
+
+    inline LinearArena::Marker LinearArena::GetMarker() const {
+        return {m_Offset, m_Overflow.size()};
+    }
+
+    inline size_t LinearArena::GetUsed() const {
+        return m_Offset + m_OverflowBytes;
+    }
+
+    inline size_t LinearArena::GetCapacity() const {
+        return m_Capacity;
+    }
+
+    inline size_t LinearArena::GetHighWaterMark() const {
+        return m_HighWaterMark;
+    }
+}
@@ -0,0 +1,66 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef DE_CORE_RESIZECOALESCER_HPP
+#define DE_CORE_RESIZECOALESCER_HPP
+
+#include <cstdint>
+#include <optional>
+
+namespace D3D12Engine {
+    struct ResizeCoalescerSettings {
+        // While the user drags the window border, a size is applied once it stopped
+        // changing for this long...
+        double SettleTimeSeconds = 0.05;
+        // ...or at most this often if it keeps changing, so the image still follows.
+        double MaxIntervalSeconds = 0.25;
+    };
+
+    struct WindowSize {
+        uint32_t Width;
+        uint32_t Height;
+
+        bool operator==(const WindowSize&) const = default;
+    };
+
+    // Turns the stream of window size notifications into the few resizes actually worth
+    // doing. Resizing the swap chain drains the GPU, so interactive resizing should not
+    // trigger it for every intermediate size. Zero sizes (minimized window) are ignored,
+    // as are sizes equal to the current one. Times are in seconds from any monotonic clock.
+    class ResizeCoalescer {
+    public:
+        ResizeCoalescer(WindowSize currentSize, const ResizeCoalescerSettings& settings = {});
+        ~ResizeCoalescer() = default;
+
+        ResizeCoalescer(const ResizeCoalescer&) = default;
+        ResizeCoalescer(ResizeCoalescer&&) = default;
+
+        void OnResize(WindowSize size, double time);
+        void OnBeginInteractiveResize();
+        void OnEndInteractiveResize();
+
+        // Returns the size to resize to now, if any. The returned size becomes the current one.
+        std::optional<WindowSize> Poll(double time);
+
+        [[nodiscard]] inline WindowSize GetCurrentSize() const;
+        [[nodiscard]] inline bool IsInteractive() const;
+
+        ResizeCoalescer& operator=(const ResizeCoalescer&) = default;
+        ResizeCoalescer& operator=(ResizeCoalescer&&) = default;
+
+    private:
+        ResizeCoalescerSettings m_Settings;
+        WindowSize m_CurrentSize;
+        std::optional<WindowSize> m_PendingSize;
+        double m_LastEventTime = 0.0;
+        double m_LastApplyTime = 0.0;
+        bool m_Interactive = false;
+    };
+}
+
+#include <D3D12Engine/Core/ResizeCoalescer.inl>
+
+#endif // DE_CORE_RESIZECOALESCER_HPP
@@ -0,0 +1,15 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+namespace D3D12Engine {
+    inline WindowSize ResizeCoalescer::GetCurrentSize() const {
+        return m_CurrentSize;
+    }
+
+    inline bool ResizeCoalescer::IsInteractive() const {
+        return m_Interactive;
+    }
+}
@@ -0,0 +1,42 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef DE_CORE_SCRATCHARENA_HPP
+#define DE_CORE_SCRATCHARENA_HPP
+
+#include <D3D12Engine/Core/LinearArena.hpp>
+
+namespace D3D12Engine {
+    // Scope on the calling thread's scratch arena: what is allocated through it is released
+    // when the scope ends. Scopes nest like the stack, an inner scope must end first.
+    // Meant for temporaries of a single function, such as strings built for an API call.
+    class ScratchArena {
+    public:
+        static constexpr size_t ThreadCapacity = 256 * 1024;
+
+        ScratchArena();
+        ~ScratchArena();
+
+        ScratchArena(const ScratchArena&) = delete;
+        ScratchArena(ScratchArena&&) = delete;
+
+        [[nodiscard]] inline LinearArena& GetArena() const;
+        [[nodiscard]] inline std::pmr::memory_resource* GetResource() const;
+
+        ScratchArena& operator=(const ScratchArena&) = delete;
+        ScratchArena& operator=(ScratchArena&&) = delete;
+
+    private:
+        static LinearArena& GetThreadArena();
+
+        LinearArena& m_Arena;
+        LinearArena::Marker m_Marker;
+    };
+}
+
+#include <D3D12Engine/Core/ScratchArena.inl>
+
+#endif // DE_CORE_SCRATCHARENA_HPP
@@ -0,0 +1,15 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+namespace D3D12Engine {
+    inline LinearArena& ScratchArena::GetArena() const {
+        return m_Arena;
+    }
+
+    inline std::pmr::memory_resource* ScratchArena::GetResource() const {
+        return &m_Arena;
+    }
+}
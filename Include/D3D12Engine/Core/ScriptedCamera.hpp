@@ -0,0 +1,46 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef DE_CORE_SCRIPTEDCAMERA_HPP
+#define DE_CORE_SCRIPTEDCAMERA_HPP
+
+#include <array>
+#include <span>
+#include <vector>
+
+namespace D3D12Engine {
+    struct CameraKeyframe {
+        double Time;
+        std::array<float, 3> Position;
+    };
+
+    // Camera path going smoothly through keyframes, for runs that must see the same frames
+    // every time. The path loops, make the last keyframe match the first for a seamless loop.
+    class ScriptedCamera {
+    public:
+        // Keyframes must have increasing times, the first one at time zero.
+        explicit ScriptedCamera(std::span<const CameraKeyframe> keyframes);
+        ~ScriptedCamera() = default;
+
+        ScriptedCamera(const ScriptedCamera&) = delete;
+        ScriptedCamera(ScriptedCamera&&) = delete;
+
+        // Catmull-Rom interpolation of the keyframes around the time, wrapped to the duration.
+        [[nodiscard]] std::array<float, 3> Evaluate(double time) const;
+
+        [[nodiscard]] inline double GetDuration() const;
+
+        ScriptedCamera& operator=(const ScriptedCamera&) = delete;
+        ScriptedCamera& operator=(ScriptedCamera&&) = delete;
+
+    private:
+        std::vector<CameraKeyframe> m_Keyframes;
+    };
+}
+
+#include <D3D12Engine/Core/ScriptedCamera.inl>
+
+#endif // DE_CORE_SCRIPTEDCAMERA_HPP
@@ -0,0 +1,62 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef DE_CORE_SPSCRING_HPP
+#define DE_CORE_SPSCRING_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <optional>
+
+namespace D3D12Engine {
+    // Lock-free single-producer/single-consumer ring buffer with a fixed capacity, rounded
+    // up to a power of two. TryPush() must only be called from one thread and Peek(), Pop()
+    // and TryPop() from one other thread (or both from the same thread). Neither side ever
+    // blocks, TryPush() fails when the ring is full.
+    template <typename T>
+    class SpscRing {
+    public:
+        explicit SpscRing(size_t capacity);
+        ~SpscRing() = default;
+
+        SpscRing(const SpscRing&) = delete;
+        SpscRing(SpscRing&&) = delete;
+
+        // Producer side.
+        bool TryPush(const T& value);
+
+        // Consumer side. Peek() returns the oldest element without removing it, or nullptr
+        // if the ring is empty. Pop() removes the element Peek() returned.
+        [[nodiscard]] const T* Peek();
+        void Pop();
+        std::optional<T> TryPop();
+
+        // Only a snapshot when the other side is running.
+        [[nodiscard]] inline size_t GetSize() const;
+        [[nodiscard]] inline size_t GetCapacity() const;
+
+        SpscRing& operator=(const SpscRing&) = delete;
+        SpscRing& operator=(SpscRing&&) = delete;
+
+    private:
+        static constexpr size_t CacheLineSize = 64;
+
+        std::unique_ptr<T[]> m_Slots;
+        size_t m_Mask;
+
+        // Each side owns its index and keeps a copy of the other one, refreshed only when the
+        // ring looks full (or empty), so the shared cache lines are rarely touched.
+        alignas(CacheLineSize) std::atomic<size_t> m_Head = 0; // Next element to read.
+        size_t m_CachedTail = 0;
+        alignas(CacheLineSize) std::atomic<size_t> m_Tail = 0; // Next slot to write.
+        size_t m_CachedHead = 0;
+    };
+}
+
+#include <D3D12Engine/Core/SpscRing.inl>
+
+#endif // DE_CORE_SPSCRING_HPP
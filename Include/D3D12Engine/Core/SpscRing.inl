@@ -0,0 +1,78 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <bit>
+#include <stdexcept>
+
+namespace D3D12Engine {
+    template <typename T>
+    SpscRing<T>::SpscRing(const size_t capacity) {
+        if (capacity == 0) {
+            throw std::invalid_argument("SpscRing capacity must not be zero");
+        }
+
+        const size_t slotCount = std::bit_ceil(capacity);
+        m_Slots = std::make_unique<T[]>(slotCount);
+        m_Mask = slotCount - 1;
+    }
+
+    template <typename T>
+    bool SpscRing<T>::TryPush(const T& value) {
+        const size_t tail = m_Tail.load(std::memory_order_relaxed);
+        if (tail - m_CachedHead > m_Mask) {
+            m_CachedHead = m_Head.load(std::memory_order_acquire);
+            if (tail - m_CachedHead > m_Mask) {
+                return false;
+            }
+        }
+
+        m_Slots[tail & m_Mask] = value;
+        m_Tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    template <typename T>
+    const T* SpscRing<T>::Peek() {
+        const size_t head = m_Head.load(std::memory_order_relaxed);
+        if (head == m_CachedTail) {
+            m_CachedTail = m_Tail.load(std::memory_order_acquire);
+            if (head == m_CachedTail) {
+                return nullptr;
+            }
+        }
+
+        return &m_Slots[head & m_Mask];
+    }
+
+    template <typename T>
+    void SpscRing<T>::Pop() {
+        m_Head.store(m_Head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    template <typename T>
+    std::optional<T> SpscRing<T>::TryPop() {
+        const T* value = Peek();
+        if (!value) {
+            return std::nullopt;
+        }
+
+        std::optional<T> result(*value);
+        Pop();
+        return result;
+    }
+
+    template <typename T>
+    inline size_t SpscRing<T>::GetSize() const {
+        // Head first: it never passes the tail, so the difference cannot wrap around.
+        const size_t head = m_Head.load(std::memory_order_acquire);
+        return m_Tail.load(std::memory_order_acquire) - head;
+    }
+
+    template <typename T>
+    inline size_t SpscRing<T>::GetCapacity() const {
+        return m_Mask + 1;
+    }
+}
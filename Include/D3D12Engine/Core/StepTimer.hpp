@@ -51,6 +51,11 @@ namespace D3D12Engine {
             return TicksToSeconds(m_totalTicks);
         }
 
+        // Get time accumulated towards the next fixed timestep Update call.
+        uint64_t GetLeftOverTicks() const noexcept {
+            return m_leftOverTicks;
+        }
+
         // Get total number of updates since start of the program.
         uint32_t GetFrameCount() const noexcept {
             return m_frameCount;
@@ -7,22 +7,30 @@
 #ifndef DE_BUFFER_HPP
 #define DE_BUFFER_HPP
 
-#include <D3D12Engine/pch.hpp>
+#include <D3D12Engine/RHI/RenderDevice.hpp>
 
 namespace D3D12Engine {
     class AbstractBuffer {
     public:
-        AbstractBuffer(ID3D12Device* pDevice, size_t size);
-        ~AbstractBuffer() = default;
+        AbstractBuffer(RenderDevice& device, size_t size, BufferUsage usage = BufferUsage::Generic, std::string_view name = {});
+        ~AbstractBuffer();
 
-        [[nodiscard]] inline D3D12_GPU_VIRTUAL_ADDRESS GetGPUVirtualAddress() const;
+        AbstractBuffer(const AbstractBuffer&) = delete;
+        AbstractBuffer(AbstractBuffer&&) = delete;
 
-        void Map(UINT8** pDataBegin) const;
+        [[nodiscard]] inline ResourceHandle GetHandle() const;
+        [[nodiscard]] inline size_t GetSize() const;
+
+        void Map(uint8_t** pDataBegin) const;
         void Unmap() const;
+
+        AbstractBuffer& operator=(const AbstractBuffer&) = delete;
+        AbstractBuffer& operator=(AbstractBuffer&&) = delete;
     
     protected:
-        ComPtr<ID3D12Resource> m_Buffer;
-        ID3D12Device* m_Device{nullptr};
+        RenderDevice& m_Device;
+        ResourceHandle m_Buffer;
+        size_t m_Size;
     };
 }
 
@@ -5,7 +5,11 @@
 #pragma once
 
 namespace D3D12Engine {
-    inline D3D12_GPU_VIRTUAL_ADDRESS AbstractBuffer::GetGPUVirtualAddress() const {
-        return m_Buffer->GetGPUVirtualAddress();
+    inline ResourceHandle AbstractBuffer::GetHandle() const {
+        return m_Buffer;
+    }
+
+    inline size_t AbstractBuffer::GetSize() const {
+        return m_Size;
     }
 }
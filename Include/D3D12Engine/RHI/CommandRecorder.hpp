@@ -0,0 +1,55 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef DE_RHI_COMMANDRECORDER_HPP
+#define DE_RHI_COMMANDRECORDER_HPP
+
+#include <D3D12Engine/RHI/RhiTypes.hpp>
+
+#include <span>
+
+namespace D3D12Engine {
+    // Records the commands of one frame. This is the subset of a graphics command list
+    // the engine uses, expressed with RHI handles.
+    class CommandRecorder {
+    public:
+        CommandRecorder() = default;
+        virtual ~CommandRecorder() = default;
+
+        CommandRecorder(const CommandRecorder&) = delete;
+        CommandRecorder(CommandRecorder&&) = delete;
+
+        virtual void ResourceBarrier(std::span<const ResourceTransition> transitions) = 0;
+
+        // Binds the pipeline state, its root signature and its primitive topology.
+        virtual void SetPipeline(PipelineHandle pipeline) = 0;
+        virtual void SetViewport(const Viewport& viewport) = 0;
+        virtual void SetScissorRect(const ScissorRect& rect) = 0;
+        virtual void SetRenderTarget(ResourceHandle texture) = 0;
+        virtual void ClearRenderTarget(ResourceHandle texture, const std::array<float, 4>& color, const ScissorRect* pRect = nullptr) = 0;
+
+        virtual void SetRootConstants(uint32_t rootIndex, std::span<const uint32_t> values, uint32_t offset = 0) = 0;
+        virtual void SetShaderResource(uint32_t rootIndex, ResourceHandle texture) = 0;
+        virtual void SetVertexBuffer(const VertexBufferView& view) = 0;
+
+        virtual void Draw(uint32_t vertexCount, uint32_t instanceCount = 1, uint32_t firstVertex = 0, uint32_t firstInstance = 0) = 0;
+
+        // Issues up to maxCommandCount commands laid out as described by the signature. The
+        // actual count is read from the count buffer when one is given.
+        virtual void ExecuteIndirect(CommandSignatureHandle signature, uint32_t maxCommandCount,
+                                     ResourceHandle argumentBuffer, uint64_t argumentOffset,
+                                     ResourceHandle countBuffer = {}, uint64_t countOffset = 0) = 0;
+
+        inline void SetRootConstants(uint32_t rootIndex, std::span<const float> values, uint32_t offset = 0);
+
+        CommandRecorder& operator=(const CommandRecorder&) = delete;
+        CommandRecorder& operator=(CommandRecorder&&) = delete;
+    };
+}
+
+#include <D3D12Engine/RHI/CommandRecorder.inl>
+
+#endif // DE_RHI_COMMANDRECORDER_HPP
@@ -0,0 +1,12 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+namespace D3D12Engine {
+    inline void CommandRecorder::SetRootConstants(const uint32_t rootIndex, const std::span<const float> values, const uint32_t offset) {
+        // Root constants are raw 32 bit values, floats go through as their bit pattern.
+        SetRootConstants(rootIndex, std::span(reinterpret_cast<const uint32_t*>(values.data()), values.size()), offset);
+    }
+}
@@ -0,0 +1,56 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef DE_RHI_D3D12_D3D12COMMANDRECORDER_HPP
+#define DE_RHI_D3D12_D3D12COMMANDRECORDER_HPP
+
+#include <D3D12Engine/pch.hpp>
+
+#include <D3D12Engine/RHI/CommandRecorder.hpp>
+#include <D3D12Engine/RHI/D3D12/D3D12RenderDevice.hpp>
+
+namespace D3D12Engine {
+    // Translates the commands into calls on a D3D12 graphics command list. The list
+    // must be open, it is neither reset nor closed here.
+    class D3D12CommandRecorder final : public CommandRecorder {
+    public:
+        D3D12CommandRecorder(const D3D12RenderDevice& device, ID3D12GraphicsCommandList* pCommandList);
+        ~D3D12CommandRecorder() override = default;
+
+        D3D12CommandRecorder(const D3D12CommandRecorder&) = delete;
+        D3D12CommandRecorder(D3D12CommandRecorder&&) = delete;
+
+        using CommandRecorder::SetRootConstants;
+
+        void ResourceBarrier(std::span<const ResourceTransition> transitions) override;
+        void SetPipeline(PipelineHandle pipeline) override;
+        void SetViewport(const Viewport& viewport) override;
+        void SetScissorRect(const ScissorRect& rect) override;
+        void SetRenderTarget(ResourceHandle texture) override;
+        void ClearRenderTarget(ResourceHandle texture, const std::array<float, 4>& color, const ScissorRect* pRect = nullptr) override;
+        void SetRootConstants(uint32_t rootIndex, std::span<const uint32_t> values, uint32_t offset = 0) override;
+        void SetShaderResource(uint32_t rootIndex, ResourceHandle texture) override;
+        void SetVertexBuffer(const VertexBufferView& view) override;
+        void Draw(uint32_t vertexCount, uint32_t instanceCount = 1, uint32_t firstVertex = 0, uint32_t firstInstance = 0) override;
+        void ExecuteIndirect(CommandSignatureHandle signature, uint32_t maxCommandCount,
+                             ResourceHandle argumentBuffer, uint64_t argumentOffset,
+                             ResourceHandle countBuffer = {}, uint64_t countOffset = 0) override;
+
+        [[nodiscard]] inline ID3D12GraphicsCommandList* GetCommandList() const;
+
+        D3D12CommandRecorder& operator=(const D3D12CommandRecorder&) = delete;
+        D3D12CommandRecorder& operator=(D3D12CommandRecorder&&) = delete;
+
+    private:
+        const D3D12RenderDevice& m_Device;
+        ID3D12GraphicsCommandList* m_CommandList;
+        bool m_DescriptorHeapBound = false;
+    };
+}
+
+#include <D3D12Engine/RHI/D3D12/D3D12CommandRecorder.inl>
+
+#endif // DE_RHI_D3D12_D3D12COMMANDRECORDER_HPP
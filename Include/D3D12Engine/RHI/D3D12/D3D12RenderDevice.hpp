@@ -0,0 +1,105 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef DE_RHI_D3D12_D3D12RENDERDEVICE_HPP
+#define DE_RHI_D3D12_D3D12RENDERDEVICE_HPP
+
+#include <D3D12Engine/pch.hpp>
+
+#include <D3D12Engine/RHI/RenderDevice.hpp>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace D3D12Engine {
+    // D3D12 backend of the RHI. Owns the resources created through it along with their
+    // render target and shader resource views, which live in heaps managed here.
+    // Resources are released immediately, callers must make sure the GPU is done with them.
+    class D3D12RenderDevice final : public RenderDevice {
+    public:
+        struct Pipeline {
+            ComPtr<ID3D12PipelineState> PipelineState;
+            ComPtr<ID3D12RootSignature> RootSignature;
+            D3D_PRIMITIVE_TOPOLOGY Topology;
+        };
+
+        D3D12RenderDevice(ID3D12Device* pDevice, UINT maxRenderTargetViews = 64, UINT maxShaderResourceViews = 256);
+        ~D3D12RenderDevice() override = default;
+
+        D3D12RenderDevice(const D3D12RenderDevice&) = delete;
+        D3D12RenderDevice(D3D12RenderDevice&&) = delete;
+
+        ResourceHandle CreateBuffer(const BufferDesc& desc) override;
+        ResourceHandle CreateTexture(const TextureDesc& desc) override;
+        void DestroyResource(ResourceHandle resource) override;
+
+        uint8_t* Map(ResourceHandle buffer) override;
+        void Unmap(ResourceHandle buffer) override;
+        void SetDebugName(ResourceHandle resource, std::string_view name) override;
+
+        PipelineHandle CreatePipeline(const PipelineDesc& desc) override;
+        void ReplacePipeline(PipelineHandle pipeline, const PipelineDesc& desc) override;
+
+        CommandSignatureHandle CreateCommandSignature(const CommandSignatureDesc& desc) override;
+
+        // Wraps a resource created elsewhere, such as a swap chain buffer, and creates the requested views.
+        // The resource must currently be in the given state.
+        ResourceHandle RegisterResource(ComPtr<ID3D12Resource> resource, TextureUsage usage, ResourceState state = ResourceState::Present);
+
+        [[nodiscard]] inline ID3D12Device* GetDevice() const;
+        [[nodiscard]] inline ID3D12Resource* GetResource(ResourceHandle resource) const;
+        [[nodiscard]] inline const Pipeline& GetPipeline(PipelineHandle pipeline) const;
+        [[nodiscard]] inline ID3D12CommandSignature* GetCommandSignature(CommandSignatureHandle signature) const;
+        [[nodiscard]] D3D12_CPU_DESCRIPTOR_HANDLE GetRenderTargetView(ResourceHandle resource) const;
+        [[nodiscard]] D3D12_GPU_DESCRIPTOR_HANDLE GetShaderResourceView(ResourceHandle resource) const;
+        [[nodiscard]] inline ID3D12DescriptorHeap* GetShaderResourceHeap() const;
+
+        D3D12RenderDevice& operator=(const D3D12RenderDevice&) = delete;
+        D3D12RenderDevice& operator=(D3D12RenderDevice&&) = delete;
+
+    private:
+        static constexpr UINT NoDescriptor = ~0u;
+
+        struct Resource {
+            ComPtr<ID3D12Resource> Resource;
+            UINT RtvIndex = NoDescriptor;
+            UINT SrvIndex = NoDescriptor;
+            MemoryType Memory = MemoryType::Default;
+        };
+
+        struct DescriptorHeap {
+            ComPtr<ID3D12DescriptorHeap> Heap;
+            UINT DescriptorSize = 0;
+            UINT Capacity = 0;
+            UINT Next = 0;
+            std::vector<UINT> FreeIndices;
+
+            UINT Allocate();
+            void Free(UINT index);
+        };
+
+        ResourceHandle AddResource(ComPtr<ID3D12Resource> resource, TextureUsage usage, DXGI_FORMAT viewFormat);
+        Pipeline BuildPipeline(const PipelineDesc& desc);
+        // Pipelines with the same root parameters share their root signature.
+        ComPtr<ID3D12RootSignature> GetRootSignature(const PipelineDesc& desc);
+        [[nodiscard]] uint64_t GetAllocationSize(const D3D12_RESOURCE_DESC& desc) const;
+
+        ComPtr<ID3D12Device> m_Device;
+        DescriptorHeap m_RtvHeap;
+        DescriptorHeap m_SrvHeap;
+        std::vector<Resource> m_Resources;
+        std::vector<uint32_t> m_FreeResources;
+        std::vector<Pipeline> m_Pipelines;
+        // Keyed by the serialized root signature.
+        std::unordered_map<std::string, ComPtr<ID3D12RootSignature>> m_RootSignatures;
+        std::vector<ComPtr<ID3D12CommandSignature>> m_CommandSignatures;
+    };
+}
+
+#include <D3D12Engine/RHI/D3D12/D3D12RenderDevice.inl>
+
+#endif // DE_RHI_D3D12_D3D12RENDERDEVICE_HPP
@@ -0,0 +1,27 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+namespace D3D12Engine {
+    inline ID3D12Device* D3D12RenderDevice::GetDevice() const {
+        return m_Device.Get();
+    }
+
+    inline ID3D12Resource* D3D12RenderDevice::GetResource(const ResourceHandle resource) const {
+        return m_Resources[resource.Index].Resource.Get();
+    }
+
+    inline const D3D12RenderDevice::Pipeline& D3D12RenderDevice::GetPipeline(const PipelineHandle pipeline) const {
+        return m_Pipelines[pipeline.Index];
+    }
+
+    inline ID3D12CommandSignature* D3D12RenderDevice::GetCommandSignature(const CommandSignatureHandle signature) const {
+        return m_CommandSignatures[signature.Index].Get();
+    }
+
+    inline ID3D12DescriptorHeap* D3D12RenderDevice::GetShaderResourceHeap() const {
+        return m_SrvHeap.Heap.Get();
+    }
+}
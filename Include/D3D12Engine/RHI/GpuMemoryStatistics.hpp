@@ -0,0 +1,130 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef DE_RHI_GPUMEMORYSTATISTICS_HPP
+#define DE_RHI_GPUMEMORYSTATISTICS_HPP
+
+#include <D3D12Engine/RHI/RhiTypes.hpp>
+
+#include <array>
+#include <filesystem>
+#include <optional>
+#include <ostream>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace D3D12Engine {
+    enum class GpuMemoryCategory : uint8_t {
+        VertexBuffer,
+        IndexBuffer,
+        UploadBuffer,
+        ReadbackBuffer,
+        // GPU only buffers with no more specific usage.
+        Buffer,
+        Texture,
+        RenderTarget,
+        DescriptorHeap,
+
+        Count
+    };
+
+    [[nodiscard]] constexpr std::string_view GetCategoryName(GpuMemoryCategory category);
+    [[nodiscard]] constexpr GpuMemoryCategory GetMemoryCategory(const BufferDesc& desc);
+    [[nodiscard]] constexpr GpuMemoryCategory GetMemoryCategory(TextureUsage usage);
+
+    struct GpuMemoryUsage {
+        uint64_t CurrentBytes = 0;
+        uint64_t PeakBytes = 0;
+        // Live allocations.
+        uint32_t AllocationCount = 0;
+    };
+
+    // Same fields as DXGI_QUERY_VIDEO_MEMORY_INFO.
+    struct GpuMemoryBudget {
+        uint64_t Budget = 0;
+        uint64_t CurrentUsage = 0;
+        uint64_t AvailableForReservation = 0;
+        uint64_t CurrentReservation = 0;
+    };
+
+    struct GpuMemoryReportSettings {
+        std::filesystem::path Path = "gpu_memory.json";
+        // The report is rewritten this often, so it is up to date if the app is killed.
+        double IntervalSeconds = 5.0;
+
+        // Settings from the command line arguments, none without --memory-report or
+        // --memory-report=path.
+        [[nodiscard]] static std::optional<GpuMemoryReportSettings> Parse(std::span<const std::wstring_view> arguments);
+    };
+
+    // Tracks the memory of the resources a render device created, by category, along
+    // with the memory written every frame and the budget the OS gives the process. Sizes
+    // are what the backend reports the allocations take, alignment included.
+    class GpuMemoryStatistics {
+    public:
+        GpuMemoryStatistics() = default;
+        ~GpuMemoryStatistics() = default;
+
+        GpuMemoryStatistics(const GpuMemoryStatistics&) = delete;
+        GpuMemoryStatistics(GpuMemoryStatistics&&) = delete;
+
+        void RecordAllocation(ResourceHandle resource, GpuMemoryCategory category, uint64_t size);
+        // Throws if the resource wasn't recorded.
+        void RecordRelease(ResourceHandle resource);
+        // Memory that isn't a resource and lives as long as the device, such as descriptor heaps.
+        void RecordAllocation(GpuMemoryCategory category, uint64_t size);
+
+        // Transient memory is what the CPU writes for a single frame, such as indirect
+        // arguments. It is summed per frame and the largest frame is kept.
+        void BeginFrame();
+        void RecordTransient(uint64_t size);
+
+        void SetBudget(const GpuMemoryBudget& local, const GpuMemoryBudget& nonLocal);
+
+        void WriteReport(std::ostream& stream) const;
+        // Throws if the file can't be written.
+        void WriteReport(const std::filesystem::path& path) const;
+
+        [[nodiscard]] inline const GpuMemoryUsage& GetUsage(GpuMemoryCategory category) const;
+        [[nodiscard]] inline const GpuMemoryUsage& GetTotalUsage() const;
+        // 0 if the resource isn't recorded.
+        [[nodiscard]] inline uint64_t GetAllocationSize(ResourceHandle resource) const;
+        [[nodiscard]] inline uint64_t GetFrameTransientBytes() const;
+        [[nodiscard]] inline uint64_t GetPeakFrameTransientBytes() const;
+        [[nodiscard]] inline uint64_t GetFrameCount() const;
+        // Video memory on discrete adapters, all the memory on integrated ones.
+        [[nodiscard]] inline const GpuMemoryBudget& GetLocalBudget() const;
+        [[nodiscard]] inline const GpuMemoryBudget& GetNonLocalBudget() const;
+
+        GpuMemoryStatistics& operator=(const GpuMemoryStatistics&) = delete;
+        GpuMemoryStatistics& operator=(GpuMemoryStatistics&&) = delete;
+
+    private:
+        struct Allocation {
+            uint64_t Size = 0;
+            GpuMemoryCategory Category = GpuMemoryCategory::Buffer;
+            bool Live = false;
+        };
+
+        static void Add(GpuMemoryUsage& usage, uint64_t size);
+        static void Remove(GpuMemoryUsage& usage, uint64_t size);
+
+        // Indexed by resource handle.
+        std::vector<Allocation> m_Allocations;
+        std::array<GpuMemoryUsage, static_cast<size_t>(GpuMemoryCategory::Count)> m_Categories;
+        GpuMemoryUsage m_Total;
+        uint64_t m_FrameTransientBytes = 0;
+        uint64_t m_PeakFrameTransientBytes = 0;
+        uint64_t m_FrameCount = 0;
+        GpuMemoryBudget m_LocalBudget;
+        GpuMemoryBudget m_NonLocalBudget;
+    };
+}
+
+#include <D3D12Engine/RHI/GpuMemoryStatistics.inl>
+
+#endif // DE_RHI_GPUMEMORYSTATISTICS_HPP
@@ -0,0 +1,90 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+namespace D3D12Engine {
+    constexpr std::string_view GetCategoryName(const GpuMemoryCategory category) {
+        switch (category) {
+        case GpuMemoryCategory::VertexBuffer:
+            return "vertexBuffer";
+        case GpuMemoryCategory::IndexBuffer:
+            return "indexBuffer";
+        case GpuMemoryCategory::UploadBuffer:
+            return "uploadBuffer";
+        case GpuMemoryCategory::ReadbackBuffer:
+            return "readbackBuffer";
+        case GpuMemoryCategory::Buffer:
+            return "buffer";
+        case GpuMemoryCategory::Texture:
+            return "texture";
+        case GpuMemoryCategory::RenderTarget:
+            return "renderTarget";
+        case GpuMemoryCategory::DescriptorHeap:
+            return "descriptorHeap";
+        default:
+            return "unknown";
+        }
+    }
+
+    constexpr GpuMemoryCategory GetMemoryCategory(const BufferDesc& desc) {
+        switch (desc.Usage) {
+        case BufferUsage::Vertex:
+            return GpuMemoryCategory::VertexBuffer;
+        case BufferUsage::Index:
+            return GpuMemoryCategory::IndexBuffer;
+        default:
+            break;
+        }
+
+        switch (desc.Memory) {
+        case MemoryType::Upload:
+            return GpuMemoryCategory::UploadBuffer;
+        case MemoryType::Readback:
+            return GpuMemoryCategory::ReadbackBuffer;
+        default:
+            return GpuMemoryCategory::Buffer;
+        }
+    }
+
+    constexpr GpuMemoryCategory GetMemoryCategory(const TextureUsage usage) {
+        return HasUsage(usage, TextureUsage::RenderTarget) ? GpuMemoryCategory::RenderTarget : GpuMemoryCategory::Texture;
+    }
+
+    inline const GpuMemoryUsage& GpuMemoryStatistics::GetUsage(const GpuMemoryCategory category) const {
+        return m_Categories[static_cast<size_t>(category)];
+    }
+
+    inline const GpuMemoryUsage& GpuMemoryStatistics::GetTotalUsage() const {
+        return m_Total;
+    }
+
+    inline uint64_t GpuMemoryStatistics::GetAllocationSize(const ResourceHandle resource) const {
+        if (resource.Index >= m_Allocations.size() || !m_Allocations[resource.Index].Live) {
+            return 0;
+        }
+
+        return m_Allocations[resource.Index].Size;
+    }
+
+    inline uint64_t GpuMemoryStatistics::GetFrameTransientBytes() const {
+        return m_FrameTransientBytes;
+    }
+
+    inline uint64_t GpuMemoryStatistics::GetPeakFrameTransientBytes() const {
+        return m_PeakFrameTransientBytes;
+    }
+
+    inline uint64_t GpuMemoryStatistics::GetFrameCount() const {
+        return m_FrameCount;
+    }
+
+    inline const GpuMemoryBudget& GpuMemoryStatistics::GetLocalBudget() const {
+        return m_LocalBudget;
+    }
+
+    inline const GpuMemoryBudget& GpuMemoryStatistics::GetNonLocalBudget() const {
+        return m_NonLocalBudget;
+    }
+}
@@ -0,0 +1,47 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef DE_RHI_GPUTIMER_HPP
+#define DE_RHI_GPUTIMER_HPP
+
+#include <D3D12Engine/pch.hpp>
+
+#include <vector>
+
+namespace D3D12Engine {
+    // Measures GPU time between pairs of timestamp queries recorded on a direct command list.
+    // Results are copied to a readback buffer by Resolve() and can be read with ReadBack()
+    // once the GPU is done with the command list.
+    class GpuTimer {
+    public:
+        GpuTimer(ID3D12Device* pDevice, ID3D12CommandQueue* pCommandQueue, UINT scopeCount = 1);
+        ~GpuTimer() = default;
+
+        GpuTimer(const GpuTimer&) = delete;
+        GpuTimer(GpuTimer&&) = delete;
+
+        void Begin(ID3D12GraphicsCommandList* pCommandList, UINT scope = 0) const;
+        void End(ID3D12GraphicsCommandList* pCommandList, UINT scope = 0) const;
+        void Resolve(ID3D12GraphicsCommandList* pCommandList) const;
+        void ReadBack();
+
+        [[nodiscard]] inline double GetElapsedMs(UINT scope = 0) const;
+
+        GpuTimer& operator=(const GpuTimer&) = delete;
+        GpuTimer& operator=(GpuTimer&&) = delete;
+
+    private:
+        ComPtr<ID3D12QueryHeap> m_QueryHeap;
+        ComPtr<ID3D12Resource> m_ReadbackBuffer;
+        UINT64 m_Frequency;
+        UINT m_ScopeCount;
+        std::vector<double> m_ElapsedMs;
+    };
+}
+
+#include <D3D12Engine/RHI/GpuTimer.inl>
+
+#endif // DE_RHI_GPUTIMER_HPP
@@ -0,0 +1,75 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef DE_RHI_NULL_COMMANDSTREAM_HPP
+#define DE_RHI_NULL_COMMANDSTREAM_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace D3D12Engine {
+    enum class RecordedCommand : uint16_t {
+        ResourceBarrier,
+        SetPipeline,
+        SetViewport,
+        SetScissorRect,
+        SetRenderTarget,
+        ClearRenderTarget,
+        SetRootConstants,
+        SetShaderResource,
+        SetVertexBuffer,
+        Draw,
+        ExecuteIndirect,
+        Count
+    };
+
+    // Compact in-memory command list: each command is a small header followed by a
+    // trivially copyable payload and optional trailing data, 4 byte aligned. The storage
+    // is kept across Reset() so steady state recording doesn't allocate.
+    class CommandStream {
+    public:
+        struct Header {
+            RecordedCommand Command;
+            // 16 bits would cap barrier batches at about 4000 transitions.
+            uint32_t PayloadSize;
+        };
+
+        CommandStream() = default;
+        ~CommandStream() = default;
+
+        CommandStream(const CommandStream&) = delete;
+        CommandStream(CommandStream&&) = default;
+
+        template <typename T>
+        void Write(RecordedCommand command, const T& payload, std::span<const std::byte> trailingData = {});
+
+        void Reset();
+
+        // Calls callback(command, payload bytes) for every recorded command, in order.
+        template <typename Callback>
+        void ForEach(Callback&& callback) const;
+
+        [[nodiscard]] inline size_t GetByteSize() const;
+        [[nodiscard]] inline uint32_t GetCommandCount() const;
+        [[nodiscard]] inline uint32_t GetCommandCount(RecordedCommand command) const;
+
+        CommandStream& operator=(const CommandStream&) = delete;
+        CommandStream& operator=(CommandStream&&) = default;
+
+    private:
+        std::vector<std::byte> m_Data;
+        std::array<uint32_t, static_cast<size_t>(RecordedCommand::Count)> m_CommandCounts{};
+        uint32_t m_CommandCount = 0;
+    };
+}
+
+#include <D3D12Engine/RHI/Null/CommandStream.inl>
+
+#endif // DE_RHI_NULL_COMMANDSTREAM_HPP
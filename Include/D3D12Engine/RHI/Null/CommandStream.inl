@@ -0,0 +1,61 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+namespace D3D12Engine {
+    template <typename T>
+    void CommandStream::Write(const RecordedCommand command, const T& payload, const std::span<const std::byte> trailingData) {
+        static_assert(std::is_trivially_copyable_v<T>, "Command payloads must be trivially copyable.");
+
+        const size_t payloadSize = (sizeof(T) + trailingData.size() + 3) & ~static_cast<size_t>(3);
+        if (payloadSize > std::numeric_limits<uint32_t>::max()) {
+            throw std::length_error("Command payload is too large.");
+        }
+
+        const Header header{command, static_cast<uint32_t>(payloadSize)};
+
+        const size_t offset = m_Data.size();
+        m_Data.resize(offset + sizeof(Header) + payloadSize);
+
+        std::byte* pDestination = m_Data.data() + offset;
+        std::memcpy(pDestination, &header, sizeof(Header));
+        std::memcpy(pDestination + sizeof(Header), &payload, sizeof(T));
+        if (!trailingData.empty()) {
+            std::memcpy(pDestination + sizeof(Header) + sizeof(T), trailingData.data(), trailingData.size());
+        }
+
+        m_CommandCounts[static_cast<size_t>(command)]++;
+        m_CommandCount++;
+    }
+
+    template <typename Callback>
+    void CommandStream::ForEach(Callback&& callback) const {
+        size_t offset = 0;
+        while (offset < m_Data.size()) {
+            Header header;
+            std::memcpy(&header, m_Data.data() + offset, sizeof(Header));
+            offset += sizeof(Header);
+
+            callback(header.Command, std::span<const std::byte>(m_Data.data() + offset, header.PayloadSize));
+            offset += header.PayloadSize;
+        }
+    }
+
+    inline size_t CommandStream::GetByteSize() const {
+        return m_Data.size();
+    }
+
+    inline uint32_t CommandStream::GetCommandCount() const {
+        return m_CommandCount;
+    }
+
+    inline uint32_t CommandStream::GetCommandCount(const RecordedCommand command) const {
+        return m_CommandCounts[static_cast<size_t>(command)];
+    }
+}
@@ -0,0 +1,101 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef DE_RHI_NULL_NULLCOMMANDRECORDER_HPP
+#define DE_RHI_NULL_NULLCOMMANDRECORDER_HPP
+
+#include <D3D12Engine/RHI/CommandRecorder.hpp>
+#include <D3D12Engine/RHI/Null/CommandStream.hpp>
+
+namespace D3D12Engine {
+    // Payloads of the commands in a null backend CommandStream.
+    namespace RecordedCommands {
+        struct ResourceBarrier {
+            uint32_t Count;
+        };
+
+        struct SetPipeline {
+            PipelineHandle Pipeline;
+        };
+
+        struct SetRenderTarget {
+            ResourceHandle Texture;
+        };
+
+        struct ClearRenderTarget {
+            ResourceHandle Texture;
+            std::array<float, 4> Color;
+            ScissorRect Rect;
+            uint32_t HasRect;
+        };
+
+        struct SetRootConstants {
+            uint32_t RootIndex;
+            uint32_t Offset;
+            uint32_t Count;
+        };
+
+        struct SetShaderResource {
+            uint32_t RootIndex;
+            ResourceHandle Texture;
+        };
+
+        struct Draw {
+            uint32_t VertexCount;
+            uint32_t InstanceCount;
+            uint32_t FirstVertex;
+            uint32_t FirstInstance;
+        };
+
+        struct ExecuteIndirect {
+            CommandSignatureHandle Signature;
+            uint32_t MaxCommandCount;
+            ResourceHandle ArgumentBuffer;
+            ResourceHandle CountBuffer;
+            uint64_t ArgumentOffset;
+            uint64_t CountOffset;
+        };
+    }
+
+    // Records commands into a CommandStream instead of a GPU command list, so frames
+    // can be recorded, inspected and timed without a GPU.
+    class NullCommandRecorder final : public CommandRecorder {
+    public:
+        explicit NullCommandRecorder(CommandStream& stream);
+        ~NullCommandRecorder() override = default;
+
+        NullCommandRecorder(const NullCommandRecorder&) = delete;
+        NullCommandRecorder(NullCommandRecorder&&) = delete;
+
+        using CommandRecorder::SetRootConstants;
+
+        void ResourceBarrier(std::span<const ResourceTransition> transitions) override;
+        void SetPipeline(PipelineHandle pipeline) override;
+        void SetViewport(const Viewport& viewport) override;
+        void SetScissorRect(const ScissorRect& rect) override;
+        void SetRenderTarget(ResourceHandle texture) override;
+        void ClearRenderTarget(ResourceHandle texture, const std::array<float, 4>& color, const ScissorRect* pRect = nullptr) override;
+        void SetRootConstants(uint32_t rootIndex, std::span<const uint32_t> values, uint32_t offset = 0) override;
+        void SetShaderResource(uint32_t rootIndex, ResourceHandle texture) override;
+        void SetVertexBuffer(const VertexBufferView& view) override;
+        void Draw(uint32_t vertexCount, uint32_t instanceCount = 1, uint32_t firstVertex = 0, uint32_t firstInstance = 0) override;
+        void ExecuteIndirect(CommandSignatureHandle signature, uint32_t maxCommandCount,
+                             ResourceHandle argumentBuffer, uint64_t argumentOffset,
+                             ResourceHandle countBuffer = {}, uint64_t countOffset = 0) override;
+
+        [[nodiscard]] inline CommandStream& GetStream() const;
+
+        NullCommandRecorder& operator=(const NullCommandRecorder&) = delete;
+        NullCommandRecorder& operator=(NullCommandRecorder&&) = delete;
+
+    private:
+        CommandStream& m_Stream;
+    };
+}
+
+#include <D3D12Engine/RHI/Null/NullCommandRecorder.inl>
+
+#endif // DE_RHI_NULL_NULLCOMMANDRECORDER_HPP
@@ -0,0 +1,77 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef DE_RHI_NULL_NULLRENDERDEVICE_HPP
+#define DE_RHI_NULL_NULLRENDERDEVICE_HPP
+
+#include <D3D12Engine/RHI/RenderDevice.hpp>
+
+#include <span>
+#include <string>
+#include <vector>
+
+namespace D3D12Engine {
+    // Device without a GPU. Buffers that can be mapped get CPU memory so the code
+    // filling them runs for real, everything else only keeps its description.
+    class NullRenderDevice final : public RenderDevice {
+    public:
+        NullRenderDevice() = default;
+        ~NullRenderDevice() override = default;
+
+        NullRenderDevice(const NullRenderDevice&) = delete;
+        NullRenderDevice(NullRenderDevice&&) = delete;
+
+        ResourceHandle CreateBuffer(const BufferDesc& desc) override;
+        ResourceHandle CreateTexture(const TextureDesc& desc) override;
+        void DestroyResource(ResourceHandle resource) override;
+
+        uint8_t* Map(ResourceHandle buffer) override;
+        void Unmap(ResourceHandle buffer) override;
+        void SetDebugName(ResourceHandle resource, std::string_view name) override;
+
+        PipelineHandle CreatePipeline(const PipelineDesc& desc) override;
+        void ReplacePipeline(PipelineHandle pipeline, const PipelineDesc& desc) override;
+
+        CommandSignatureHandle CreateCommandSignature(const CommandSignatureDesc& desc) override;
+
+        [[nodiscard]] inline bool IsAlive(ResourceHandle resource) const;
+        [[nodiscard]] inline uint32_t GetLiveResourceCount() const;
+        [[nodiscard]] inline const std::string& GetPipelineName(PipelineHandle pipeline) const;
+        [[nodiscard]] inline const CommandSignatureDesc& GetCommandSignature(CommandSignatureHandle signature) const;
+        // Contents of an upload or readback buffer, used to inspect indirect arguments.
+        [[nodiscard]] inline std::span<const uint8_t> GetBufferData(ResourceHandle buffer) const;
+
+        NullRenderDevice& operator=(const NullRenderDevice&) = delete;
+        NullRenderDevice& operator=(NullRenderDevice&&) = delete;
+
+    private:
+        struct Pipeline {
+            std::string Name;
+            std::vector<RootParameterDesc> RootParameters;
+        };
+
+        struct Resource {
+            BufferDesc Buffer;
+            TextureDesc Texture;
+            std::vector<uint8_t> Memory;
+            bool IsBuffer = false;
+            bool Alive = false;
+            bool Mapped = false;
+        };
+
+        ResourceHandle Allocate();
+
+        std::vector<Resource> m_Resources;
+        std::vector<uint32_t> m_FreeResources;
+        std::vector<Pipeline> m_Pipelines;
+        std::vector<CommandSignatureDesc> m_CommandSignatures;
+        uint32_t m_LiveResourceCount = 0;
+    };
+}
+
+#include <D3D12Engine/RHI/Null/NullRenderDevice.inl>
+
+#endif // DE_RHI_NULL_NULLRENDERDEVICE_HPP
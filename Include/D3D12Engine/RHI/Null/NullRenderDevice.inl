@@ -0,0 +1,27 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+namespace D3D12Engine {
+    inline bool NullRenderDevice::IsAlive(const ResourceHandle resource) const {
+        return resource.Index < m_Resources.size() && m_Resources[resource.Index].Alive;
+    }
+
+    inline uint32_t NullRenderDevice::GetLiveResourceCount() const {
+        return m_LiveResourceCount;
+    }
+
+    inline const std::string& NullRenderDevice::GetPipelineName(const PipelineHandle pipeline) const {
+        return m_Pipelines[pipeline.Index].Name;
+    }
+
+    inline const CommandSignatureDesc& NullRenderDevice::GetCommandSignature(const CommandSignatureHandle signature) const {
+        return m_CommandSignatures[signature.Index];
+    }
+
+    inline std::span<const uint8_t> NullRenderDevice::GetBufferData(const ResourceHandle buffer) const {
+        return m_Resources[buffer.Index].Memory;
+    }
+}
@@ -0,0 +1,65 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef DE_RHI_RENDERDEVICE_HPP
+#define DE_RHI_RENDERDEVICE_HPP
+
+#include <D3D12Engine/RHI/GpuMemoryStatistics.hpp>
+#include <D3D12Engine/RHI/ResourceStateRegistry.hpp>
+
+namespace D3D12Engine {
+    // Creates and owns GPU resources. Everything above the RHI refers to them through
+    // handles, which lets the same engine code run on the D3D12 backend or on the null
+    // backend, which only records what would have been done.
+    class RenderDevice {
+    public:
+        RenderDevice() = default;
+        virtual ~RenderDevice() = default;
+
+        RenderDevice(const RenderDevice&) = delete;
+        RenderDevice(RenderDevice&&) = delete;
+
+        virtual ResourceHandle CreateBuffer(const BufferDesc& desc) = 0;
+        virtual ResourceHandle CreateTexture(const TextureDesc& desc) = 0;
+        virtual void DestroyResource(ResourceHandle resource) = 0;
+
+        // Only valid for upload and readback buffers.
+        virtual uint8_t* Map(ResourceHandle buffer) = 0;
+        virtual void Unmap(ResourceHandle buffer) = 0;
+
+        // Name shown by debugging tools.
+        virtual void SetDebugName(ResourceHandle resource, std::string_view name) = 0;
+
+        // Pipelines live as long as the device.
+        virtual PipelineHandle CreatePipeline(const PipelineDesc& desc) = 0;
+        // Rebuilds the pipeline behind a handle, used when its shaders are reloaded. The root
+        // parameters must stay the same. The GPU must be done with the previous pipeline.
+        virtual void ReplacePipeline(PipelineHandle pipeline, const PipelineDesc& desc) = 0;
+
+        virtual CommandSignatureHandle CreateCommandSignature(const CommandSignatureDesc& desc) = 0;
+
+        // States resources are left in by the command lists submitted so far. Backends
+        // register the resources that can change state.
+        [[nodiscard]] inline ResourceStateRegistry& GetResourceStates();
+        [[nodiscard]] inline const ResourceStateRegistry& GetResourceStates() const;
+
+        // Memory taken by the resources created so far. Backends record their allocations,
+        // the frame's transient memory is recorded by whoever writes it.
+        [[nodiscard]] inline GpuMemoryStatistics& GetMemoryStatistics();
+        [[nodiscard]] inline const GpuMemoryStatistics& GetMemoryStatistics() const;
+
+        RenderDevice& operator=(const RenderDevice&) = delete;
+        RenderDevice& operator=(RenderDevice&&) = delete;
+
+    protected:
+        ResourceStateRegistry m_ResourceStates;
+        GpuMemoryStatistics m_MemoryStatistics;
+    };
+}
+
+#include <D3D12Engine/RHI/RenderDevice.inl>
+
+#endif // DE_RHI_RENDERDEVICE_HPP
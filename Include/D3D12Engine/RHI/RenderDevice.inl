@@ -0,0 +1,23 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+namespace D3D12Engine {
+    inline ResourceStateRegistry& RenderDevice::GetResourceStates() {
+        return m_ResourceStates;
+    }
+
+    inline const ResourceStateRegistry& RenderDevice::GetResourceStates() const {
+        return m_ResourceStates;
+    }
+
+    inline GpuMemoryStatistics& RenderDevice::GetMemoryStatistics() {
+        return m_MemoryStatistics;
+    }
+
+    inline const GpuMemoryStatistics& RenderDevice::GetMemoryStatistics() const {
+        return m_MemoryStatistics;
+    }
+}
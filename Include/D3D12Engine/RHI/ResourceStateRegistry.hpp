@@ -0,0 +1,46 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef DE_RHI_RESOURCESTATEREGISTRY_HPP
+#define DE_RHI_RESOURCESTATEREGISTRY_HPP
+
+#include <D3D12Engine/RHI/RhiTypes.hpp>
+
+#include <vector>
+
+namespace D3D12Engine {
+    // State every subresource is in once the command lists submitted so far have run.
+    // Resources that never change state, like upload and readback buffers, aren't
+    // registered and are ignored by the state trackers.
+    class ResourceStateRegistry {
+    public:
+        ResourceStateRegistry() = default;
+        ~ResourceStateRegistry() = default;
+
+        ResourceStateRegistry(const ResourceStateRegistry&) = delete;
+        ResourceStateRegistry(ResourceStateRegistry&&) = delete;
+
+        void Register(ResourceHandle resource, ResourceState state, uint32_t subresourceCount = 1);
+        void Unregister(ResourceHandle resource);
+
+        void SetState(ResourceHandle resource, ResourceState state, uint32_t subresource = ResourceTransition::AllSubresources);
+
+        [[nodiscard]] inline bool IsRegistered(ResourceHandle resource) const;
+        [[nodiscard]] inline uint32_t GetSubresourceCount(ResourceHandle resource) const;
+        [[nodiscard]] inline ResourceState GetState(ResourceHandle resource, uint32_t subresource = 0) const;
+
+        ResourceStateRegistry& operator=(const ResourceStateRegistry&) = delete;
+        ResourceStateRegistry& operator=(ResourceStateRegistry&&) = delete;
+
+    private:
+        // Indexed by handle, empty for resources that aren't registered.
+        std::vector<std::vector<ResourceState>> m_States;
+    };
+}
+
+#include <D3D12Engine/RHI/ResourceStateRegistry.inl>
+
+#endif // DE_RHI_RESOURCESTATEREGISTRY_HPP
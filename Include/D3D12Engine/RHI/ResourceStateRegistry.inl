@@ -0,0 +1,19 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+namespace D3D12Engine {
+    inline bool ResourceStateRegistry::IsRegistered(const ResourceHandle resource) const {
+        return resource.Index < m_States.size() && !m_States[resource.Index].empty();
+    }
+
+    inline uint32_t ResourceStateRegistry::GetSubresourceCount(const ResourceHandle resource) const {
+        return IsRegistered(resource) ? static_cast<uint32_t>(m_States[resource.Index].size()) : 0;
+    }
+
+    inline ResourceState ResourceStateRegistry::GetState(const ResourceHandle resource, const uint32_t subresource) const {
+        return m_States[resource.Index][subresource];
+    }
+}
@@ -0,0 +1,86 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef DE_RHI_RESOURCESTATETRACKER_HPP
+#define DE_RHI_RESOURCESTATETRACKER_HPP
+
+#include <D3D12Engine/RHI/CommandRecorder.hpp>
+#include <D3D12Engine/RHI/ResourceStateRegistry.hpp>
+
+#include <memory_resource>
+#include <span>
+#include <vector>
+
+namespace D3D12Engine {
+    // Tracks the state of resources while one command list is recorded. Commands declare
+    // the state they need with Require(), the transitions this takes are queued and
+    // emitted with a single barrier call by FlushBarriers(), right before the command.
+    // The state a resource is in when the list starts isn't known while recording, since
+    // lists recorded in parallel may be submitted in any order. The first use of each
+    // resource is kept aside instead and Resolve() turns it into a transition at submit.
+    class ResourceStateTracker {
+    public:
+        explicit ResourceStateTracker(ResourceStateRegistry& registry);
+        ~ResourceStateTracker() = default;
+
+        ResourceStateTracker(const ResourceStateTracker&) = delete;
+        ResourceStateTracker(ResourceStateTracker&&) = delete;
+
+        // Read states are combined when possible, anything else queues a transition. Queued
+        // transitions of the same subresource are merged, the state in between is never used.
+        void Require(ResourceHandle resource, ResourceState state, uint32_t subresource = ResourceTransition::AllSubresources);
+        // To call before each command that uses the resources required so far.
+        void FlushBarriers(CommandRecorder& recorder);
+
+        // To call when the command list is submitted, in submission order. Appends the
+        // transitions that must run before the list, from the registered states to the
+        // states it expects, then registers the states the list leaves resources in.
+        void Resolve(std::pmr::vector<ResourceTransition>& transitions);
+        // Starts a new command list, keeps the memory.
+        void Reset();
+
+        [[nodiscard]] inline std::span<const ResourceTransition> GetPendingBarriers() const;
+        // Transitions emitted since the last reset, and the barrier calls they took.
+        [[nodiscard]] inline uint32_t GetBarrierCount() const;
+        [[nodiscard]] inline uint32_t GetBarrierBatchCount() const;
+
+        ResourceStateTracker& operator=(const ResourceStateTracker&) = delete;
+        ResourceStateTracker& operator=(ResourceStateTracker&&) = delete;
+
+    private:
+        static constexpr ResourceState UnknownState = static_cast<ResourceState>(~0u);
+        static constexpr uint32_t NotTracked = ~0u;
+
+        struct TrackedResource {
+            ResourceHandle Resource;
+            // Range of m_States with the state of each subresource.
+            uint32_t FirstState;
+            uint32_t SubresourceCount;
+            // Index in m_Pending of the last transition queued for the resource, so merging
+            // doesn't search the whole batch.
+            uint32_t LastPending;
+        };
+
+        TrackedResource& GetTracked(ResourceHandle resource);
+        void RequireSubresource(TrackedResource& tracked, ResourceState& current, ResourceState state, uint32_t subresource);
+        void AddBarrier(TrackedResource& tracked, ResourceState before, ResourceState after, uint32_t subresource);
+
+        ResourceStateRegistry& m_Registry;
+        // Indexed by handle, index in m_Tracked of the resources used by this list.
+        std::vector<uint32_t> m_TrackedIndices;
+        std::vector<TrackedResource> m_Tracked;
+        std::vector<ResourceState> m_States;
+        std::vector<ResourceTransition> m_Pending;
+        // State needed at the first use of each subresource, Before is unknown until Resolve().
+        std::vector<ResourceTransition> m_FirstUses;
+        uint32_t m_BarrierCount = 0;
+        uint32_t m_BarrierBatchCount = 0;
+    };
+}
+
+#include <D3D12Engine/RHI/ResourceStateTracker.inl>
+
+#endif // DE_RHI_RESOURCESTATETRACKER_HPP
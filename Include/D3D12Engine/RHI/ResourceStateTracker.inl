@@ -0,0 +1,19 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+namespace D3D12Engine {
+    inline std::span<const ResourceTransition> ResourceStateTracker::GetPendingBarriers() const {
+        return m_Pending;
+    }
+
+    inline uint32_t ResourceStateTracker::GetBarrierCount() const {
+        return m_BarrierCount;
+    }
+
+    inline uint32_t ResourceStateTracker::GetBarrierBatchCount() const {
+        return m_BarrierBatchCount;
+    }
+}
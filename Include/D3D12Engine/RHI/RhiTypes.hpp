@@ -0,0 +1,203 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef DE_RHI_RHITYPES_HPP
+#define DE_RHI_RHITYPES_HPP
+
+#include <D3D12Engine/Assets/TextureFormat.hpp>
+#include <D3D12Engine/RHI/VertexLayout.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+namespace D3D12Engine {
+    // Index into a backend table, typed so handles of different kinds can't be mixed up.
+    template <typename Tag>
+    struct RhiHandle {
+        static constexpr uint32_t InvalidIndex = ~0u;
+
+        uint32_t Index = InvalidIndex;
+
+        [[nodiscard]] constexpr bool IsValid() const { return Index != InvalidIndex; }
+
+        bool operator==(const RhiHandle&) const = default;
+    };
+
+    using ResourceHandle = RhiHandle<struct ResourceHandleTag>;
+    using PipelineHandle = RhiHandle<struct PipelineHandleTag>;
+    using CommandSignatureHandle = RhiHandle<struct CommandSignatureHandleTag>;
+
+    // Same bits as D3D12_RESOURCE_STATES, so the D3D12 backend can cast them directly.
+    enum class ResourceState : uint32_t {
+        Common = 0,
+        Present = 0,
+        VertexAndConstantBuffer = 0x1,
+        IndexBuffer = 0x2,
+        RenderTarget = 0x4,
+        UnorderedAccess = 0x8,
+        DepthWrite = 0x10,
+        DepthRead = 0x20,
+        NonPixelShaderResource = 0x40,
+        PixelShaderResource = 0x80,
+        IndirectArgument = 0x200,
+        CopyDest = 0x400,
+        CopySource = 0x800,
+        GenericRead = 0x1 | 0x2 | 0x40 | 0x80 | 0x200 | 0x800
+    };
+
+    constexpr ResourceState operator|(ResourceState a, ResourceState b);
+    constexpr ResourceState operator&(ResourceState a, ResourceState b);
+    // True for states that only read, which can be combined and don't need barriers between them.
+    constexpr bool IsReadOnlyState(ResourceState state);
+
+    enum class MemoryType : uint8_t {
+        // GPU only memory.
+        Default,
+        // CPU writable, GPU readable.
+        Upload,
+        // GPU writable, CPU readable.
+        Readback
+    };
+
+    enum class BufferUsage : uint8_t {
+        // Anything else, only described by its memory type.
+        Generic,
+        Vertex,
+        Index
+    };
+
+    enum class TextureUsage : uint8_t {
+        ShaderResource = 0x1,
+        RenderTarget = 0x2
+    };
+
+    constexpr TextureUsage operator|(TextureUsage a, TextureUsage b);
+    constexpr bool HasUsage(TextureUsage usage, TextureUsage flag);
+
+    struct BufferDesc {
+        uint64_t Size = 0;
+        MemoryType Memory = MemoryType::Upload;
+        BufferUsage Usage = BufferUsage::Generic;
+        ResourceState InitialState = ResourceState::GenericRead;
+        // Only used at creation, the string doesn't need to outlive the call.
+        std::string_view Name;
+    };
+
+    struct TextureDesc {
+        uint32_t Width = 0;
+        uint32_t Height = 0;
+        TextureFormat Format = TextureFormat::R8G8B8A8Unorm;
+        TextureUsage Usage = TextureUsage::ShaderResource;
+        ResourceState InitialState = ResourceState::PixelShaderResource;
+        std::array<float, 4> ClearColor = {0.0f, 0.0f, 0.0f, 1.0f};
+        // Only used at creation, the string doesn't need to outlive the call.
+        std::string_view Name;
+    };
+
+    struct Viewport {
+        float X;
+        float Y;
+        float Width;
+        float Height;
+        float MinDepth = 0.0f;
+        float MaxDepth = 1.0f;
+    };
+
+    struct ScissorRect {
+        int32_t Left;
+        int32_t Top;
+        int32_t Right;
+        int32_t Bottom;
+    };
+
+    struct ResourceTransition {
+        static constexpr uint32_t AllSubresources = ~0u;
+
+        ResourceHandle Resource;
+        ResourceState Before;
+        ResourceState After;
+        // All subresources unless set.
+        uint32_t Subresource = AllSubresources;
+    };
+
+    struct VertexBufferView {
+        ResourceHandle Buffer;
+        uint32_t Stride = 0;
+        uint32_t Size = 0;
+    };
+
+    enum class PrimitiveTopology : uint8_t {
+        TriangleList,
+        TriangleStrip,
+        LineList
+    };
+
+    enum class ShaderVisibility : uint8_t {
+        All,
+        Vertex,
+        Pixel
+    };
+
+    enum class RootParameterType : uint8_t {
+        // 32 bit values set with SetRootConstants, read from register b<ShaderRegister>.
+        Constants,
+        // One texture set with SetShaderResource, read from register t<ShaderRegister>.
+        ShaderResource
+    };
+
+    struct RootParameterDesc {
+        RootParameterType Type = RootParameterType::Constants;
+        uint32_t ShaderRegister = 0;
+        // Only used by constants.
+        uint32_t ConstantCount = 0;
+        ShaderVisibility Visibility = ShaderVisibility::All;
+
+        bool operator==(const RootParameterDesc&) const = default;
+    };
+
+    // Graphics pipeline drawing into a single render target, without depth or blending.
+    // The root parameters are bound at the index they have here.
+    struct PipelineDesc {
+        // Compiled shaders, only used at creation.
+        std::span<const std::byte> VertexShader;
+        std::span<const std::byte> PixelShader;
+        // Vertex buffer elements in slot 0, empty when the vertex shader generates its vertices.
+        std::span<const VertexElement> InputLayout;
+        std::span<const RootParameterDesc> RootParameters;
+        // Adds a static linear clamp sampler at s0.
+        bool LinearClampSampler = false;
+        PrimitiveTopology Topology = PrimitiveTopology::TriangleList;
+        TextureFormat RenderTargetFormat = TextureFormat::R8G8B8A8Unorm;
+        // Only used at creation, the string doesn't need to outlive the call.
+        std::string_view Name;
+    };
+
+    // Same layout as D3D12_DRAW_ARGUMENTS.
+    struct IndirectDrawArguments {
+        uint32_t VertexCountPerInstance = 0;
+        uint32_t InstanceCount = 1;
+        uint32_t StartVertexLocation = 0;
+        uint32_t StartInstanceLocation = 0;
+    };
+
+    // Layout of one indirect command: RootConstantCount 32 bit root constants, if any,
+    // followed by IndirectDrawArguments.
+    struct CommandSignatureDesc {
+        // Pipeline whose root signature the root constants are written to.
+        PipelineHandle Pipeline;
+        uint32_t RootConstantsIndex = 0;
+        uint32_t RootConstantCount = 0;
+    };
+
+    [[nodiscard]] constexpr uint32_t GetCommandStride(const CommandSignatureDesc& desc);
+}
+
+#include <D3D12Engine/RHI/RhiTypes.inl>
+
+#endif // DE_RHI_RHITYPES_HPP
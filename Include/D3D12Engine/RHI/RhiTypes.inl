@@ -0,0 +1,32 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+namespace D3D12Engine {
+    constexpr ResourceState operator|(const ResourceState a, const ResourceState b) {
+        return static_cast<ResourceState>(static_cast<uint32_t>(a) | static_cast<uint32_t>(b));
+    }
+
+    constexpr ResourceState operator&(const ResourceState a, const ResourceState b) {
+        return static_cast<ResourceState>(static_cast<uint32_t>(a) & static_cast<uint32_t>(b));
+    }
+
+    constexpr bool IsReadOnlyState(const ResourceState state) {
+        // Common isn't a read state, using a resource in it goes through implicit promotion.
+        return state != ResourceState::Common && (state & (ResourceState::GenericRead | ResourceState::DepthRead)) == state;
+    }
+
+    constexpr TextureUsage operator|(const TextureUsage a, const TextureUsage b) {
+        return static_cast<TextureUsage>(static_cast<uint8_t>(a) | static_cast<uint8_t>(b));
+    }
+
+    constexpr bool HasUsage(const TextureUsage usage, const TextureUsage flag) {
+        return (static_cast<uint8_t>(usage) & static_cast<uint8_t>(flag)) != 0;
+    }
+
+    constexpr uint32_t GetCommandStride(const CommandSignatureDesc& desc) {
+        return desc.RootConstantCount * static_cast<uint32_t>(sizeof(uint32_t)) + static_cast<uint32_t>(sizeof(IndirectDrawArguments));
+    }
+}
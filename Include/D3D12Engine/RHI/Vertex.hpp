@@ -9,11 +9,28 @@
 
 #include <D3D12Engine/pch.hpp>
 
+#include <D3D12Engine/RHI/VertexLayout.hpp>
+
 namespace D3D12Engine {
     struct VertexPosColor {
         DirectX::XMFLOAT3 Position;
         DirectX::XMFLOAT4 Color;
     };
+
+    // Full precision layout matching VertexPosColor, 28 bytes per vertex.
+    using VertexPosColorLayout = VertexLayout<
+        VertexAttribute<"POSITION", VertexFormat::R32G32B32Float>,
+        VertexAttribute<"COLOR", VertexFormat::R32G32B32A32Float>
+    >;
+
+    static_assert(sizeof(VertexPosColor) == VertexPosColorLayout::Stride, "VertexPosColor must match its layout.");
+
+    // Quantized layout, 12 bytes per vertex. Positions are remapped to the mesh bounds,
+    // the vertex shader expands them back with the transform from the VertexQuantizer.
+    using VertexPosColorPacked = VertexLayout<
+        VertexAttribute<"POSITION", VertexFormat::R16G16B16A16Snorm>,
+        VertexAttribute<"COLOR", VertexFormat::R8G8B8A8Unorm>
+    >;
 }
 
 #endif // DE_RHI_VERTEX_HPP
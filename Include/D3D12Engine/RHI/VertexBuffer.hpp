@@ -7,19 +7,20 @@
 #ifndef DE_RHI_VERTEXBUFFER_HPP
 #define DE_RHI_VERTEXBUFFER_HPP
 
-#include <D3D12Engine/pch.hpp>
-
 #include <D3D12Engine/RHI/AbstractBuffer.hpp>
+#include <D3D12Engine/RHI/CommandRecorder.hpp>
 
 namespace D3D12Engine {
     template <typename T>
     class VertexBuffer final : public AbstractBuffer {
     public:
-        VertexBuffer(ID3D12Device* device, const T* data, size_t size);
-        void Apply(ID3D12GraphicsCommandList* commandList) const;
+        VertexBuffer(RenderDevice& device, const T* data, size_t size);
+        void Apply(CommandRecorder& recorder) const;
+
+        [[nodiscard]] inline const VertexBufferView& GetView() const;
 
     private:
-        D3D12_VERTEX_BUFFER_VIEW m_BufferView;
+        VertexBufferView m_BufferView;
     };
 }
 
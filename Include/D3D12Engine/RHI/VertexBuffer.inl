@@ -4,31 +4,39 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <cstring>
 #include <format>
-
-#include <D3D12Engine/RHI/DxUtils.hpp>
+#include <typeinfo>
 
 namespace D3D12Engine {
     template <typename T>
-    VertexBuffer<T>::VertexBuffer(ID3D12Device* device, const T* data, size_t size)
-        : AbstractBuffer(device, size) {
-        auto name = std::format("Vertex buffer of size {}B and type {}", size, typeid(T).name());
-        const std::wstring wName(name.begin(), name.end());
-        ThrowIfFailed(m_Buffer->SetName(wName.c_str()));
-        UINT8* pVertexDataBegin;
+    VertexBuffer<T>::VertexBuffer(RenderDevice& device, const T* data, size_t size)
+        : AbstractBuffer(device, size, BufferUsage::Vertex) {
+        // Formatted on the stack, long type names get truncated.
+        std::array<char, 256> name;
+        const auto result = std::format_to_n(name.data(), name.size(), "Vertex buffer of size {}B and type {}", size, typeid(T).name());
+        m_Device.SetDebugName(m_Buffer, {name.data(), std::min(static_cast<size_t>(result.size), name.size())});
+
+        uint8_t* pVertexDataBegin;
 
         Map(&pVertexDataBegin);
         memcpy(pVertexDataBegin, data, size);
         Unmap();
 
-        m_BufferView.BufferLocation = m_Buffer->GetGPUVirtualAddress();
-        m_BufferView.StrideInBytes = sizeof(T);
-        m_BufferView.SizeInBytes = size;
+        m_BufferView.Buffer = m_Buffer;
+        m_BufferView.Stride = sizeof(T);
+        m_BufferView.Size = static_cast<uint32_t>(size);
     }
 
     template <typename T>
-    void VertexBuffer<T>::Apply(ID3D12GraphicsCommandList* commandList) const {
-        commandList->IASetVertexBuffers(0, 1, &m_BufferView);
+    void VertexBuffer<T>::Apply(CommandRecorder& recorder) const {
+        recorder.SetVertexBuffer(m_BufferView);
     }
 
+    template <typename T>
+    inline const VertexBufferView& VertexBuffer<T>::GetView() const {
+        return m_BufferView;
+    }
 }
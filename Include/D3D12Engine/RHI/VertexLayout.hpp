@@ -0,0 +1,138 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef DE_RHI_VERTEXLAYOUT_HPP
+#define DE_RHI_VERTEXLAYOUT_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <tuple>
+#include <utility>
+
+namespace D3D12Engine {
+    // Vertex attribute formats. The values match DXGI_FORMAT so they can be cast into
+    // input element descriptions, but the layouts themselves don't need any Windows header.
+    enum class VertexFormat : uint32_t {
+        R32G32B32A32Float = 2,
+        R32G32B32Float = 6,
+        R16G16B16A16Float = 10,
+        R16G16B16A16Unorm = 11,
+        R16G16B16A16Snorm = 13,
+        R32G32Float = 16,
+        R8G8B8A8Unorm = 28,
+        R8G8B8A8Snorm = 31,
+        R16G16Float = 34,
+        R16G16Unorm = 35,
+        R16G16Snorm = 37,
+        R32Float = 41
+    };
+
+    enum class VertexComponentType : uint8_t {
+        Float32,
+        Float16,
+        Unorm16,
+        Snorm16,
+        Unorm8,
+        Snorm8
+    };
+
+    struct VertexFormatInfo {
+        VertexComponentType ComponentType;
+        uint32_t ComponentCount;
+        uint32_t Size;
+    };
+
+    constexpr VertexFormatInfo GetVertexFormatInfo(VertexFormat format);
+    constexpr bool IsNormalized(VertexComponentType type);
+
+    // String literal usable as a template argument, for semantic names.
+    template <size_t N>
+    struct VertexSemantic {
+        char Name[N];
+
+        constexpr VertexSemantic(const char (&name)[N]);
+    };
+
+    template <VertexSemantic Semantic, VertexFormat Format, uint32_t SemanticIndex = 0>
+    struct VertexAttribute {
+        static constexpr const char* Name = Semantic.Name;
+        static constexpr VertexFormat AttributeFormat = Format;
+        static constexpr uint32_t Index = SemanticIndex;
+        static constexpr VertexFormatInfo Info = GetVertexFormatInfo(Format);
+    };
+
+    // API neutral description of one element, pipelines take these as their input layout.
+    struct VertexElement {
+        const char* SemanticName;
+        uint32_t SemanticIndex;
+        VertexFormat Format;
+        uint32_t Offset;
+    };
+
+    // Compile-time vertex layout. Attributes are tightly packed in declaration order,
+    // the layout provides the matching vertex struct and the element descriptions,
+    // so the C++ side and the input layout can't drift apart.
+    template <typename... Attributes>
+    class VertexLayout {
+    public:
+        static constexpr size_t AttributeCount = sizeof...(Attributes);
+        static constexpr uint32_t Stride = (0 + ... + Attributes::Info.Size);
+        static constexpr std::array<uint32_t, AttributeCount> Offsets = [] {
+            std::array<uint32_t, AttributeCount> offsets{};
+            uint32_t offset = 0;
+            size_t i = 0;
+            ((offsets[i++] = offset, offset += Attributes::Info.Size), ...);
+            return offsets;
+        }();
+        static constexpr std::array<VertexElement, AttributeCount> Elements = [] {
+            size_t i = 0;
+            return std::array<VertexElement, AttributeCount>{
+                VertexElement{Attributes::Name, Attributes::Index, Attributes::AttributeFormat, Offsets[i++]}...
+            };
+        }();
+
+        template <size_t I>
+        using Attribute = std::tuple_element_t<I, std::tuple<Attributes...>>;
+
+        static_assert(AttributeCount > 0, "A vertex layout needs at least one attribute.");
+        static_assert(Stride % 4 == 0, "Vertex attributes must keep 4 byte alignment.");
+
+        struct Vertex {
+            alignas(4) std::byte Data[Stride];
+
+            // Encodes up to four components, missing ones are taken from padding (0, 0, 0, 1).
+            template <size_t I>
+            void Set(std::span<const float> values);
+
+            // Decodes the attribute, components the format doesn't have are set from the padding.
+            template <size_t I>
+            [[nodiscard]] std::array<float, 4> Get() const;
+        };
+
+        static_assert(sizeof(Vertex) == Stride, "Vertex storage must be tightly packed.");
+
+        VertexLayout() = delete;
+    };
+
+    // Converts single components to and from their stored representation.
+    namespace VertexEncoding {
+        constexpr std::array<float, 4> Padding = {0.0f, 0.0f, 0.0f, 1.0f};
+
+        inline uint16_t FloatToHalf(float value);
+        inline float HalfToFloat(uint16_t value);
+
+        inline void EncodeComponent(VertexComponentType type, float value, std::byte* pDestination);
+        inline float DecodeComponent(VertexComponentType type, const std::byte* pSource);
+        // Value the component will actually hold once stored, useful to measure the error.
+        inline float QuantizeComponent(VertexComponentType type, float value);
+    }
+}
+
+#include <D3D12Engine/RHI/VertexLayout.inl>
+
+#endif // DE_RHI_VERTEXLAYOUT_HPP
@@ -0,0 +1,225 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstring>
+
+namespace D3D12Engine {
+    constexpr VertexFormatInfo GetVertexFormatInfo(const VertexFormat format) {
+        switch (format) {
+        case VertexFormat::R32G32B32A32Float:
+            return {VertexComponentType::Float32, 4, 16};
+        case VertexFormat::R32G32B32Float:
+            return {VertexComponentType::Float32, 3, 12};
+        case VertexFormat::R32G32Float:
+            return {VertexComponentType::Float32, 2, 8};
+        case VertexFormat::R32Float:
+            return {VertexComponentType::Float32, 1, 4};
+        case VertexFormat::R16G16B16A16Float:
+            return {VertexComponentType::Float16, 4, 8};
+        case VertexFormat::R16G16B16A16Unorm:
+            return {VertexComponentType::Unorm16, 4, 8};
+        case VertexFormat::R16G16B16A16Snorm:
+            return {VertexComponentType::Snorm16, 4, 8};
+        case VertexFormat::R16G16Float:
+            return {VertexComponentType::Float16, 2, 4};
+        case VertexFormat::R16G16Unorm:
+            return {VertexComponentType::Unorm16, 2, 4};
+        case VertexFormat::R16G16Snorm:
+            return {VertexComponentType::Snorm16, 2, 4};
+        case VertexFormat::R8G8B8A8Unorm:
+            return {VertexComponentType::Unorm8, 4, 4};
+        case VertexFormat::R8G8B8A8Snorm:
+            return {VertexComponentType::Snorm8, 4, 4};
+        }
+
+        return {VertexComponentType::Float32, 0, 0};
+    }
+
+    constexpr bool IsNormalized(const VertexComponentType type) {
+        return type != VertexComponentType::Float32 && type != VertexComponentType::Float16;
+    }
+
+    template <size_t N>
+    constexpr VertexSemantic<N>::VertexSemantic(const char (&name)[N]) : Name{} {
+        std::copy_n(name, N, Name);
+    }
+
+    template <typename... Attributes>
+    template <size_t I>
+    void VertexLayout<Attributes...>::Vertex::Set(const std::span<const float> values) {
+        constexpr VertexFormatInfo info = Attribute<I>::Info;
+        constexpr uint32_t componentSize = info.Size / info.ComponentCount;
+
+        std::byte* pDestination = Data + Offsets[I];
+        for (uint32_t component = 0; component < info.ComponentCount; component++) {
+            const float value = component < values.size() ? values[component] : VertexEncoding::Padding[component];
+            VertexEncoding::EncodeComponent(info.ComponentType, value, pDestination + component * componentSize);
+        }
+    }
+
+    template <typename... Attributes>
+    template <size_t I>
+    std::array<float, 4> VertexLayout<Attributes...>::Vertex::Get() const {
+        constexpr VertexFormatInfo info = Attribute<I>::Info;
+        constexpr uint32_t componentSize = info.Size / info.ComponentCount;
+
+        std::array<float, 4> values = VertexEncoding::Padding;
+        const std::byte* pSource = Data + Offsets[I];
+        for (uint32_t component = 0; component < info.ComponentCount; component++) {
+            values[component] = VertexEncoding::DecodeComponent(info.ComponentType, pSource + component * componentSize);
+        }
+
+        return values;
+    }
+
+    namespace VertexEncoding {
+        inline uint16_t FloatToHalf(const float value) {
+            const auto bits = std::bit_cast<uint32_t>(value);
+            const auto sign = static_cast<uint16_t>((bits >> 16) & 0x8000u);
+            const uint32_t absolute = bits & 0x7fffffffu;
+
+            if (absolute >= 0x7f800000u) {
+                // Infinity stays infinity, NaN stays a quiet NaN.
+                return static_cast<uint16_t>(sign | (absolute > 0x7f800000u ? 0x7e00u : 0x7c00u));
+            }
+
+            if (absolute >= 0x477ff000u) {
+                // Rounds to a value above the largest half.
+                return static_cast<uint16_t>(sign | 0x7c00u);
+            }
+
+            if (absolute < 0x38800000u) {
+                // Denormal half: shift the mantissa with its implicit bit, rounding to nearest even.
+                if (absolute < 0x33000000u) {
+                    return sign;
+                }
+
+                const uint32_t exponent = absolute >> 23;
+                const uint32_t mantissa = (absolute & 0x7fffffu) | 0x800000u;
+                const uint32_t shift = 126 - exponent;
+                uint32_t half = mantissa >> shift;
+                const uint32_t remainder = mantissa & ((1u << shift) - 1);
+                const uint32_t halfway = 1u << (shift - 1);
+                if (remainder > halfway || (remainder == halfway && (half & 1u))) {
+                    half++;
+                }
+
+                return static_cast<uint16_t>(sign | half);
+            }
+
+            // Normal half: rebias the exponent and round the mantissa to nearest even.
+            const uint32_t rebiased = absolute - 0x38000000u;
+            uint32_t half = rebiased >> 13;
+            const uint32_t remainder = rebiased & 0x1fffu;
+            if (remainder > 0x1000u || (remainder == 0x1000u && (half & 1u))) {
+                half++;
+            }
+
+            return static_cast<uint16_t>(sign | half);
+        }
+
+        inline float HalfToFloat(const uint16_t value) {
+            const uint32_t sign = static_cast<uint32_t>(value & 0x8000u) << 16;
+            const uint32_t exponent = (value >> 10) & 0x1fu;
+            const uint32_t mantissa = value & 0x3ffu;
+
+            if (exponent == 0) {
+                // Zero or denormal.
+                const float magnitude = std::ldexp(static_cast<float>(mantissa), -24);
+                return sign ? -magnitude : magnitude;
+            }
+
+            if (exponent == 0x1f) {
+                return std::bit_cast<float>(sign | 0x7f800000u | (mantissa << 13));
+            }
+
+            return std::bit_cast<float>(sign | ((exponent + 112) << 23) | (mantissa << 13));
+        }
+
+        inline void EncodeComponent(const VertexComponentType type, const float value, std::byte* pDestination) {
+            switch (type) {
+            case VertexComponentType::Float32:
+                std::memcpy(pDestination, &value, sizeof(float));
+                break;
+            case VertexComponentType::Float16:
+                {
+                    const uint16_t half = FloatToHalf(value);
+                    std::memcpy(pDestination, &half, sizeof(half));
+                }
+                break;
+            case VertexComponentType::Unorm16:
+                {
+                    const auto stored = static_cast<uint16_t>(std::lround(std::clamp(value, 0.0f, 1.0f) * 65535.0f));
+                    std::memcpy(pDestination, &stored, sizeof(stored));
+                }
+                break;
+            case VertexComponentType::Snorm16:
+                {
+                    const auto stored = static_cast<int16_t>(std::lround(std::clamp(value, -1.0f, 1.0f) * 32767.0f));
+                    std::memcpy(pDestination, &stored, sizeof(stored));
+                }
+                break;
+            case VertexComponentType::Unorm8:
+                {
+                    const auto stored = static_cast<uint8_t>(std::lround(std::clamp(value, 0.0f, 1.0f) * 255.0f));
+                    std::memcpy(pDestination, &stored, sizeof(stored));
+                }
+                break;
+            case VertexComponentType::Snorm8:
+                {
+                    const auto stored = static_cast<int8_t>(std::lround(std::clamp(value, -1.0f, 1.0f) * 127.0f));
+                    std::memcpy(pDestination, &stored, sizeof(stored));
+                }
+                break;
+            }
+        }
+
+        inline float DecodeComponent(const VertexComponentType type, const std::byte* pSource) {
+            switch (type) {
+            case VertexComponentType::Float32:
+                {
+                    float value;
+                    std::memcpy(&value, pSource, sizeof(value));
+                    return value;
+                }
+            case VertexComponentType::Float16:
+                {
+                    uint16_t half;
+                    std::memcpy(&half, pSource, sizeof(half));
+                    return HalfToFloat(half);
+                }
+            case VertexComponentType::Unorm16:
+                {
+                    uint16_t stored;
+                    std::memcpy(&stored, pSource, sizeof(stored));
+                    return static_cast<float>(stored) / 65535.0f;
+                }
+            case VertexComponentType::Snorm16:
+                {
+                    int16_t stored;
+                    std::memcpy(&stored, pSource, sizeof(stored));
+                    // Both -32768 and -32767 map to -1, like the hardware does.
+                    return std::max(static_cast<float>(stored) / 32767.0f, -1.0f);
+                }
+            case VertexComponentType::Unorm8:
+                return static_cast<float>(static_cast<uint8_t>(*pSource)) / 255.0f;
+            case VertexComponentType::Snorm8:
+                return std::max(static_cast<float>(static_cast<int8_t>(*pSource)) / 127.0f, -1.0f);
+            }
+
+            return 0.0f;
+        }
+
+        inline float QuantizeComponent(const VertexComponentType type, const float value) {
+            std::byte stored[sizeof(float)];
+            EncodeComponent(type, value, stored);
+            return DecodeComponent(type, stored);
+        }
+    }
+}
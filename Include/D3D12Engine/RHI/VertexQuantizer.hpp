@@ -0,0 +1,63 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef DE_RHI_VERTEXQUANTIZER_HPP
+#define DE_RHI_VERTEXQUANTIZER_HPP
+
+#include <D3D12Engine/RHI/VertexLayout.hpp>
+
+#include <vector>
+
+namespace D3D12Engine {
+    // One source attribute: ComponentCount floats per vertex, Stride floats apart.
+    struct VertexAttributeStream {
+        const float* Data;
+        size_t Stride;
+        uint32_t ComponentCount;
+        // Remaps the attribute to the full range of a normalized format using its bounds,
+        // the shader undoes it with the transform reported in the result. Used for positions.
+        bool RemapToBounds = false;
+    };
+
+    // Decoded value = stored value * Scale + Offset, per component.
+    struct VertexAttributeTransform {
+        std::array<float, 4> Scale = {1.0f, 1.0f, 1.0f, 1.0f};
+        std::array<float, 4> Offset = {0.0f, 0.0f, 0.0f, 0.0f};
+    };
+
+    // Errors are measured in source units, after applying the transform back.
+    struct VertexQuantizationError {
+        float MaxError = 0.0f;
+        float RmsError = 0.0f;
+    };
+
+    template <typename Layout>
+    struct QuantizedVertices {
+        std::vector<typename Layout::Vertex> Vertices;
+        std::array<VertexAttributeTransform, Layout::AttributeCount> Transforms;
+        std::array<VertexQuantizationError, Layout::AttributeCount> Errors;
+        size_t SourceByteSize = 0;
+        size_t ByteSize = 0;
+    };
+
+    // Packs float vertex data into a compact layout and reports how much precision was lost.
+    template <typename Layout>
+    class VertexQuantizer {
+    public:
+        VertexQuantizer() = delete;
+
+        // Expects one stream per attribute of the layout, in the same order.
+        static QuantizedVertices<Layout> Quantize(std::span<const VertexAttributeStream> streams, size_t vertexCount);
+
+    private:
+        template <size_t I>
+        static void QuantizeAttribute(const VertexAttributeStream& stream, size_t vertexCount, QuantizedVertices<Layout>& result);
+    };
+}
+
+#include <D3D12Engine/RHI/VertexQuantizer.inl>
+
+#endif // DE_RHI_VERTEXQUANTIZER_HPP
@@ -0,0 +1,97 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <limits>
+#include <stdexcept>
+
+namespace D3D12Engine {
+    template <typename Layout>
+    QuantizedVertices<Layout> VertexQuantizer<Layout>::Quantize(const std::span<const VertexAttributeStream> streams, const size_t vertexCount) {
+        if (streams.size() != Layout::AttributeCount) {
+            throw std::invalid_argument("Expected one vertex stream per layout attribute.");
+        }
+
+        QuantizedVertices<Layout> result;
+        result.Vertices.resize(vertexCount);
+        result.ByteSize = vertexCount * Layout::Stride;
+
+        [&]<size_t... I>(std::index_sequence<I...>) {
+            (QuantizeAttribute<I>(streams[I], vertexCount, result), ...);
+        }(std::make_index_sequence<Layout::AttributeCount>());
+
+        for (const auto& stream : streams) {
+            result.SourceByteSize += vertexCount * stream.ComponentCount * sizeof(float);
+        }
+
+        return result;
+    }
+
+    template <typename Layout>
+    template <size_t I>
+    void VertexQuantizer<Layout>::QuantizeAttribute(const VertexAttributeStream& stream, const size_t vertexCount,
+                                                    QuantizedVertices<Layout>& result) {
+        constexpr VertexFormatInfo info = Layout::template Attribute<I>::Info;
+        const uint32_t componentCount = std::min(stream.ComponentCount, 4u);
+
+        // Work out the remap so the bounds of each component fill the normalized range.
+        VertexAttributeTransform& transform = result.Transforms[I];
+        if (stream.RemapToBounds && IsNormalized(info.ComponentType)) {
+            const bool isSigned = info.ComponentType == VertexComponentType::Snorm16 || info.ComponentType == VertexComponentType::Snorm8;
+
+            for (uint32_t component = 0; component < componentCount; component++) {
+                float minimum = std::numeric_limits<float>::max();
+                float maximum = std::numeric_limits<float>::lowest();
+                for (size_t vertex = 0; vertex < vertexCount; vertex++) {
+                    const float value = stream.Data[vertex * stream.Stride + component];
+                    minimum = std::min(minimum, value);
+                    maximum = std::max(maximum, value);
+                }
+
+                if (vertexCount == 0) {
+                    continue;
+                }
+
+                const float extent = maximum - minimum;
+                if (isSigned) {
+                    transform.Scale[component] = extent > 0.0f ? extent * 0.5f : 1.0f;
+                    transform.Offset[component] = (minimum + maximum) * 0.5f;
+                } else {
+                    transform.Scale[component] = extent > 0.0f ? extent : 1.0f;
+                    transform.Offset[component] = minimum;
+                }
+            }
+        }
+
+        double squaredErrorSum = 0.0;
+        float maxError = 0.0f;
+
+        for (size_t vertex = 0; vertex < vertexCount; vertex++) {
+            const float* pSource = stream.Data + vertex * stream.Stride;
+
+            std::array<float, 4> encoded = VertexEncoding::Padding;
+            for (uint32_t component = 0; component < componentCount; component++) {
+                encoded[component] = (pSource[component] - transform.Offset[component]) / transform.Scale[component];
+            }
+
+            auto& packed = result.Vertices[vertex];
+            packed.template Set<I>(std::span<const float>(encoded.data(), std::max(componentCount, info.ComponentCount)));
+
+            const std::array<float, 4> decoded = packed.template Get<I>();
+            for (uint32_t component = 0; component < componentCount; component++) {
+                const float value = component < info.ComponentCount
+                                        ? decoded[component] * transform.Scale[component] + transform.Offset[component]
+                                        : 0.0f;
+                const float error = std::abs(value - pSource[component]);
+                maxError = std::max(maxError, error);
+                squaredErrorSum += static_cast<double>(error) * error;
+            }
+        }
+
+        const size_t sampleCount = vertexCount * componentCount;
+        result.Errors[I].MaxError = maxError;
+        result.Errors[I].RmsError = sampleCount > 0 ? static_cast<float>(std::sqrt(squaredErrorSum / static_cast<double>(sampleCount))) : 0.0f;
+    }
+}
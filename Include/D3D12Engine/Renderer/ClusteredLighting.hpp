@@ -0,0 +1,122 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef DE_RENDERER_CLUSTEREDLIGHTING_HPP
+#define DE_RENDERER_CLUSTEREDLIGHTING_HPP
+
+#include <D3D12Engine/Core/JobSystem.hpp>
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace D3D12Engine {
+    struct ClusterGridSettings {
+        uint32_t TileCountX = 16;
+        uint32_t TileCountY = 9;
+        // Depth slices, spaced exponentially between the near and far planes.
+        uint32_t SliceCount = 24;
+        // Lights past this in a cluster are dropped and counted in the overflow.
+        uint32_t MaxLightsPerCluster = 256;
+    };
+
+    // Same layout as PointLight in clusters.hlsli. The position is in view space.
+    struct PointLight {
+        std::array<float, 3> Position;
+        float Radius;
+        std::array<float, 3> Color;
+        float Intensity;
+    };
+
+    // Range of the light index list used by one cluster.
+    struct ClusterCell {
+        uint32_t Offset;
+        uint32_t Count;
+    };
+
+    // Same layout as the ClusterConstants constant buffer in clusters.hlsli.
+    struct ClusterShaderConstants {
+        float TanHalfFovX;
+        float TanHalfFovY;
+        // slice = log(z) * DepthSliceScale + DepthSliceBias
+        float DepthSliceScale;
+        float DepthSliceBias;
+        uint32_t TileCountX;
+        uint32_t TileCountY;
+        uint32_t SliceCount;
+        uint32_t LightCount;
+    };
+
+    // Clustered forward lighting: the view frustum is split into a grid of froxels, tiles
+    // on screen times exponential depth slices, and each froxel gets the list of the lights
+    // touching it. Shaders then find the lights of a pixel from its view space position.
+    // The view space is left handed, looking down +z, with +y up.
+    // Binning runs per depth slice on the job system. Each slice gets the lights overlapping
+    // its depth range, narrows them to the tiles their bounds project to, then tests the
+    // sphere against the box of each of those clusters, four clusters at a time with SSE.
+    class LightBinner {
+    public:
+        explicit LightBinner(const ClusterGridSettings& settings = {});
+        ~LightBinner() = default;
+
+        LightBinner(const LightBinner&) = delete;
+        LightBinner(LightBinner&&) = delete;
+
+        // Rebuilds the cluster bounds, to call when the projection changes.
+        void SetProjection(float verticalFov, float aspectRatio, float nearZ, float farZ);
+
+        // Fills the cells and the light index list. Without a job system, runs on the calling thread.
+        void Bin(std::span<const PointLight> lights, JobSystem* pJobSystem = nullptr);
+
+        [[nodiscard]] uint32_t GetClusterIndex(const std::array<float, 3>& viewPosition) const;
+
+        [[nodiscard]] inline uint32_t GetClusterCount() const;
+        [[nodiscard]] inline std::span<const ClusterCell> GetCells() const;
+        [[nodiscard]] inline std::span<const uint32_t> GetLightIndices() const;
+        // Light indices dropped by the last Bin() because their cluster was full.
+        [[nodiscard]] inline uint32_t GetOverflowCount() const;
+        [[nodiscard]] inline const ClusterShaderConstants& GetShaderConstants() const;
+        [[nodiscard]] inline const ClusterGridSettings& GetSettings() const;
+
+        LightBinner& operator=(const LightBinner&) = delete;
+        LightBinner& operator=(LightBinner&&) = delete;
+
+    private:
+        void BinSlice(std::span<const PointLight> lights, uint32_t slice);
+        void BinRow(uint32_t firstCluster, uint32_t tileCount, const PointLight& light, uint32_t lightIndex, uint32_t& overflow);
+        [[nodiscard]] uint32_t GetTileX(float ndcX) const;
+        [[nodiscard]] uint32_t GetTileY(float ndcY) const;
+
+        ClusterGridSettings m_Settings;
+        ClusterShaderConstants m_Constants;
+        uint32_t m_ClusterCount;
+        // Depth of each slice boundary, SliceCount + 1 of them.
+        std::vector<float> m_SliceDepths;
+
+        // View space box of each cluster, one array per component so four clusters load at
+        // once. Padded so the last row can be read four clusters at a time.
+        std::vector<float> m_MinX;
+        std::vector<float> m_MinY;
+        std::vector<float> m_MinZ;
+        std::vector<float> m_MaxX;
+        std::vector<float> m_MaxY;
+        std::vector<float> m_MaxZ;
+
+        // MaxLightsPerCluster slots per cluster, compacted into m_LightIndices once every slice is done.
+        std::vector<uint32_t> m_Slots;
+        std::vector<uint32_t> m_SlotCounts;
+        std::vector<uint32_t> m_SliceOverflow;
+
+        std::vector<ClusterCell> m_Cells;
+        std::vector<uint32_t> m_LightIndices;
+        uint32_t m_OverflowCount = 0;
+    };
+}
+
+#include <D3D12Engine/Renderer/ClusteredLighting.inl>
+
+#endif // DE_RENDERER_CLUSTEREDLIGHTING_HPP
@@ -0,0 +1,31 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+namespace D3D12Engine {
+    inline uint32_t LightBinner::GetClusterCount() const {
+        return m_ClusterCount;
+    }
+
+    inline std::span<const ClusterCell> LightBinner::GetCells() const {
+        return m_Cells;
+    }
+
+    inline std::span<const uint32_t> LightBinner::GetLightIndices() const {
+        return m_LightIndices;
+    }
+
+    inline uint32_t LightBinner::GetOverflowCount() const {
+        return m_OverflowCount;
+    }
+
+    inline const ClusterShaderConstants& LightBinner::GetShaderConstants() const {
+        return m_Constants;
+    }
+
+    inline const ClusterGridSettings& LightBinner::GetSettings() const {
+        return m_Settings;
+    }
+}
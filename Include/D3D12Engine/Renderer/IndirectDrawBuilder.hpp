@@ -0,0 +1,68 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef DE_RENDERER_INDIRECTDRAWBUILDER_HPP
+#define DE_RENDERER_INDIRECTDRAWBUILDER_HPP
+
+#include <D3D12Engine/RHI/RhiTypes.hpp>
+#include <D3D12Engine/RHI/VertexQuantizer.hpp>
+
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace D3D12Engine {
+    // One indirect scene draw: the position dequantization transform, written to the
+    // scene root constants, then the draw arguments.
+    struct IndirectDrawCommand {
+        VertexAttributeTransform PositionTransform;
+        IndirectDrawArguments Draw;
+    };
+
+    // Builds the argument buffer of the scene's ExecuteIndirect on the CPU, for when no
+    // culling pass writes it on the GPU. The buffer holds up to maxCommandCount tightly
+    // packed commands followed by the 32 bit command count, so a single buffer serves as
+    // both argument and count buffer.
+    class IndirectDrawBuilder {
+    public:
+        static constexpr uint32_t CommandStride = sizeof(IndirectDrawCommand);
+        static constexpr uint32_t RootConstantCount = sizeof(VertexAttributeTransform) / sizeof(uint32_t);
+
+        explicit IndirectDrawBuilder(uint32_t maxCommandCount);
+        ~IndirectDrawBuilder() = default;
+
+        IndirectDrawBuilder(const IndirectDrawBuilder&) = default;
+        IndirectDrawBuilder(IndirectDrawBuilder&&) = default;
+
+        void Reset();
+        // Returns false, dropping the draw, once maxCommandCount draws were added.
+        bool Add(const VertexAttributeTransform& positionTransform, const IndirectDrawArguments& arguments);
+        // Packs the commands and their count into destination, which must be GetBufferSize() bytes.
+        void Write(std::span<uint8_t> destination) const;
+
+        [[nodiscard]] inline uint32_t GetCommandCount() const;
+        [[nodiscard]] inline uint32_t GetMaxCommandCount() const;
+        [[nodiscard]] inline std::span<const IndirectDrawCommand> GetCommands() const;
+        [[nodiscard]] inline uint64_t GetCountOffset() const;
+        [[nodiscard]] inline uint64_t GetBufferSize() const;
+
+        [[nodiscard]] static constexpr uint64_t GetCountOffset(uint32_t maxCommandCount);
+        [[nodiscard]] static constexpr uint64_t GetBufferSize(uint32_t maxCommandCount);
+        // Signature matching the command layout, with the transform going to the given root constants.
+        [[nodiscard]] static constexpr CommandSignatureDesc GetSignatureDesc(PipelineHandle pipeline, uint32_t rootConstantsIndex);
+
+        IndirectDrawBuilder& operator=(const IndirectDrawBuilder&) = default;
+        IndirectDrawBuilder& operator=(IndirectDrawBuilder&&) = default;
+
+    private:
+        std::vector<IndirectDrawCommand> m_Commands;
+        uint32_t m_MaxCommandCount;
+    };
+}
+
+#include <D3D12Engine/Renderer/IndirectDrawBuilder.inl>
+
+#endif // DE_RENDERER_INDIRECTDRAWBUILDER_HPP
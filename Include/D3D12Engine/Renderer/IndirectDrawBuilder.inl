@@ -0,0 +1,43 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+namespace D3D12Engine {
+    // The command signature reads the commands as raw 32 bit values.
+    static_assert(sizeof(IndirectDrawCommand) == IndirectDrawBuilder::RootConstantCount * sizeof(uint32_t) + sizeof(IndirectDrawArguments));
+    static_assert(std::is_trivially_copyable_v<IndirectDrawCommand>);
+
+    inline uint32_t IndirectDrawBuilder::GetCommandCount() const {
+        return static_cast<uint32_t>(m_Commands.size());
+    }
+
+    inline uint32_t IndirectDrawBuilder::GetMaxCommandCount() const {
+        return m_MaxCommandCount;
+    }
+
+    inline std::span<const IndirectDrawCommand> IndirectDrawBuilder::GetCommands() const {
+        return m_Commands;
+    }
+
+    inline uint64_t IndirectDrawBuilder::GetCountOffset() const {
+        return GetCountOffset(m_MaxCommandCount);
+    }
+
+    inline uint64_t IndirectDrawBuilder::GetBufferSize() const {
+        return GetBufferSize(m_MaxCommandCount);
+    }
+
+    constexpr uint64_t IndirectDrawBuilder::GetCountOffset(const uint32_t maxCommandCount) {
+        return static_cast<uint64_t>(maxCommandCount) * CommandStride;
+    }
+
+    constexpr uint64_t IndirectDrawBuilder::GetBufferSize(const uint32_t maxCommandCount) {
+        return GetCountOffset(maxCommandCount) + sizeof(uint32_t);
+    }
+
+    constexpr CommandSignatureDesc IndirectDrawBuilder::GetSignatureDesc(const PipelineHandle pipeline, const uint32_t rootConstantsIndex) {
+        return {pipeline, rootConstantsIndex, RootConstantCount};
+    }
+}
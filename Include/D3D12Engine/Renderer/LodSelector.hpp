@@ -0,0 +1,68 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef DE_RENDERER_LODSELECTOR_HPP
+#define DE_RENDERER_LODSELECTOR_HPP
+
+#include <D3D12Engine/Assets/MeshSimplifier.hpp>
+
+#include <array>
+#include <cstdint>
+#include <span>
+
+namespace D3D12Engine {
+    struct LodSelectorSettings {
+        // Largest simplification error allowed on screen, in pixels.
+        float MaxPixelError = 1.0f;
+        // Relative margin around MaxPixelError: an object switches to a coarser LOD once its
+        // error falls below (1 - Hysteresis) of the limit and back once the current LOD
+        // goes above (1 + Hysteresis), so objects near a threshold don't flicker.
+        float Hysteresis = 0.25f;
+    };
+
+    // Bounding sphere of one instance of a mesh.
+    struct LodInstance {
+        std::array<float, 3> Center;
+        float Radius;
+    };
+
+    // Picks the LOD of each object from the screen size of its simplification error.
+    class LodSelector {
+    public:
+        explicit LodSelector(const LodSelectorSettings& settings = {});
+        ~LodSelector() = default;
+
+        LodSelector(const LodSelector&) = default;
+        LodSelector(LodSelector&&) = default;
+
+        void SetView(const std::array<float, 3>& cameraPosition, float verticalFov, float viewportHeight);
+
+        // Returns the LOD to draw an instance with, given the one it was drawn with last.
+        // Meshes without LODs get 0.
+        [[nodiscard]] uint32_t Select(std::span<const MeshLod> lods, const LodInstance& instance, uint32_t currentLod) const;
+        // Updates the LOD of many instances of the same mesh in place, currentLods holding one
+        // entry per instance.
+        void Select(std::span<const MeshLod> lods, std::span<const LodInstance> instances, std::span<uint8_t> currentLods) const;
+
+        [[nodiscard]] inline const LodSelectorSettings& GetSettings() const;
+
+        LodSelector& operator=(const LodSelector&) = default;
+        LodSelector& operator=(LodSelector&&) = default;
+
+    private:
+        // Pixels covered by one world unit at the given distance, times the instance radius
+        // since LOD errors are relative to the mesh radius.
+        [[nodiscard]] float GetPixelsPerError(const LodInstance& instance) const;
+
+        LodSelectorSettings m_Settings;
+        std::array<float, 3> m_CameraPosition = {0.0f, 0.0f, 0.0f};
+        float m_ProjectionScale = 1.0f;
+    };
+}
+
+#include <D3D12Engine/Renderer/LodSelector.inl>
+
+#endif // DE_RENDERER_LODSELECTOR_HPP
@@ -0,0 +1,67 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef DE_RENDERER_SCENERENDERER_HPP
+#define DE_RENDERER_SCENERENDERER_HPP
+
+#include <D3D12Engine/Core/DynamicResolution.hpp>
+#include <D3D12Engine/RHI/CommandRecorder.hpp>
+#include <D3D12Engine/RHI/ResourceStateTracker.hpp>
+#include <D3D12Engine/RHI/VertexQuantizer.hpp>
+
+namespace D3D12Engine {
+    struct SceneDraw {
+        VertexBufferView VertexBuffer;
+        uint32_t VertexCount;
+        VertexAttributeTransform PositionTransform;
+    };
+
+    // Draws issued with a single ExecuteIndirect, all from the same vertex buffer.
+    struct SceneIndirectDraws {
+        CommandSignatureHandle Signature;
+        VertexBufferView VertexBuffer;
+        uint32_t MaxCommandCount;
+        ResourceHandle ArgumentBuffer;
+        uint64_t ArgumentOffset = 0;
+        ResourceHandle CountBuffer;
+        uint64_t CountOffset = 0;
+    };
+
+    struct SceneFrame {
+        // Offscreen target the scene is rendered into, only the top left SceneSize part is used.
+        ResourceHandle SceneColor;
+        RenderSize SceneTargetSize;
+        RenderSize SceneSize;
+        // Back buffer the scene is upscaled to, left in the present state.
+        ResourceHandle BackBuffer;
+        RenderSize OutputSize;
+        // Pipelines that are not ready yet are skipped, the targets are only cleared.
+        PipelineHandle ScenePipeline;
+        PipelineHandle UpscalePipeline;
+        // Recorded one by one on the CPU.
+        std::span<const SceneDraw> Draws;
+        // Optional, issued after Draws.
+        const SceneIndirectDraws* pIndirectDraws = nullptr;
+    };
+
+    // Records the commands of a frame: the scene at the dynamic resolution, then the
+    // upscale to the back buffer. Only goes through the RHI so it runs on any backend.
+    // Barriers come from the state tracker, which the caller resolves when the frame is submitted.
+    class SceneRenderer {
+    public:
+        // Root parameters of the scene pipeline.
+        static constexpr uint32_t PositionTransformRootIndex = 0;
+        // Root parameters of the upscale pipeline.
+        static constexpr uint32_t SceneColorRootIndex = 0;
+        static constexpr uint32_t UpscaleConstantsRootIndex = 1;
+
+        static constexpr std::array<float, 4> ClearColor = {0.0f, 0.2f, 0.4f, 1.0f};
+
+        static void RecordFrame(CommandRecorder& recorder, ResourceStateTracker& states, const SceneFrame& frame);
+    };
+}
+
+#endif // DE_RENDERER_SCENERENDERER_HPP
@@ -0,0 +1,75 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef DE_SCENE_ARCHETYPE_HPP
+#define DE_SCENE_ARCHETYPE_HPP
+
+#include <D3D12Engine/Scene/Entity.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace D3D12Engine {
+    // Storage of every entity having exactly the same set of components. Rows are packed in
+    // fixed size chunks, each holding one array per component after the entity array, so a
+    // query only touches the components it reads. All chunks but the last are full.
+    class Archetype {
+    public:
+        static constexpr size_t ChunkSize = 16 * 1024;
+
+        explicit Archetype(ComponentMask mask);
+        ~Archetype() = default;
+
+        Archetype(const Archetype&) = delete;
+        Archetype(Archetype&&) = delete;
+
+        // Appends a row with zero filled components and returns its index.
+        uint32_t AddRow(Entity entity);
+        // Moves the last row into the removed one, returns the entity that moved, an invalid
+        // one if the removed row was the last.
+        Entity RemoveRow(uint32_t row);
+
+        // Null if the archetype doesn't have the component.
+        [[nodiscard]] inline void* GetComponent(uint32_t row, ComponentId component) const;
+        [[nodiscard]] inline Entity GetEntity(uint32_t row) const;
+
+        [[nodiscard]] inline Entity* GetChunkEntities(uint32_t chunk) const;
+        [[nodiscard]] inline void* GetChunkComponents(uint32_t chunk, ComponentId component) const;
+        [[nodiscard]] inline uint32_t GetChunkRowCount(uint32_t chunk) const;
+
+        [[nodiscard]] inline bool Has(ComponentId component) const;
+        [[nodiscard]] inline ComponentMask GetMask() const;
+        [[nodiscard]] inline std::span<const ComponentId> GetComponentIds() const;
+        [[nodiscard]] inline uint32_t GetChunkCapacity() const;
+        [[nodiscard]] inline uint32_t GetChunkCount() const;
+        [[nodiscard]] inline uint32_t GetRowCount() const;
+
+        Archetype& operator=(const Archetype&) = delete;
+        Archetype& operator=(Archetype&&) = delete;
+
+    private:
+        struct Chunk {
+            alignas(MaxComponentAlignment) std::byte Data[ChunkSize];
+        };
+
+        static constexpr uint32_t NoOffset = ~0u;
+
+        ComponentMask m_Mask;
+        std::vector<ComponentId> m_ComponentIds;
+        std::vector<uint32_t> m_ComponentSizes;
+        // Offset of each component array in a chunk, indexed by component id.
+        uint32_t m_ComponentOffsets[MaxComponentTypes];
+        uint32_t m_ChunkCapacity;
+        uint32_t m_RowCount;
+        std::vector<std::unique_ptr<Chunk>> m_Chunks;
+    };
+}
+
+#include <D3D12Engine/Scene/Archetype.inl>
+
+#endif // DE_SCENE_ARCHETYPE_HPP
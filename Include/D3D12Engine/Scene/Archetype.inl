@@ -0,0 +1,59 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <algorithm>
+
+namespace D3D12Engine {
+    inline void* Archetype::GetComponent(const uint32_t row, const ComponentId component) const {
+        if (!Has(component)) {
+            return nullptr;
+        }
+
+        const uint32_t chunk = row / m_ChunkCapacity;
+        const uint32_t chunkRow = row % m_ChunkCapacity;
+        return m_Chunks[chunk]->Data + m_ComponentOffsets[component] + static_cast<size_t>(chunkRow) * ComponentTypes::GetInfo(component).Size;
+    }
+
+    inline Entity Archetype::GetEntity(const uint32_t row) const {
+        return GetChunkEntities(row / m_ChunkCapacity)[row % m_ChunkCapacity];
+    }
+
+    inline Entity* Archetype::GetChunkEntities(const uint32_t chunk) const {
+        return reinterpret_cast<Entity*>(m_Chunks[chunk]->Data);
+    }
+
+    inline void* Archetype::GetChunkComponents(const uint32_t chunk, const ComponentId component) const {
+        return Has(component) ? m_Chunks[chunk]->Data + m_ComponentOffsets[component] : nullptr;
+    }
+
+    inline uint32_t Archetype::GetChunkRowCount(const uint32_t chunk) const {
+        return std::min(m_RowCount - chunk * m_ChunkCapacity, m_ChunkCapacity);
+    }
+
+    inline bool Archetype::Has(const ComponentId component) const {
+        return (m_Mask >> component & 1) != 0;
+    }
+
+    inline ComponentMask Archetype::GetMask() const {
+        return m_Mask;
+    }
+
+    inline std::span<const ComponentId> Archetype::GetComponentIds() const {
+        return m_ComponentIds;
+    }
+
+    inline uint32_t Archetype::GetChunkCapacity() const {
+        return m_ChunkCapacity;
+    }
+
+    inline uint32_t Archetype::GetChunkCount() const {
+        return (m_RowCount + m_ChunkCapacity - 1) / m_ChunkCapacity;
+    }
+
+    inline uint32_t Archetype::GetRowCount() const {
+        return m_RowCount;
+    }
+}
@@ -0,0 +1,62 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef DE_SCENE_ENTITY_HPP
+#define DE_SCENE_ENTITY_HPP
+
+#include <cstdint>
+
+namespace D3D12Engine {
+    // Handle to a scene object. The generation tells apart entities reusing the same slot.
+    struct Entity {
+        static constexpr uint32_t InvalidIndex = ~0u;
+        // Generations from this one on are entities an EntityCommandBuffer will create, the low
+        // bits telling which buffer. Registries never hand them out.
+        static constexpr uint32_t PlaceholderGeneration = 1u << 31;
+
+        uint32_t Index = InvalidIndex;
+        uint32_t Generation = 0;
+
+        [[nodiscard]] constexpr bool IsValid() const { return Index != InvalidIndex; }
+        [[nodiscard]] constexpr bool IsPlaceholder() const { return IsValid() && Generation >= PlaceholderGeneration; }
+        constexpr bool operator==(const Entity&) const = default;
+    };
+
+    using ComponentId = uint32_t;
+    // One bit per component id.
+    using ComponentMask = uint64_t;
+
+    constexpr uint32_t MaxComponentTypes = 64;
+    // Chunks are aligned to this, component arrays can't ask for more.
+    constexpr uint32_t MaxComponentAlignment = 64;
+
+    struct ComponentInfo {
+        uint32_t Size;
+        uint32_t Alignment;
+    };
+
+    // Ids of the component types, given on first use and shared by all registries.
+    // Components are plain data: they are moved with memcpy and never destroyed.
+    class ComponentTypes {
+    public:
+        ComponentTypes() = delete;
+
+        template <typename T>
+        [[nodiscard]] static ComponentId GetId();
+        template <typename... Ts>
+        [[nodiscard]] static ComponentMask GetMask();
+
+        [[nodiscard]] static ComponentInfo GetInfo(ComponentId id);
+
+    private:
+        // Throws once there are MaxComponentTypes types.
+        static ComponentId Register(uint32_t size, uint32_t alignment);
+    };
+}
+
+#include <D3D12Engine/Scene/Entity.inl>
+
+#endif // DE_SCENE_ENTITY_HPP
@@ -0,0 +1,25 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <type_traits>
+
+namespace D3D12Engine {
+    template <typename T>
+    ComponentId ComponentTypes::GetId() {
+        static_assert(std::is_same_v<T, std::remove_cvref_t<T>>, "Components are identified by their plain type.");
+        static_assert(std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T>,
+                      "Components must be trivially copyable and destructible.");
+        static_assert(alignof(T) <= MaxComponentAlignment, "Components can't be aligned to more than MaxComponentAlignment.");
+
+        static const ComponentId id = Register(sizeof(T), alignof(T));
+        return id;
+    }
+
+    template <typename... Ts>
+    ComponentMask ComponentTypes::GetMask() {
+        return (ComponentMask{0} | ... | (ComponentMask{1} << GetId<Ts>()));
+    }
+}
@@ -0,0 +1,91 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef DE_SCENE_ENTITYCOMMANDBUFFER_HPP
+#define DE_SCENE_ENTITYCOMMANDBUFFER_HPP
+
+#include <D3D12Engine/Scene/Entity.hpp>
+
+#include <cstddef>
+#include <mutex>
+#include <span>
+#include <vector>
+
+namespace D3D12Engine {
+    class EntityRegistry;
+
+    // Structural changes recorded during a query, applied once it is done. Commands can be
+    // recorded from several threads, e.g. from a ParallelForEach(); they are applied in the
+    // order they were recorded in.
+    //
+    // Create() returns a placeholder the following commands of the buffer can target, it is
+    // replaced by the created entity at playback. Placeholders mean nothing to registries, to
+    // other buffers, or to the same buffer once played back or cleared.
+    class EntityCommandBuffer {
+    public:
+        EntityCommandBuffer();
+        ~EntityCommandBuffer() = default;
+
+        EntityCommandBuffer(const EntityCommandBuffer&) = delete;
+        EntityCommandBuffer(EntityCommandBuffer&&) = delete;
+
+        template <typename... Ts>
+        Entity Create(const Ts&... components);
+        // Destroy(), Add() and Remove() throw std::invalid_argument for placeholders this buffer
+        // didn't return since its last playback.
+        void Destroy(Entity entity);
+        template <typename T>
+        void Add(Entity entity, const T& component = {});
+        template <typename T>
+        void Remove(Entity entity);
+
+        // Applies the commands and clears the buffer. Commands on entities destroyed by then
+        // are skipped.
+        void Playback(EntityRegistry& registry);
+        void Clear();
+
+        [[nodiscard]] inline size_t GetCommandCount() const;
+
+        EntityCommandBuffer& operator=(const EntityCommandBuffer&) = delete;
+        EntityCommandBuffer& operator=(EntityCommandBuffer&&) = delete;
+
+    private:
+        enum class CommandType : uint8_t {
+            Create,
+            Destroy,
+            Add,
+            Remove
+        };
+
+        struct Command {
+            CommandType Type;
+            Entity Target;
+            // Components to create the entity with, or the component to add or remove.
+            ComponentMask Mask;
+            // Component values, by increasing id for creations.
+            size_t DataOffset;
+        };
+
+        struct ComponentData {
+            ComponentId Id;
+            const void* pData;
+        };
+
+        // Returns the placeholder of a creation, the target otherwise.
+        Entity Record(CommandType type, Entity target, ComponentMask mask, std::span<ComponentData> components);
+
+        mutable std::mutex m_Mutex;
+        std::vector<Command> m_Commands;
+        std::vector<std::byte> m_Data;
+        uint32_t m_CreateCount = 0;
+        // Generation of the placeholders returned since the last playback.
+        uint32_t m_PlaceholderGeneration;
+    };
+}
+
+#include <D3D12Engine/Scene/EntityCommandBuffer.inl>
+
+#endif // DE_SCENE_ENTITYCOMMANDBUFFER_HPP
@@ -0,0 +1,37 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <bit>
+#include <stdexcept>
+
+namespace D3D12Engine {
+    template <typename... Ts>
+    Entity EntityCommandBuffer::Create(const Ts&... components) {
+        const ComponentMask mask = ComponentTypes::GetMask<Ts...>();
+        if (std::popcount(mask) != static_cast<int>(sizeof...(Ts))) {
+            throw std::invalid_argument("An entity can't have the same component twice.");
+        }
+
+        ComponentData data[] = {ComponentData{ComponentTypes::GetId<Ts>(), &components}..., ComponentData{}};
+        return Record(CommandType::Create, {}, mask, std::span(data, sizeof...(Ts)));
+    }
+
+    template <typename T>
+    void EntityCommandBuffer::Add(const Entity entity, const T& component) {
+        ComponentData data = {ComponentTypes::GetId<T>(), &component};
+        Record(CommandType::Add, entity, ComponentTypes::GetMask<T>(), std::span(&data, 1));
+    }
+
+    template <typename T>
+    void EntityCommandBuffer::Remove(const Entity entity) {
+        Record(CommandType::Remove, entity, ComponentTypes::GetMask<T>(), {});
+    }
+
+    inline size_t EntityCommandBuffer::GetCommandCount() const {
+        std::lock_guard lock(m_Mutex);
+        return m_Commands.size();
+    }
+}
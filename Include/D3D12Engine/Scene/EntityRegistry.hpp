@@ -0,0 +1,113 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef DE_SCENE_ENTITYREGISTRY_HPP
+#define DE_SCENE_ENTITYREGISTRY_HPP
+
+#include <D3D12Engine/Scene/Archetype.hpp>
+
+#include <array>
+#include <unordered_map>
+
+namespace D3D12Engine {
+    class JobSystem;
+
+    // Entities of a scene and their components, grouped by archetype. Adding or removing a
+    // component moves the entity to another archetype; the archetypes reached that way are
+    // cached so moves don't look the set up again.
+    //
+    // Queries visit every archetype having the requested components, chunk by chunk. They
+    // can write the components they get but must not create, destroy, add or remove anything:
+    // record those in an EntityCommandBuffer and play it back once the query is done.
+    class EntityRegistry {
+    public:
+        EntityRegistry();
+        ~EntityRegistry() = default;
+
+        EntityRegistry(const EntityRegistry&) = delete;
+        EntityRegistry(EntityRegistry&&) = delete;
+
+        // Components of the mask are zero filled.
+        Entity Create(ComponentMask mask = 0);
+        template <typename... Ts>
+        Entity Create(const Ts&... components);
+        void Destroy(Entity entity);
+
+        // Type erased access, for code that only knows component ids. Throws
+        // std::invalid_argument for destroyed entities.
+        // Returns the component, zero filled if the entity didn't have it.
+        void* AddComponent(Entity entity, ComponentId component);
+        void RemoveComponent(Entity entity, ComponentId component);
+        [[nodiscard]] void* GetComponent(Entity entity, ComponentId component) const;
+
+        template <typename T>
+        T& Add(Entity entity, const T& component = {});
+        template <typename T>
+        void Remove(Entity entity);
+        // Null if the entity doesn't have the component.
+        template <typename T>
+        [[nodiscard]] T* Get(Entity entity) const;
+        template <typename T>
+        [[nodiscard]] bool Has(Entity entity) const;
+
+        // Calls function(entity, components&...) for every entity having the components.
+        template <typename... Ts, typename F>
+        void ForEach(F&& function);
+        // Calls function(span<const Entity>, span<Ts>...) for every chunk having the components.
+        template <typename... Ts, typename F>
+        void ForEachChunk(F&& function);
+        // Same as ForEach() with the chunks spread over the job system. The function is called
+        // from several threads at once.
+        template <typename... Ts, typename F>
+        void ParallelForEach(JobSystem& jobSystem, F&& function);
+
+        [[nodiscard]] inline bool IsAlive(Entity entity) const;
+        [[nodiscard]] inline uint32_t GetEntityCount() const;
+        [[nodiscard]] inline size_t GetArchetypeCount() const;
+
+        EntityRegistry& operator=(const EntityRegistry&) = delete;
+        EntityRegistry& operator=(EntityRegistry&&) = delete;
+
+    private:
+        static constexpr uint32_t NoArchetype = ~0u;
+
+        struct EntityRecord {
+            uint32_t Generation;
+            uint32_t Archetype;
+            uint32_t Row;
+        };
+
+        struct ArchetypeNode {
+            std::unique_ptr<Archetype> pArchetype;
+            // Archetype with one component more or less, indexed by component id.
+            std::array<uint32_t, MaxComponentTypes> AddEdges;
+            std::array<uint32_t, MaxComponentTypes> RemoveEdges;
+        };
+
+        struct ChunkRef {
+            const Archetype* pArchetype;
+            uint32_t Chunk;
+        };
+
+        const EntityRecord& GetRecord(Entity entity) const;
+        uint32_t GetArchetype(ComponentMask mask);
+        uint32_t GetArchetypeWith(uint32_t archetype, ComponentId component);
+        uint32_t GetArchetypeWithout(uint32_t archetype, ComponentId component);
+        // Moves the entity and the components both archetypes have.
+        void MoveEntity(Entity entity, uint32_t destination);
+        void GatherChunks(ComponentMask mask, std::vector<ChunkRef>& chunks) const;
+
+        std::vector<EntityRecord> m_Entities;
+        std::vector<uint32_t> m_FreeIndices;
+        std::vector<ArchetypeNode> m_Archetypes;
+        std::unordered_map<ComponentMask, uint32_t> m_ArchetypeIndices;
+        uint32_t m_EntityCount;
+    };
+}
+
+#include <D3D12Engine/Scene/EntityRegistry.inl>
+
+#endif // DE_SCENE_ENTITYREGISTRY_HPP
@@ -0,0 +1,111 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <D3D12Engine/Core/JobSystem.hpp>
+
+#include <bit>
+#include <stdexcept>
+
+namespace D3D12Engine {
+    template <typename... Ts>
+    Entity EntityRegistry::Create(const Ts&... components) {
+        const ComponentMask mask = ComponentTypes::GetMask<Ts...>();
+        if (std::popcount(mask) != static_cast<int>(sizeof...(Ts))) {
+            throw std::invalid_argument("An entity can't have the same component twice.");
+        }
+
+        const Entity entity = Create(mask);
+        ((*static_cast<Ts*>(GetComponent(entity, ComponentTypes::GetId<Ts>())) = components), ...);
+
+        return entity;
+    }
+
+    template <typename T>
+    T& EntityRegistry::Add(const Entity entity, const T& component) {
+        T* pComponent = static_cast<T*>(AddComponent(entity, ComponentTypes::GetId<T>()));
+        *pComponent = component;
+
+        return *pComponent;
+    }
+
+    template <typename T>
+    void EntityRegistry::Remove(const Entity entity) {
+        RemoveComponent(entity, ComponentTypes::GetId<T>());
+    }
+
+    template <typename T>
+    T* EntityRegistry::Get(const Entity entity) const {
+        return static_cast<T*>(GetComponent(entity, ComponentTypes::GetId<T>()));
+    }
+
+    template <typename T>
+    bool EntityRegistry::Has(const Entity entity) const {
+        return GetComponent(entity, ComponentTypes::GetId<T>()) != nullptr;
+    }
+
+    template <typename... Ts, typename F>
+    void EntityRegistry::ForEach(F&& function) {
+        ForEachChunk<Ts...>([&](const std::span<const Entity> entities, const std::span<Ts>... components) {
+            for (size_t i = 0; i < entities.size(); ++i) {
+                function(entities[i], components[i]...);
+            }
+        });
+    }
+
+    template <typename... Ts, typename F>
+    void EntityRegistry::ForEachChunk(F&& function) {
+        const ComponentMask mask = ComponentTypes::GetMask<Ts...>();
+
+        for (const ArchetypeNode& node : m_Archetypes) {
+            const Archetype& archetype = *node.pArchetype;
+            if ((archetype.GetMask() & mask) != mask) {
+                continue;
+            }
+
+            for (uint32_t chunk = 0; chunk < archetype.GetChunkCount(); ++chunk) {
+                const uint32_t count = archetype.GetChunkRowCount(chunk);
+                function(std::span<const Entity>(archetype.GetChunkEntities(chunk), count),
+                         std::span<Ts>(static_cast<Ts*>(archetype.GetChunkComponents(chunk, ComponentTypes::GetId<Ts>())), count)...);
+            }
+        }
+    }
+
+    template <typename... Ts, typename F>
+    void EntityRegistry::ParallelForEach(JobSystem& jobSystem, F&& function) {
+        std::vector<ChunkRef> chunks;
+        GatherChunks(ComponentTypes::GetMask<Ts...>(), chunks);
+
+        const auto visitChunk = [&](const Entity* pEntities, const uint32_t count, Ts*... pComponents) {
+            for (uint32_t row = 0; row < count; ++row) {
+                function(pEntities[row], pComponents[row]...);
+            }
+        };
+
+        jobSystem.ParallelFor(static_cast<uint32_t>(chunks.size()), 1, [&](const uint32_t begin, const uint32_t end) {
+            for (uint32_t i = begin; i < end; ++i) {
+                const Archetype& archetype = *chunks[i].pArchetype;
+                const uint32_t chunk = chunks[i].Chunk;
+
+                visitChunk(archetype.GetChunkEntities(chunk), archetype.GetChunkRowCount(chunk),
+                           static_cast<Ts*>(archetype.GetChunkComponents(chunk, ComponentTypes::GetId<Ts>()))...);
+            }
+        });
+    }
+
+    inline bool EntityRegistry::IsAlive(const Entity entity) const {
+        return entity.Index < m_Entities.size() &&
+               m_Entities[entity.Index].Generation == entity.Generation &&
+               m_Entities[entity.Index].Archetype != NoArchetype;
+    }
+
+    inline uint32_t EntityRegistry::GetEntityCount() const {
+        return m_EntityCount;
+    }
+
+    inline size_t EntityRegistry::GetArchetypeCount() const {
+        return m_Archetypes.size();
+    }
+}
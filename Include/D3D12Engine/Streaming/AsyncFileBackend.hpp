@@ -0,0 +1,53 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef DE_STREAMING_ASYNCFILEBACKEND_HPP
+#define DE_STREAMING_ASYNCFILEBACKEND_HPP
+
+#include <D3D12Engine/Streaming/StreamingBackends.hpp>
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+namespace D3D12Engine {
+    // Reads files with the standard library on a dedicated IO thread.
+    class AsyncFileBackend final : public StreamingFileBackend {
+    public:
+        AsyncFileBackend();
+        ~AsyncFileBackend() override;
+
+        AsyncFileBackend(const AsyncFileBackend&) = delete;
+        AsyncFileBackend(AsyncFileBackend&&) = delete;
+
+        void Submit(StreamingReadRequest request) override;
+        void Cancel(uint64_t requestId) override;
+        void Poll(std::vector<StreamingReadResult>& results) override;
+
+        AsyncFileBackend& operator=(const AsyncFileBackend&) = delete;
+        AsyncFileBackend& operator=(AsyncFileBackend&&) = delete;
+
+    private:
+        void WorkerMain(const std::stop_token& stopToken);
+
+        static StreamingReadResult Read(const StreamingReadRequest& request);
+
+        std::mutex m_Mutex;
+        std::condition_variable_any m_Condition;
+        std::deque<StreamingReadRequest> m_Pending;
+        std::vector<StreamingReadResult> m_Completed;
+        // The request the worker is reading, its result is dropped if it was cancelled meanwhile.
+        std::optional<uint64_t> m_ReadingId;
+        bool m_ReadingCancelled = false;
+        std::jthread m_Worker;
+    };
+}
+
+#include <D3D12Engine/Streaming/AsyncFileBackend.inl>
+
+#endif // DE_STREAMING_ASYNCFILEBACKEND_HPP
@@ -0,0 +1,75 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef DE_STREAMING_STREAMINGBACKENDS_HPP
+#define DE_STREAMING_STREAMINGBACKENDS_HPP
+
+#include <D3D12Engine/Assets/DdsFile.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <vector>
+
+namespace D3D12Engine {
+    using StreamedTextureId = uint32_t;
+
+    struct StreamingReadRequest {
+        uint64_t Id;
+        std::filesystem::path Path;
+        uint64_t Offset;
+        uint64_t Size;
+    };
+
+    struct StreamingReadResult {
+        uint64_t Id;
+        bool Succeeded;
+        std::vector<std::byte> Data;
+    };
+
+    // Where the streamer reads mip data from. Reads are asynchronous: Submit() queues
+    // a request and Poll() hands back whatever finished since the last call.
+    // Requests are submitted in priority order, so a backend should serve them in order.
+    class StreamingFileBackend {
+    public:
+        StreamingFileBackend() = default;
+        virtual ~StreamingFileBackend() = default;
+
+        StreamingFileBackend(const StreamingFileBackend&) = delete;
+        StreamingFileBackend(StreamingFileBackend&&) = delete;
+
+        StreamingFileBackend& operator=(const StreamingFileBackend&) = delete;
+        StreamingFileBackend& operator=(StreamingFileBackend&&) = delete;
+
+        virtual void Submit(StreamingReadRequest request) = 0;
+        // Best effort, a cancelled request may still complete.
+        virtual void Cancel(uint64_t requestId) = 0;
+        virtual void Poll(std::vector<StreamingReadResult>& results) = 0;
+    };
+
+    // Owns the GPU side of streamed textures. Mips are always made resident from the
+    // smallest to the largest one and evicted from the largest one, so an implementation
+    // can back them with tiled resources or clamp the SRV MinLOD to the finest resident mip.
+    class StreamingDevice {
+    public:
+        StreamingDevice() = default;
+        virtual ~StreamingDevice() = default;
+
+        StreamingDevice(const StreamingDevice&) = delete;
+        StreamingDevice(StreamingDevice&&) = delete;
+
+        StreamingDevice& operator=(const StreamingDevice&) = delete;
+        StreamingDevice& operator=(StreamingDevice&&) = delete;
+
+        virtual void CreateTexture(StreamedTextureId id, const DdsLayout& layout) = 0;
+        virtual void DestroyTexture(StreamedTextureId id) = 0;
+        virtual void UploadMip(StreamedTextureId id, uint32_t mip, std::span<const std::byte> data) = 0;
+        virtual void EvictMip(StreamedTextureId id, uint32_t mip) = 0;
+    };
+}
+
+#endif // DE_STREAMING_STREAMINGBACKENDS_HPP
@@ -0,0 +1,131 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef DE_STREAMING_TEXTURESTREAMER_HPP
+#define DE_STREAMING_TEXTURESTREAMER_HPP
+
+#include <D3D12Engine/Streaming/StreamingBackends.hpp>
+
+#include <unordered_map>
+
+namespace D3D12Engine {
+    struct TextureStreamerSettings {
+        // Memory the streamed mips are allowed to use, pinned tails included.
+        uint64_t BudgetBytes = 256ull * 1024 * 1024;
+        uint32_t MaxRequestsInFlight = 8;
+        uint64_t MaxBytesInFlight = 32ull * 1024 * 1024;
+        // Mips whose largest side is at or below this size are loaded on registration and never evicted.
+        uint32_t PinnedMipDimension = 64;
+        // Frames a texture must go without being requested before its mips become evictable.
+        uint32_t EvictionGraceFrames = 30;
+        // Times a failed read is retried before the texture stops streaming, the first retry
+        // waits this many frames and every further one twice as long as the previous.
+        uint32_t MaxReadRetries = 3;
+        uint32_t RetryDelayFrames = 30;
+    };
+
+    struct TextureStreamerStats {
+        uint64_t ResidentBytes = 0;
+        uint64_t PendingBytes = 0;
+        uint32_t RequestsInFlight = 0;
+        uint64_t MipsLoaded = 0;
+        uint64_t MipsEvicted = 0;
+        uint64_t FailedReads = 0;
+    };
+
+    // Keeps the mips of DDS textures resident according to per-frame feedback.
+    // Every frame the renderer reports the finest mip it wants for each visible texture
+    // (from sampler feedback, projected screen size or distance), then calls Update(),
+    // which uploads finished reads, schedules new reads by priority and evicts the least
+    // useful mips when the budget is exceeded. Nothing here touches the GPU directly,
+    // it all goes through the StreamingDevice.
+    class TextureStreamer {
+    public:
+        static constexpr StreamedTextureId InvalidTexture = ~0u;
+
+        TextureStreamer(StreamingFileBackend& fileBackend, StreamingDevice& device, const TextureStreamerSettings& settings = {});
+        ~TextureStreamer();
+
+        TextureStreamer(const TextureStreamer&) = delete;
+        TextureStreamer(TextureStreamer&&) = delete;
+
+        StreamedTextureId RegisterTexture(std::filesystem::path path, DdsLayout layout);
+        void UnregisterTexture(StreamedTextureId id);
+
+        // Feedback, can be called several times per frame, the finest request wins.
+        void RequestMip(StreamedTextureId id, float desiredMip);
+        void RequestScreenSize(StreamedTextureId id, float projectedWidth, float projectedHeight);
+
+        void Update();
+
+        void SetBudget(uint64_t budgetBytes);
+        // Lets a texture that ran out of read retries stream again, e.g. once its file was replaced.
+        void ResetLoadFailure(StreamedTextureId id);
+
+        [[nodiscard]] inline bool HasLoadFailed(StreamedTextureId id) const;
+        [[nodiscard]] inline uint32_t GetResidentMip(StreamedTextureId id) const;
+        [[nodiscard]] inline const TextureStreamerStats& GetStats() const;
+        [[nodiscard]] inline uint64_t GetFrameIndex() const;
+
+        // Mip at which one texel covers roughly one pixel for a texture drawn at the given size.
+        [[nodiscard]] static float ComputeDesiredMip(uint32_t textureWidth, uint32_t textureHeight,
+                                                     float projectedWidth, float projectedHeight);
+
+        TextureStreamer& operator=(const TextureStreamer&) = delete;
+        TextureStreamer& operator=(TextureStreamer&&) = delete;
+
+    private:
+        struct StreamedTexture {
+            std::filesystem::path Path;
+            DdsLayout Layout;
+            // Finest resident mip, equal to the mip count when nothing is resident.
+            uint32_t ResidentMip = 0;
+            // First mip of the never evicted tail.
+            uint32_t PinnedMip = 0;
+            // Finest mip requested this frame, and the last one that was requested at all.
+            uint32_t RequestedMip = 0;
+            uint32_t WantedMip = 0;
+            uint64_t LastRequestedFrame = 0;
+            uint64_t PendingRequest = 0;
+            // Reads that failed in a row, and the first frame the next one may be issued.
+            uint32_t FailedReads = 0;
+            uint64_t RetryFrame = 0;
+            bool Registered = false;
+            // Set once the retries are exhausted, until ResetLoadFailure().
+            bool LoadFailed = false;
+        };
+
+        struct PendingRead {
+            StreamedTextureId Texture;
+            uint32_t FirstMip;
+            uint32_t LastMip;
+            uint64_t Size;
+        };
+
+        void ProcessCompletedReads();
+        void UpdateWantedMips();
+        void ScheduleReads();
+        void IssueRead(StreamedTextureId id, uint32_t firstMip, uint32_t lastMip);
+        bool EvictFor(uint64_t bytesNeeded, bool allowRecent, StreamedTextureId exclude);
+        [[nodiscard]] bool IsEvictable(const StreamedTexture& texture, bool allowRecent) const;
+
+        StreamingFileBackend& m_FileBackend;
+        StreamingDevice& m_Device;
+        TextureStreamerSettings m_Settings;
+        TextureStreamerStats m_Stats;
+
+        std::vector<StreamedTexture> m_Textures;
+        std::vector<StreamedTextureId> m_FreeIds;
+        std::unordered_map<uint64_t, PendingRead> m_PendingReads;
+        std::vector<StreamingReadResult> m_CompletedReads;
+        uint64_t m_NextRequestId = 1;
+        uint64_t m_FrameIndex = 0;
+    };
+}
+
+#include <D3D12Engine/Streaming/TextureStreamer.inl>
+
+#endif // DE_STREAMING_TEXTURESTREAMER_HPP
@@ -0,0 +1,23 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+namespace D3D12Engine {
+    inline uint32_t TextureStreamer::GetResidentMip(const StreamedTextureId id) const {
+        return m_Textures[id].ResidentMip;
+    }
+
+    inline bool TextureStreamer::HasLoadFailed(const StreamedTextureId id) const {
+        return m_Textures[id].LoadFailed;
+    }
+
+    inline const TextureStreamerStats& TextureStreamer::GetStats() const {
+        return m_Stats;
+    }
+
+    inline uint64_t TextureStreamer::GetFrameIndex() const {
+        return m_FrameIndex;
+    }
+}
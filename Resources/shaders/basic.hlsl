@@ -1,3 +1,9 @@
+cbuffer VertexDequantization : register(b0) {
+    // Positions are stored normalized to the mesh bounds.
+    float4 g_PositionScale;
+    float4 g_PositionOffset;
+};
+
 struct VSOutput {
     float4 position : SV_POSITION;
     float4 color : COLOR;
@@ -6,12 +12,23 @@ struct VSOutput {
 VSOutput VSMain(float4 position : POSITION, float4 color : COLOR) {
     VSOutput result;
 
-    result.position = position;
+    result.position = position * g_PositionScale + g_PositionOffset;
     result.color = color;
 
     return result;
 }
 
 float4 PSMain(VSOutput input) : SV_Target {
-    return input.color;
-}
\ No newline at end of file
+#ifdef VERTEX_COLOR
+    float4 color = input.color;
+#else
+    float4 color = float4(1.0, 1.0, 1.0, 1.0);
+#endif
+
+#ifdef DESATURATE
+    // Rec. 709 luminance.
+    color.rgb = dot(color.rgb, float3(0.2126, 0.7152, 0.0722));
+#endif
+
+    return color;
+}
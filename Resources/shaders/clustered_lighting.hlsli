@@ -0,0 +1,35 @@
+// Point lighting from the cluster light lists, for the pixel shaders of forward passes.
+
+#include "clusters.hlsli"
+
+ConstantBuffer<ClusterConstants> g_Clusters : register(b0, space1);
+StructuredBuffer<PointLight> g_Lights : register(t0, space1);
+// Offset and count in g_ClusterLightIndices of each cluster's lights.
+StructuredBuffer<uint2> g_ClusterCells : register(t1, space1);
+StructuredBuffer<uint> g_ClusterLightIndices : register(t2, space1);
+
+// Smooth falloff reaching zero at the light radius.
+float GetAttenuation(float distance, float radius) {
+    float ratio = saturate(distance / radius);
+    float window = saturate(1.0f - ratio * ratio * ratio * ratio);
+
+    return window * window / (distance * distance + 1.0f);
+}
+
+// Lambert lighting of a surface from the lights of its cluster. Positions and normals are in view space.
+float3 ComputeClusteredLighting(float3 viewPosition, float3 viewNormal, float3 albedo) {
+    uint2 cell = g_ClusterCells[GetClusterIndex(g_Clusters, viewPosition)];
+
+    float3 lighting = 0.0f;
+    for (uint i = 0; i < cell.y; i++) {
+        PointLight light = g_Lights[g_ClusterLightIndices[cell.x + i]];
+
+        float3 toLight = light.position - viewPosition;
+        float distance = length(toLight);
+        float nDotL = saturate(dot(viewNormal, toLight / max(distance, 1e-4f)));
+
+        lighting += light.color * (light.intensity * nDotL * GetAttenuation(distance, light.radius));
+    }
+
+    return lighting * albedo;
+}
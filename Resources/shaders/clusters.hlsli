@@ -0,0 +1,33 @@
+// Cluster grid shared by the light culling and the lighting shaders. The layouts match
+// PointLight and ClusterShaderConstants in Renderer/ClusteredLighting.hpp.
+
+struct PointLight {
+    float3 position; // View space.
+    float radius;
+    float3 color;
+    float intensity;
+};
+
+struct ClusterConstants {
+    float tanHalfFovX;
+    float tanHalfFovY;
+    // slice = log(z) * depthSliceScale + depthSliceBias
+    float depthSliceScale;
+    float depthSliceBias;
+    uint tileCountX;
+    uint tileCountY;
+    uint sliceCount;
+    uint lightCount;
+};
+
+// Cluster containing a view space position, left handed with +y up.
+uint GetClusterIndex(ClusterConstants clusters, float3 viewPosition) {
+    float depth = max(viewPosition.z, 1e-4f);
+    uint slice = (uint)clamp(floor(log(depth) * clusters.depthSliceScale + clusters.depthSliceBias), 0.0f, (float)(clusters.sliceCount - 1));
+
+    float2 ndc = viewPosition.xy / (depth * float2(clusters.tanHalfFovX, clusters.tanHalfFovY));
+    float2 tileCount = float2(clusters.tileCountX, clusters.tileCountY);
+    uint2 tile = (uint2)clamp(floor(float2(ndc.x * 0.5f + 0.5f, 0.5f - ndc.y * 0.5f) * tileCount), 0.0f, tileCount - 1.0f);
+
+    return (slice * clusters.tileCountY + tile.y) * clusters.tileCountX + tile.x;
+}
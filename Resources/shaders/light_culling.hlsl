@@ -0,0 +1,75 @@
+// GPU version of LightBinner::Bin(): one thread group per cluster, dispatched with as
+// many groups as there are clusters. Lights are tested against the cluster's box, the
+// same box the CPU path uses, and the hits are gathered in group shared memory before
+// reserving their range of the index list.
+
+#include "clusters.hlsli"
+
+#define GROUP_SIZE 64
+// Must match ClusterGridSettings::MaxLightsPerCluster.
+#define MAX_LIGHTS_PER_CLUSTER 256
+
+ConstantBuffer<ClusterConstants> g_Clusters : register(b0);
+StructuredBuffer<PointLight> g_Lights : register(t0);
+RWStructuredBuffer<uint2> g_ClusterCells : register(u0);
+RWStructuredBuffer<uint> g_ClusterLightIndices : register(u1);
+// Number of indices written so far, cleared to zero before the dispatch.
+RWByteAddressBuffer g_IndexCounter : register(u2);
+
+groupshared uint gs_LightCount;
+groupshared uint gs_IndexOffset;
+groupshared uint gs_Lights[MAX_LIGHTS_PER_CLUSTER];
+
+float GetSliceDepth(uint slice) {
+    return exp(((float)slice - g_Clusters.depthSliceBias) / g_Clusters.depthSliceScale);
+}
+
+[numthreads(GROUP_SIZE, 1, 1)]
+void CSMain(uint3 groupId : SV_GroupID, uint threadIndex : SV_GroupIndex) {
+    uint cluster = groupId.x;
+    uint tileX = cluster % g_Clusters.tileCountX;
+    uint tileY = (cluster / g_Clusters.tileCountX) % g_Clusters.tileCountY;
+    uint slice = cluster / (g_Clusters.tileCountX * g_Clusters.tileCountY);
+
+    // Box around the part of the tile's frustum between the two slices.
+    float nearDepth = GetSliceDepth(slice);
+    float farDepth = GetSliceDepth(slice + 1);
+    float2 tileSize = 2.0f / float2(g_Clusters.tileCountX, g_Clusters.tileCountY);
+    float2 ndcMin = float2(-1.0f + tileX * tileSize.x, 1.0f - (tileY + 1) * tileSize.y);
+    float2 ndcMax = ndcMin + tileSize;
+    float2 scale = float2(g_Clusters.tanHalfFovX, g_Clusters.tanHalfFovY);
+    float3 boxMin = float3(min(ndcMin * scale * nearDepth, ndcMin * scale * farDepth), nearDepth);
+    float3 boxMax = float3(max(ndcMax * scale * nearDepth, ndcMax * scale * farDepth), farDepth);
+
+    if (threadIndex == 0) {
+        gs_LightCount = 0;
+    }
+    GroupMemoryBarrierWithGroupSync();
+
+    for (uint i = threadIndex; i < g_Clusters.lightCount; i += GROUP_SIZE) {
+        PointLight light = g_Lights[i];
+        float3 outside = max(boxMin - light.position, 0.0f) + max(light.position - boxMax, 0.0f);
+
+        if (dot(outside, outside) <= light.radius * light.radius) {
+            uint slot;
+            InterlockedAdd(gs_LightCount, 1, slot);
+            if (slot < MAX_LIGHTS_PER_CLUSTER) {
+                gs_Lights[slot] = i;
+            }
+        }
+    }
+    GroupMemoryBarrierWithGroupSync();
+
+    uint count = min(gs_LightCount, MAX_LIGHTS_PER_CLUSTER);
+    if (threadIndex == 0) {
+        uint offset;
+        g_IndexCounter.InterlockedAdd(0, count, offset);
+        gs_IndexOffset = offset;
+        g_ClusterCells[cluster] = uint2(offset, count);
+    }
+    GroupMemoryBarrierWithGroupSync();
+
+    for (uint j = threadIndex; j < count; j += GROUP_SIZE) {
+        g_ClusterLightIndices[gs_IndexOffset + j] = gs_Lights[j];
+    }
+}
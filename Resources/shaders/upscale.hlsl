@@ -0,0 +1,29 @@
+Texture2D<float4> g_Scene : register(t0);
+SamplerState g_LinearClamp : register(s0);
+
+cbuffer UpscaleConstants : register(b0) {
+    // Part of the scene texture that was rendered to, and the last UV that can be
+    // sampled without filtering in texels from outside of it.
+    float2 g_UvScale;
+    float2 g_UvMax;
+};
+
+struct VSOutput {
+    float4 position : SV_POSITION;
+    float2 uv : TEXCOORD;
+};
+
+// Full screen triangle generated from the vertex ID, no vertex buffer needed.
+VSOutput VSMain(uint vertexId : SV_VertexID) {
+    VSOutput result;
+
+    float2 uv = float2((vertexId << 1) & 2, vertexId & 2);
+    result.position = float4(uv * float2(2.0f, -2.0f) + float2(-1.0f, 1.0f), 0.0f, 1.0f);
+    result.uv = uv;
+
+    return result;
+}
+
+float4 PSMain(VSOutput input) : SV_Target {
+    return g_Scene.Sample(g_LinearClamp, min(input.uv * g_UvScale, g_UvMax));
+}
@@ -5,16 +5,48 @@
 #include <D3D12Engine/Application.hpp>
 
 #include <D3D12Engine/RHI/DxUtils.hpp>
+#include <D3D12Engine/RHI/D3D12/D3D12CommandRecorder.hpp>
+#include <D3D12Engine/Renderer/SceneRenderer.hpp>
 
+#include <psapi.h>
+
+#include <chrono>
+#include <exception>
 #include <iostream>
 
 namespace D3D12Engine {
+    namespace {
+        // The position dequantization transform.
+        constexpr RootParameterDesc SceneRootParameters[] = {
+            {RootParameterType::Constants, 0, 8, ShaderVisibility::Vertex}
+        };
+
+        // The scene color and the UV constants, sampled with the linear clamp sampler.
+        constexpr RootParameterDesc UpscaleRootParameters[] = {
+            {RootParameterType::ShaderResource, 0, 0, ShaderVisibility::Pixel},
+            {RootParameterType::Constants, 0, 4, ShaderVisibility::Pixel}
+        };
+
+        std::span<const std::byte> GetBytecode(ID3DBlob* pBlob) {
+            return {static_cast<const std::byte*>(pBlob->GetBufferPointer()), pBlob->GetBufferSize()};
+        }
+    }
+
     Application::Application(const HINSTANCE hInstance, const bool useWarpDevice)
         : m_UseWarpDevice(useWarpDevice),
           m_AspectRatio(static_cast<float>(g_ScreenWidth) / static_cast<float>(g_ScreenHeight)),
-          m_Viewport(0.0f, 0.0f, g_ScreenWidth, g_ScreenHeight),
-          m_ScissorRect(0, 0, g_ScreenWidth, g_ScreenHeight),
-          m_RtvDescriptorSize(0),
+          m_ResizeCoalescer({g_ScreenWidth, g_ScreenHeight}),
+          m_OutputSize{g_ScreenWidth, g_ScreenHeight},
+          m_SceneSize{g_ScreenWidth, g_ScreenHeight},
+          m_SceneTargetSize{g_ScreenWidth, g_ScreenHeight},
+          m_IndirectDrawBuilder(MaxIndirectDraws),
+          m_pIndirectArgumentData(nullptr),
+          m_CameraPosition{0.0f, 0.0f, 1.0f},
+          m_FrameStartTime(0.0),
+          m_PreviousFrameStartTime(0.0),
+          m_FrameCpuMs(0.0),
+          m_LastMemoryReportTime(0.0),
+          m_FrameArena(FrameArenaSize),
           m_FrameIndex(0) {
         m_Window = std::make_unique<Window>(this, hInstance, g_ScreenWidth, g_ScreenHeight);
         OnInit();
@@ -31,8 +63,17 @@ namespace D3D12Engine {
         // Parse the command line parameters
         int argc;
         LPWSTR* argv = CommandLineToArgvW(GetCommandLineW(), &argc);
+        if (argv != nullptr) {
+            const std::vector<std::wstring_view> arguments(argv, argv + argc);
+            const auto benchmarkSettings = BenchmarkSettings::Parse(arguments);
+            m_MemoryReport = GpuMemoryReportSettings::Parse(arguments);
 
-        LocalFree(argv);
+            LocalFree(argv);
+
+            if (benchmarkSettings) {
+                StartBenchmark(*benchmarkSettings);
+            }
+        }
 
         // Main message loop
         MSG msg = {};
@@ -50,6 +91,7 @@ namespace D3D12Engine {
 
     void Application::OnInit() {
         // Create input devices
+        m_InputEvents.Synchronize(GetTimeSeconds(), 0.0);
         m_Keyboard = std::make_unique<DirectX::Keyboard>();
         m_Mouse = std::make_unique<DirectX::Mouse>();
         m_Mouse->SetWindow(m_Window->GetHandle());
@@ -58,9 +100,42 @@ namespace D3D12Engine {
     }
 
     void Application::Tick() {
+        m_PreviousFrameStartTime = m_FrameStartTime;
+        m_FrameStartTime = GetTimeSeconds();
+        m_FrameArena.Reset();
+        UpdateMemoryStatistics();
+
+        // Apply the window size once it is worth draining the GPU for it.
+        if (const auto size = m_ResizeCoalescer.Poll(GetTimeSeconds())) {
+            Resize(*size);
+        }
+
+        // Finish any asset whose CPU side got ready since the last frame.
+        m_AssetLoader->PumpUploads();
+
+#ifdef DE_DEBUG
+        ReloadChangedShaders();
+#endif
+
+        // Benchmark frames see the camera at a time derived from their index only, so every
+        // run renders the same frames whatever the frame rate.
+        if (m_Benchmark) {
+            m_CameraPosition = m_BenchmarkCamera->Evaluate(m_Benchmark->GetSimulationTime());
+        }
+
+        // Each update step first consumes the input received before the time it ends at, so
+        // the keyboard and mouse states it reads are the ones of that point of the frame.
+        const double timerTime = GetTimeSeconds();
         m_Timer.Tick([&]() {
+            const double stepEnd = StepTimer::TicksToSeconds(m_Timer.GetTotalTicks());
+            const double stepStart = stepEnd - m_Timer.GetElapsedSeconds();
+            m_InputEvents.DrainStep(stepStart, stepEnd, [](const InputEvent& event, double) {
+                ProcessInputEvent(event);
+            });
+
             OnUpdate();
         });
+        m_InputEvents.Synchronize(timerTime, StepTimer::TicksToSeconds(m_Timer.GetTotalTicks() + m_Timer.GetLeftOverTicks()));
 
         OnRender();
     }
@@ -72,21 +147,33 @@ namespace D3D12Engine {
 
     void Application::OnRender() {
         // Record all the commands we need to render the scene into the command list.
+        BuildIndirectDraws();
         PopulateCommandList();
+        ExecuteCommandList();
+        m_FrameCpuMs = (GetTimeSeconds() - m_FrameStartTime) * 1000.0;
 
-        // Execute the command list.
-        ID3D12CommandList* ppCommandLists[] = {m_CommandList.Get()};
-        m_CommandQueue->ExecuteCommandLists(_countof(ppCommandLists), ppCommandLists);
-
-        // Present the frame.
-        ThrowIfFailed(m_SwapChain->Present(1, 0));
+        // Present the frame, without waiting for the vertical blank when measuring.
+        ThrowIfFailed(m_SwapChain->Present(m_Benchmark ? 0 : 1, 0));
 
         WaitForPreviousFrame();
+
+        // The frame is done on the GPU, feed its duration to the resolution controller.
+        m_GpuTimer->ReadBack();
+        m_ResolutionController.Update(m_GpuTimer->GetElapsedMs());
+        UpdateSceneSize();
+
+        if (m_Benchmark) {
+            RecordBenchmarkFrame();
+        }
     }
 
     void Application::OnDestroy() {
         WaitForPreviousFrame();
 
+        if (m_MemoryReport) {
+            m_RenderDevice->GetMemoryStatistics().WriteReport(m_MemoryReport->Path);
+        }
+
         CloseHandle(m_FrameEvent);
     }
 
@@ -118,11 +205,17 @@ namespace D3D12Engine {
             ThrowIfFailed(factory->EnumWarpAdapter(IID_PPV_ARGS(&warpAdapter)), "Failed to create warp adapter");
 
             ThrowIfFailed(D3D12CreateDevice(warpAdapter.Get(), D3D_FEATURE_LEVEL_11_0, IID_PPV_ARGS(&m_Device)), "Failed to create device.");
+            m_Adapter = warpAdapter;
         } else {
             ComPtr<IDXGIAdapter1> hardwareAdapter;
             GetHardwareAdapter(factory.Get(), &hardwareAdapter);
 
             ThrowIfFailed(D3D12CreateDevice(hardwareAdapter.Get(), D3D_FEATURE_LEVEL_11_0, IID_PPV_ARGS(&m_Device)));
+            m_Adapter = hardwareAdapter;
+        }
+
+        if (FAILED(m_Adapter.As(&m_BudgetAdapter))) {
+            m_BudgetAdapter.Reset();
         }
 
         // Describe and create the command queue.
@@ -132,6 +225,9 @@ namespace D3D12Engine {
 
         ThrowIfFailed(m_Device->CreateCommandQueue(&queueDesc, IID_PPV_ARGS(&m_CommandQueue)), "Failed to create command queue.");
 
+        m_RenderDevice = std::make_unique<D3D12RenderDevice>(m_Device.Get());
+        m_GpuTimer = std::make_unique<GpuTimer>(m_Device.Get(), m_CommandQueue.Get());
+
         // Describe and create the swap chain.
         DXGI_SWAP_CHAIN_DESC1 swapChainDesc = {};
         swapChainDesc.BufferCount = FrameCount;
@@ -157,107 +253,35 @@ namespace D3D12Engine {
         ThrowIfFailed(swapChain.As(&m_SwapChain), "Failed to get swap chain.");
         m_FrameIndex = m_SwapChain->GetCurrentBackBufferIndex();
 
-        // Create descriptor heaps.
-        {
-            // Describe and create a render target view (RTV) descriptor heap.
-            D3D12_DESCRIPTOR_HEAP_DESC rtvHeapDesc = {};
-            rtvHeapDesc.NumDescriptors = FrameCount;
-            rtvHeapDesc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_RTV;
-            rtvHeapDesc.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_NONE;
-            ThrowIfFailed(m_Device->CreateDescriptorHeap(&rtvHeapDesc, IID_PPV_ARGS(&m_RtvHeap)), "Failed to create RTV heap.");
-
-            m_RtvDescriptorSize = m_Device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_RTV);
-        }
-
         // Create frame resources.
-        {
-            CD3DX12_CPU_DESCRIPTOR_HANDLE rtvHandle(m_RtvHeap->GetCPUDescriptorHandleForHeapStart());
-
-            // Create an RTV for each frame.
-            for (UINT i = 0; i < FrameCount; i++) {
-                ThrowIfFailed(m_SwapChain->GetBuffer(i, IID_PPV_ARGS(&m_RenderTargets[i])), "Failed to get RTV buffer.");
-                m_Device->CreateRenderTargetView(m_RenderTargets[i].Get(), nullptr, rtvHandle);
-                rtvHandle.Offset(1, m_RtvDescriptorSize);
-            }
-        }
+        CreateRenderTargetViews();
+        CreateSceneColorTarget(g_ScreenWidth, g_ScreenHeight);
 
         ThrowIfFailed(m_Device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT, IID_PPV_ARGS(&m_CommandAllocator)), "Failed to create command allocator.");
     }
 
     void Application::LoadAssets() {
-        // Create an empty root signature.
-        {
-            CD3DX12_ROOT_SIGNATURE_DESC rootSignatureDesc;
-            rootSignatureDesc.Init(0, nullptr, 0, nullptr, D3D12_ROOT_SIGNATURE_FLAG_ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT);
+        // Compile the shaders in the background, the pipeline states are created once they are ready
+        // and frames are only cleared until then.
+        m_AssetLoader = std::make_unique<AssetLoader>();
+        m_ShaderJobs = std::make_unique<JobSystem>();
 
-            ComPtr<ID3DBlob> signature;
-            ComPtr<ID3DBlob> error;
-            ThrowIfFailed(D3D12SerializeRootSignature(&rootSignatureDesc, D3D_ROOT_SIGNATURE_VERSION_1, &signature, &error));
-            ThrowIfFailed(m_Device->CreateRootSignature(0, signature->GetBufferPointer(), signature->GetBufferSize(), IID_PPV_ARGS(&m_RootSignature)));
-        }
+        // The scene only uses vertex colors, the other variants of basic.hlsl are never compiled.
+        m_BasicShaderFeatures = ShaderPermutationSpace({{"VERTEX_COLOR"}, {"DESATURATE"}});
+        constexpr std::string_view sceneMaterial[] = {"VERTEX_COLOR"};
+        m_SceneMaterial = m_BasicShaderFeatures.MakeKey(sceneMaterial);
+        m_BasicShaderVariants = m_BasicShaderFeatures.GetReachableKeys({&m_SceneMaterial, 1});
 
-        // Create the pipeline state, which includes compiling and loading shaders.
-        {
-            ComPtr<ID3DBlob> vertexShader;
-            ComPtr<ID3DBlob> pixelShader;
+        m_BasicShader = LoadShaderProgram(GetShaderPath(L"shaders/basic.hlsl"), &Application::CreatePipelineState,
+                                          m_BasicShaderFeatures, m_BasicShaderVariants);
+        m_UpscaleShader = LoadShaderProgram(GetShaderPath(L"shaders/upscale.hlsl"), &Application::CreateUpscalePipelineState);
 
 #ifdef DE_DEBUG
-            // Enable better shader debugging with the graphics debugging tools.
-            constexpr UINT compileFlags = D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION;
-#else
-            constexpr UINT compileFlags = 0;
+        m_ShaderHotReloader = std::make_unique<ShaderHotReloader>();
+        m_ShaderHotReloader->AddProgram(m_BasicShader.GetRequest()->Path);
+        m_ShaderHotReloader->AddProgram(m_UpscaleShader.GetRequest()->Path);
 #endif
 
-            std::wstring shaderPath = GetAssetFullPath(L"shaders/basic.hlsl");
-            
-            ComPtr<ID3DBlob> error;
-
-            HRESULT hr;
-
-            hr = D3DCompileFromFile(shaderPath.c_str(), nullptr, nullptr, "VSMain", "vs_5_0", compileFlags, 0, &vertexShader, &error);
-            if (FAILED(hr)) {
-                if (error) {
-                    std::string output = static_cast<char*>(error->GetBufferPointer());
-                    std::cout << output << std::endl;
-                }
-
-                ThrowIfFailed(hr);
-            }
-
-            hr = D3DCompileFromFile(shaderPath.c_str(), nullptr, nullptr, "PSMain", "ps_5_0", compileFlags, 0, &pixelShader, &error);
-            if (FAILED(hr)) {
-                if (error) {
-                    std::string output = static_cast<char*>(error->GetBufferPointer());
-                    std::cout << output << std::endl;
-                }
-
-                ThrowIfFailed(hr);
-            }
-            
-            // Define the vertex input layout.
-            D3D12_INPUT_ELEMENT_DESC inputElementDescs[] = {
-                { "POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 0, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0},
-                { "COLOR", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, 12, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0}
-            };
-
-            // Describe and create the graphics pipeline state object (PSO).
-            D3D12_GRAPHICS_PIPELINE_STATE_DESC psoDesc = {};
-            psoDesc.InputLayout = {inputElementDescs , _countof(inputElementDescs)};
-            psoDesc.pRootSignature = m_RootSignature.Get();
-            psoDesc.VS = CD3DX12_SHADER_BYTECODE(vertexShader.Get());
-            psoDesc.PS = CD3DX12_SHADER_BYTECODE(pixelShader.Get());
-            psoDesc.RasterizerState = CD3DX12_RASTERIZER_DESC(D3D12_DEFAULT);
-            psoDesc.BlendState = CD3DX12_BLEND_DESC(D3D12_DEFAULT);
-            psoDesc.DepthStencilState.DepthEnable = FALSE;
-            psoDesc.DepthStencilState.StencilEnable = FALSE;
-            psoDesc.SampleMask = UINT_MAX;
-            psoDesc.PrimitiveTopologyType = D3D12_PRIMITIVE_TOPOLOGY_TYPE_TRIANGLE;
-            psoDesc.NumRenderTargets = 1;
-            psoDesc.RTVFormats[0] = DXGI_FORMAT_R8G8B8A8_UNORM;
-            psoDesc.SampleDesc.Count = 1;
-            ThrowIfFailed(m_Device->CreateGraphicsPipelineState(&psoDesc, IID_PPV_ARGS(&m_PipelineState)));
-        }
-
         // Create the command list.
         ThrowIfFailed(m_Device->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_DIRECT, m_CommandAllocator.Get(), nullptr, IID_PPV_ARGS(&m_CommandList)));
 
@@ -265,6 +289,11 @@ namespace D3D12Engine {
         // to record yet. The main loop expects it to be closed, so close it now.
         ThrowIfFailed(m_CommandList->Close());
 
+        // Same for the list carrying the transitions resolved at submit.
+        ThrowIfFailed(m_Device->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_DIRECT, m_CommandAllocator.Get(), nullptr, IID_PPV_ARGS(&m_BarrierCommandList)));
+        ThrowIfFailed(m_BarrierCommandList->Close());
+        m_ResourceStateTracker = std::make_unique<ResourceStateTracker>(m_RenderDevice->GetResourceStates());
+
         // Create the vertex buffer.
         {
             // Define the geometry for a triangle
@@ -274,9 +303,28 @@ namespace D3D12Engine {
                 {{ -0.25f, -0.25f * m_AspectRatio, 0.0f}, {0.0f, 1.0f, 1.0f, 1.0f}},
             };
 
-            constexpr UINT vertexBufferSize = sizeof(triangleVertices);
+            // Pack it, positions to 16 bits within the triangle bounds and colors to 8 bits.
+            constexpr size_t vertexStride = sizeof(VertexPosColor) / sizeof(float);
+            const VertexAttributeStream streams[] = {
+                {&triangleVertices[0].Position.x, vertexStride, 3, true},
+                {&triangleVertices[0].Color.x, vertexStride, 4}
+            };
+            const auto packed = VertexQuantizer<VertexPosColorPacked>::Quantize(streams, _countof(triangleVertices));
+            m_Scene.Create(IndirectDrawCommand{packed.Transforms[0], {3, 1, 0, 0}});
 
-            m_VertexBuffer = std::make_unique<VertexBuffer<VertexPosColor>>(m_Device.Get(), triangleVertices, vertexBufferSize);
+            m_VertexBuffer = std::make_unique<VertexBuffer<VertexPosColorPacked::Vertex>>(*m_RenderDevice, packed.Vertices.data(), packed.ByteSize);
+        }
+
+        // Create the indirect argument buffer, it also holds the draw count.
+        {
+            BufferDesc desc;
+            desc.Size = m_IndirectDrawBuilder.GetBufferSize();
+            desc.Memory = MemoryType::Upload;
+            desc.InitialState = ResourceState::GenericRead;
+            desc.Name = "Indirect draw arguments";
+
+            m_IndirectArguments = m_RenderDevice->CreateBuffer(desc);
+            m_pIndirectArgumentData = m_RenderDevice->Map(m_IndirectArguments);
         }
 
         // Create synchronization objects.
@@ -294,6 +342,99 @@ namespace D3D12Engine {
     }
 
 
+    void Application::CreatePipelineState(const ShaderProgram& program) {
+        // Create the pipeline of every variant.
+        PipelineDesc desc;
+        desc.InputLayout = VertexPosColorPacked::Elements;
+        desc.RootParameters = SceneRootParameters;
+        desc.Name = "Scene";
+
+        const auto keys = program.Variants.GetKeys();
+        const auto variants = program.Variants.GetVariants();
+        for (size_t i = 0; i < keys.size(); ++i) {
+            desc.VertexShader = GetBytecode(variants[i].VertexShader.Get());
+            desc.PixelShader = GetBytecode(variants[i].PixelShader.Get());
+
+            // Reloaded shaders keep the handle, and the command signature that refers to it. Uploads run
+            // between frames and each frame is waited for, the GPU is done with the previous state.
+            if (const PipelineHandle* pPipeline = m_ScenePipelines.Find(keys[i])) {
+                m_RenderDevice->ReplacePipeline(*pPipeline, desc);
+                continue;
+            }
+
+            const PipelineHandle pipeline = m_RenderDevice->CreatePipeline(desc);
+            m_ScenePipelines.Insert(keys[i], pipeline);
+
+            // Variants share the root signature, the command signature works with any of them.
+            if (!m_IndirectSignature.IsValid()) {
+                m_IndirectSignature = m_RenderDevice->CreateCommandSignature(
+                    IndirectDrawBuilder::GetSignatureDesc(pipeline, SceneRenderer::PositionTransformRootIndex));
+            }
+        }
+    }
+
+    void Application::CreateUpscalePipelineState(const ShaderProgram& program) {
+        // The full screen triangle is generated in the vertex shader, no input layout needed.
+        const ShaderVariant& variant = *program.Variants.Find({});
+        PipelineDesc desc;
+        desc.VertexShader = GetBytecode(variant.VertexShader.Get());
+        desc.PixelShader = GetBytecode(variant.PixelShader.Get());
+        desc.RootParameters = UpscaleRootParameters;
+        desc.LinearClampSampler = true;
+        desc.Name = "Upscale";
+
+        if (m_UpscalePipelineState.IsValid()) {
+            m_RenderDevice->ReplacePipeline(m_UpscalePipelineState, desc);
+        } else {
+            m_UpscalePipelineState = m_RenderDevice->CreatePipeline(desc);
+        }
+    }
+
+    void Application::CreateSceneColorTarget(const UINT width, const UINT height) {
+        // The GPU is idle whenever this is called, the previous target can go right away.
+        if (m_SceneColor.IsValid()) {
+            m_RenderDevice->DestroyResource(m_SceneColor);
+        }
+
+        TextureDesc desc;
+        desc.Width = width;
+        desc.Height = height;
+        desc.Format = TextureFormat::R8G8B8A8Unorm;
+        desc.Usage = TextureUsage::ShaderResource | TextureUsage::RenderTarget;
+        desc.InitialState = ResourceState::PixelShaderResource;
+        desc.ClearColor = SceneRenderer::ClearColor;
+        desc.Name = "Scene color";
+
+        m_SceneColor = m_RenderDevice->CreateTexture(desc);
+        m_SceneTargetSize = {width, height};
+    }
+
+    void Application::UpdateSceneSize() {
+        m_SceneSize = m_ResolutionController.ComputeRenderSize(m_SceneTargetSize.Width, m_SceneTargetSize.Height);
+    }
+
+    void Application::BuildIndirectDraws() {
+        // The camera pans in the view plane and its distance scales the scene, fold both
+        // into the dequantization transform: (position - camera) / distance.
+        const float inverseDistance = 1.0f / m_CameraPosition[2];
+
+        m_IndirectDrawBuilder.Reset();
+        m_Scene.ForEach<IndirectDrawCommand>([&](Entity, const IndirectDrawCommand& draw) {
+            VertexAttributeTransform positionTransform = draw.PositionTransform;
+            for (size_t axis = 0; axis < 2; ++axis) {
+                positionTransform.Scale[axis] *= inverseDistance;
+                positionTransform.Offset[axis] = (positionTransform.Offset[axis] - m_CameraPosition[axis]) * inverseDistance;
+            }
+
+            m_IndirectDrawBuilder.Add(positionTransform, draw.Draw);
+        });
+
+        // The previous frame is done on the GPU, so the buffer can be overwritten.
+        m_IndirectDrawBuilder.Write({m_pIndirectArgumentData, m_IndirectDrawBuilder.GetBufferSize()});
+        m_RenderDevice->GetMemoryStatistics().RecordTransient(
+            static_cast<uint64_t>(m_IndirectDrawBuilder.GetCommandCount()) * IndirectDrawBuilder::CommandStride + sizeof(uint32_t));
+    }
+
     void Application::PopulateCommandList() const {
         // Command list allocators can only be reset when the associated
         // command lists have finished execution on the GPU; apps should use
@@ -303,44 +444,60 @@ namespace D3D12Engine {
         // However, when ExecuteCommandList() is called on a particular command
         // list, that command list can then be reset at any time and must be before
         // re-recording.
-        ThrowIfFailed(m_CommandList->Reset(m_CommandAllocator.Get(), m_PipelineState.Get()));
-
-        // Set necessary states
-        m_CommandList->SetGraphicsRootSignature(m_RootSignature.Get());
-        m_CommandList->RSSetViewports(1, &m_Viewport);
-        m_CommandList->RSSetScissorRects(1, &m_ScissorRect);
-
-        // Indicate that the back buffer will be used as a render target.
-        auto transition = CD3DX12_RESOURCE_BARRIER::Transition(
-            m_RenderTargets[m_FrameIndex].Get(),
-            D3D12_RESOURCE_STATE_PRESENT,
-            D3D12_RESOURCE_STATE_RENDER_TARGET
-        );
-        m_CommandList->ResourceBarrier(1, &transition);
-
-        const CD3DX12_CPU_DESCRIPTOR_HANDLE rtvHandle(m_RtvHeap->GetCPUDescriptorHandleForHeapStart(), static_cast<INT>(m_FrameIndex),
-                                                      m_RtvDescriptorSize);
-
-        m_CommandList->OMSetRenderTargets(1, &rtvHandle, FALSE, nullptr);
-
-        // Record commands.
-        constexpr float clearColor[] = {0.0f, 0.2f, 0.4f, 1.0f};
-        m_CommandList->ClearRenderTargetView(rtvHandle, clearColor, 0, nullptr);
-        m_CommandList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
-        m_VertexBuffer->Apply(m_CommandList.Get());
-        m_CommandList->DrawInstanced(3, 1, 0, 0);
-
-        // Indicate that the back buffer will now be used to present.
-        transition = CD3DX12_RESOURCE_BARRIER::Transition(
-            m_RenderTargets[m_FrameIndex].Get(),
-            D3D12_RESOURCE_STATE_RENDER_TARGET,
-            D3D12_RESOURCE_STATE_PRESENT
-        );
-        m_CommandList->ResourceBarrier(1, &transition);
+        ThrowIfFailed(m_CommandList->Reset(m_CommandAllocator.Get(), nullptr));
+
+        m_GpuTimer->Begin(m_CommandList.Get());
+        m_ResourceStateTracker->Reset();
+
+        SceneIndirectDraws indirectDraws;
+        indirectDraws.Signature = m_IndirectSignature;
+        indirectDraws.VertexBuffer = m_VertexBuffer->GetView();
+        indirectDraws.MaxCommandCount = m_IndirectDrawBuilder.GetMaxCommandCount();
+        indirectDraws.ArgumentBuffer = m_IndirectArguments;
+        indirectDraws.CountBuffer = m_IndirectArguments;
+        indirectDraws.CountOffset = m_IndirectDrawBuilder.GetCountOffset();
+
+        SceneFrame frame;
+        frame.SceneColor = m_SceneColor;
+        frame.SceneTargetSize = m_SceneTargetSize;
+        frame.SceneSize = m_SceneSize;
+        frame.BackBuffer = m_RenderTargets[m_FrameIndex];
+        frame.OutputSize = m_OutputSize;
+        const PipelineHandle* pScenePipeline = m_ScenePipelines.Find(m_SceneMaterial);
+        frame.ScenePipeline = pScenePipeline ? *pScenePipeline : PipelineHandle{};
+        frame.UpscalePipeline = m_UpscalePipelineState;
+        frame.pIndirectDraws = &indirectDraws;
+
+        D3D12CommandRecorder recorder(*m_RenderDevice, m_CommandList.Get());
+        SceneRenderer::RecordFrame(recorder, *m_ResourceStateTracker, frame);
+
+        m_GpuTimer->End(m_CommandList.Get());
+        m_GpuTimer->Resolve(m_CommandList.Get());
 
         ThrowIfFailed(m_CommandList->Close());
     }
 
+    void Application::ExecuteCommandList() {
+        // Nothing else is submitted in between, the registered states are the ones the frame starts from.
+        std::pmr::vector<ResourceTransition> transitions(&m_FrameArena);
+        m_ResourceStateTracker->Resolve(transitions);
+
+        ID3D12CommandList* ppCommandLists[2];
+        UINT commandListCount = 0;
+        if (!transitions.empty()) {
+            // The allocator isn't in use by the main list anymore, it was closed.
+            ThrowIfFailed(m_BarrierCommandList->Reset(m_CommandAllocator.Get(), nullptr));
+            D3D12CommandRecorder recorder(*m_RenderDevice, m_BarrierCommandList.Get());
+            recorder.ResourceBarrier(transitions);
+            ThrowIfFailed(m_BarrierCommandList->Close());
+
+            ppCommandLists[commandListCount++] = m_BarrierCommandList.Get();
+        }
+
+        ppCommandLists[commandListCount++] = m_CommandList.Get();
+        m_CommandQueue->ExecuteCommandLists(commandListCount, ppCommandLists);
+    }
+
     void Application::WaitForPreviousFrame() {
         // Signal and increment the fence value.
         const UINT64 fence = m_FenceValue;
@@ -356,6 +513,251 @@ namespace D3D12Engine {
         m_FrameIndex = m_SwapChain->GetCurrentBackBufferIndex();
     }
 
+    void Application::ReloadChangedShaders() {
+        // Frames go on with the previous pipeline states while the shaders compile, and keep
+        // them for good if compiling fails, the errors are printed by CompileShader().
+        for (const auto& program : m_ShaderHotReloader->Poll(GetTimeSeconds())) {
+            if (program == ShaderDependencyGraph::Normalize(m_BasicShader.GetRequest()->Path)) {
+                // A compile still in flight would swap an older version in after this one.
+                m_BasicShader.Cancel();
+                m_BasicShader = LoadShaderProgram(program, &Application::CreatePipelineState, m_BasicShaderFeatures, m_BasicShaderVariants);
+            } else if (program == ShaderDependencyGraph::Normalize(m_UpscaleShader.GetRequest()->Path)) {
+                m_UpscaleShader.Cancel();
+                m_UpscaleShader = LoadShaderProgram(program, &Application::CreateUpscalePipelineState);
+            }
+        }
+    }
+
+    AssetHandle<Application::ShaderProgram> Application::LoadShaderProgram(const std::filesystem::path& shaderPath,
+                                                                            void (Application::*onLoaded)(const ShaderProgram&),
+                                                                            const ShaderPermutationSpace& features,
+                                                                            std::vector<ShaderPermutationKey> variants) {
+        return m_AssetLoader->Load<ShaderProgram>(
+            shaderPath,
+            AssetPriority::Critical,
+            [this, sourceName = shaderPath.string(), features, variants = std::move(variants)](const std::span<const std::byte> source) {
+                // Both stages of every variant compile in parallel, errors are rethrown once all are done.
+                const auto compileCount = static_cast<uint32_t>(variants.size() * 2);
+                std::vector<ComPtr<ID3DBlob>> shaders(compileCount);
+                std::vector<std::exception_ptr> errors(compileCount);
+
+                m_ShaderJobs->ParallelFor(compileCount, 1, [&](const uint32_t begin, const uint32_t end) {
+                    for (uint32_t i = begin; i < end; ++i) {
+                        try {
+                            const std::vector<ShaderDefine> defines = features.GetDefines(variants[i / 2]);
+                            shaders[i] = i % 2 == 0 ? CompileShader(source, sourceName, defines, "VSMain", "vs_5_0")
+                                                    : CompileShader(source, sourceName, defines, "PSMain", "ps_5_0");
+                        } catch (...) {
+                            errors[i] = std::current_exception();
+                        }
+                    }
+                });
+
+                for (const auto& error : errors) {
+                    if (error) {
+                        std::rethrow_exception(error);
+                    }
+                }
+
+                auto program = std::make_unique<ShaderProgram>();
+                for (size_t i = 0; i < variants.size(); ++i) {
+                    program->Variants.Insert(variants[i], {std::move(shaders[i * 2]), std::move(shaders[i * 2 + 1])});
+                }
+
+                return program;
+            },
+            [this, onLoaded](ShaderProgram& program) {
+                (this->*onLoaded)(program);
+            });
+    }
+
+    ComPtr<ID3DBlob> Application::CompileShader(const std::span<const std::byte> source, const std::string& sourceName,
+                                                const std::span<const ShaderDefine> defines, const char* entryPoint, const char* target) {
+#ifdef DE_DEBUG
+        // Enable better shader debugging with the graphics debugging tools.
+        constexpr UINT compileFlags = D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION;
+#else
+        constexpr UINT compileFlags = 0;
+#endif
+
+        ComPtr<ID3DBlob> shader;
+        ComPtr<ID3DBlob> error;
+
+        std::vector<D3D_SHADER_MACRO> macros;
+        macros.reserve(defines.size() + 1);
+        for (const auto& define : defines) {
+            macros.push_back({define.Name.c_str(), define.Value.c_str()});
+        }
+        macros.push_back({nullptr, nullptr});
+
+        const HRESULT hr = D3DCompile(source.data(), source.size(), sourceName.c_str(), macros.data(), D3D_COMPILE_STANDARD_FILE_INCLUDE,
+                                      entryPoint, target, compileFlags, 0, &shader, &error);
+        if (FAILED(hr)) {
+            if (error) {
+                std::string output = static_cast<char*>(error->GetBufferPointer());
+                std::cout << output << std::endl;
+            }
+
+            ThrowIfFailed(hr, "Failed to compile shader.");
+        }
+
+        return shader;
+    }
+
+    void Application::CreateRenderTargetViews() {
+        // Register each frame's buffer with the render device, which creates its RTV.
+        for (UINT i = 0; i < FrameCount; i++) {
+            ComPtr<ID3D12Resource> renderTarget;
+            ThrowIfFailed(m_SwapChain->GetBuffer(i, IID_PPV_ARGS(&renderTarget)), "Failed to get RTV buffer.");
+            m_RenderTargets[i] = m_RenderDevice->RegisterResource(std::move(renderTarget), TextureUsage::RenderTarget);
+        }
+    }
+
+    void Application::Resize(const WindowSize size) {
+        // Only the frames in flight need to finish, nothing else is torn down.
+        WaitForPreviousFrame();
+
+        // The swap chain buffers can't be resized while we still reference them.
+        for (const auto renderTarget : m_RenderTargets) {
+            m_RenderDevice->DestroyResource(renderTarget);
+        }
+
+        DXGI_SWAP_CHAIN_DESC swapChainDesc;
+        ThrowIfFailed(m_SwapChain->GetDesc(&swapChainDesc));
+        ThrowIfFailed(m_SwapChain->ResizeBuffers(FrameCount, size.Width, size.Height, swapChainDesc.BufferDesc.Format, swapChainDesc.Flags),
+                      "Failed to resize swap chain.");
+        m_FrameIndex = m_SwapChain->GetCurrentBackBufferIndex();
+
+        CreateRenderTargetViews();
+        CreateSceneColorTarget(size.Width, size.Height);
+
+        m_OutputSize = {size.Width, size.Height};
+        m_AspectRatio = static_cast<float>(size.Width) / static_cast<float>(size.Height);
+        UpdateSceneSize();
+    }
+
+    void Application::StartBenchmark(const BenchmarkSettings& settings) {
+        // A loop around the scene, moving closer halfway through.
+        constexpr CameraKeyframe path[] = {
+            {0.0, { 0.00f,  0.00f, 1.00f}},
+            {2.0, { 0.30f,  0.10f, 1.25f}},
+            {4.0, { 0.00f,  0.25f, 0.60f}},
+            {6.0, {-0.30f,  0.10f, 0.80f}},
+            {8.0, { 0.00f,  0.00f, 1.00f}},
+        };
+
+        m_Benchmark = std::make_unique<BenchmarkRun>(settings);
+        m_BenchmarkCamera = std::make_unique<ScriptedCamera>(path);
+
+        m_Timer.SetFixedTimeStep(true);
+        m_Timer.SetTargetElapsedSeconds(settings.StepSeconds);
+    }
+
+    void Application::RecordBenchmarkFrame() {
+        // Frames are only measured once the scene can be drawn, and from the second one on
+        // so the frame time covers a whole frame.
+        if (!m_ScenePipelines.Find(m_SceneMaterial) || !m_UpscalePipelineState.IsValid() || m_PreviousFrameStartTime == 0.0) {
+            return;
+        }
+
+        FrameSample sample;
+        sample.FrameMs = (m_FrameStartTime - m_PreviousFrameStartTime) * 1000.0;
+        sample.CpuMs = m_FrameCpuMs;
+        sample.GpuMs = m_GpuTimer->GetElapsedMs();
+        sample.MemoryBytes = GetProcessMemoryUsage();
+        m_Benchmark->AddFrame(sample);
+
+        if (!m_Benchmark->IsFinished()) {
+            return;
+        }
+
+        BenchmarkEnvironment environment;
+#ifdef DE_DEBUG
+        environment.Build = "debug";
+#else
+        environment.Build = "release";
+#endif
+        environment.Adapter = GetAdapterName();
+        environment.Width = m_OutputSize.Width;
+        environment.Height = m_OutputSize.Height;
+
+        const BenchmarkSettings& settings = m_Benchmark->GetSettings();
+        m_Benchmark->WriteReport(settings.ReportPath, environment);
+        std::cout << "Benchmark report written to " << settings.ReportPath.string() << '\n';
+
+        m_Benchmark.reset();
+        PostMessage(m_Window->GetHandle(), WM_CLOSE, 0, 0);
+    }
+
+    void Application::UpdateMemoryStatistics() {
+        auto& statistics = m_RenderDevice->GetMemoryStatistics();
+
+        // Written before the next frame starts, so the report has the last frame in full.
+        if (m_MemoryReport && m_FrameStartTime - m_LastMemoryReportTime >= m_MemoryReport->IntervalSeconds) {
+            statistics.WriteReport(m_MemoryReport->Path);
+            m_LastMemoryReportTime = m_FrameStartTime;
+        }
+
+        statistics.BeginFrame();
+
+        if (m_BudgetAdapter) {
+            DXGI_QUERY_VIDEO_MEMORY_INFO local = {};
+            DXGI_QUERY_VIDEO_MEMORY_INFO nonLocal = {};
+            ThrowIfFailed(m_BudgetAdapter->QueryVideoMemoryInfo(0, DXGI_MEMORY_SEGMENT_GROUP_LOCAL, &local));
+            ThrowIfFailed(m_BudgetAdapter->QueryVideoMemoryInfo(0, DXGI_MEMORY_SEGMENT_GROUP_NON_LOCAL, &nonLocal));
+
+            statistics.SetBudget({local.Budget, local.CurrentUsage, local.AvailableForReservation, local.CurrentReservation},
+                                 {nonLocal.Budget, nonLocal.CurrentUsage, nonLocal.AvailableForReservation, nonLocal.CurrentReservation});
+        }
+    }
+
+    std::string Application::GetAdapterName() const {
+        DXGI_ADAPTER_DESC desc;
+        ThrowIfFailed(m_Adapter->GetDesc(&desc));
+
+        const int size = WideCharToMultiByte(CP_UTF8, 0, desc.Description, -1, nullptr, 0, nullptr, nullptr);
+        if (size <= 1) {
+            return {};
+        }
+
+        std::string name(static_cast<size_t>(size - 1), '\0');
+        WideCharToMultiByte(CP_UTF8, 0, desc.Description, -1, name.data(), size, nullptr, nullptr);
+
+        return name;
+    }
+
+    void Application::ProcessInputEvent(const InputEvent& event) {
+        const auto msg = static_cast<UINT>(event.Message);
+        const auto wParam = static_cast<WPARAM>(event.WParam);
+        const auto lParam = static_cast<LPARAM>(event.LParam);
+
+        switch (msg) {
+        case WM_KEYDOWN:
+        case WM_KEYUP:
+        case WM_SYSKEYDOWN:
+        case WM_SYSKEYUP:
+            DirectX::Keyboard::ProcessMessage(msg, wParam, lParam);
+            break;
+        default:
+            DirectX::Mouse::ProcessMessage(msg, wParam, lParam);
+            break;
+        }
+    }
+
+    double Application::GetTimeSeconds() {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    uint64_t Application::GetProcessMemoryUsage() {
+        PROCESS_MEMORY_COUNTERS counters = {};
+        counters.cb = sizeof(counters);
+        if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+            return 0;
+        }
+
+        return counters.WorkingSetSize;
+    }
+
     _Use_decl_annotations_
     void Application::GetHardwareAdapter(IDXGIFactory1* pFactory,
                                          IDXGIAdapter1** ppAdapter,
@@ -413,11 +815,46 @@ namespace D3D12Engine {
         *ppAdapter = adapter.Detach();
     }
 
-    std::wstring Application::GetAssetFullPath(const std::wstring& assetName) {
-        return L"Resources/" + assetName;
+    std::filesystem::path Application::GetAssetFullPath(const std::wstring_view assetName) {
+        constexpr std::wstring_view assetRoot = L"Resources/";
+
+        // Built in place and moved into the path, which then owns the only allocation.
+        std::wstring fullPath;
+        fullPath.reserve(assetRoot.size() + assetName.size());
+        fullPath.append(assetRoot).append(assetName);
+
+        return {std::move(fullPath)};
+    }
+
+    std::filesystem::path Application::GetShaderPath(const std::wstring_view assetName) {
+#ifdef DE_DEBUG
+        // The run directory is two levels below the project (see xmake.lua). Load the shaders from
+        // the source tree when it is there, so edits to them are picked up by the hot reload.
+        if (std::filesystem::path sourcePath = std::filesystem::path(L"../..") / GetAssetFullPath(assetName); std::filesystem::exists(sourcePath)) {
+            return sourcePath;
+        }
+#endif
+
+        return GetAssetFullPath(assetName);
     }
 
     void Application::OnWindowSizeChanged(const int width, const int height) {
-        m_AspectRatio = static_cast<float>(width) / static_cast<float>(height);
+        if (width <= 0 || height <= 0) {
+            return;
+        }
+
+        m_ResizeCoalescer.OnResize({static_cast<uint32_t>(width), static_cast<uint32_t>(height)}, GetTimeSeconds());
+    }
+
+    void Application::OnBeginInteractiveResize() {
+        m_ResizeCoalescer.OnBeginInteractiveResize();
+    }
+
+    void Application::OnEndInteractiveResize() {
+        m_ResizeCoalescer.OnEndInteractiveResize();
+    }
+
+    void Application::OnInputMessage(const UINT msg, const WPARAM wParam, const LPARAM lParam) {
+        m_InputEvents.Push({GetTimeSeconds(), msg, wParam, lParam});
     }
 }
@@ -0,0 +1,253 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/Assets/AssetLoader.hpp>
+
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <system_error>
+
+namespace D3D12Engine {
+    namespace {
+        bool IsTerminal(const AssetState state) {
+            return state == AssetState::Ready || state == AssetState::Failed || state == AssetState::Cancelled;
+        }
+
+        bool ReadFile(AssetRequest& request) {
+            // Directories and devices open fine, but have no size to read.
+            std::error_code error;
+            std::ifstream file;
+            if (std::filesystem::is_regular_file(request.Path, error)) {
+                file.open(request.Path, std::ios::binary | std::ios::ate);
+            }
+
+            if (!file.is_open()) {
+                request.Error = "Failed to open " + request.Path.string();
+                return false;
+            }
+
+            const std::streamoff size = file.tellg();
+            if (size < 0) {
+                request.Error = "Failed to get the size of " + request.Path.string();
+                return false;
+            }
+
+            request.FileData.resize(static_cast<size_t>(size));
+            file.seekg(0);
+            file.read(reinterpret_cast<char*>(request.FileData.data()), size);
+
+            if (file.gcount() != size) {
+                request.Error = "Failed to read " + request.Path.string();
+                return false;
+            }
+
+            return true;
+        }
+    }
+
+    bool AssetRequest::Advance(const AssetState state) {
+        AssetState current = State.load(std::memory_order_acquire);
+        do {
+            if (IsTerminal(current)) {
+                return false;
+            }
+        } while (!State.compare_exchange_weak(current, state, std::memory_order_acq_rel));
+
+        return true;
+    }
+
+    bool AssetLoader::RequestOrder::operator()(const std::shared_ptr<AssetRequest>& a, const std::shared_ptr<AssetRequest>& b) const {
+        // The queues pop the greatest element: highest priority, then oldest request.
+        if (a->Priority != b->Priority) {
+            return a->Priority < b->Priority;
+        }
+
+        return a->Sequence > b->Sequence;
+    }
+
+    AssetLoader::AssetLoader(const AssetLoaderSettings& settings)
+        : m_ReadQueue(settings.ReadQueueCapacity),
+          m_DecodeQueue(settings.DecodeQueueCapacity),
+          m_UploadQueue(settings.UploadQueueCapacity) {
+        m_ReadThread = std::thread([this] { ReadMain(); });
+
+        const uint32_t decodeThreadCount = settings.DecodeThreadCount > 0 ? settings.DecodeThreadCount : 1;
+        m_DecodeThreads.reserve(decodeThreadCount);
+        for (uint32_t i = 0; i < decodeThreadCount; i++) {
+            m_DecodeThreads.emplace_back([this] { DecodeMain(); });
+        }
+    }
+
+    AssetLoader::~AssetLoader() {
+        m_ReadQueue.Close();
+        m_DecodeQueue.Close();
+        m_UploadQueue.Close();
+
+        // Queued work is dropped, the stages only finish what they are busy with.
+        for (RequestQueue* pQueue : {&m_ReadQueue, &m_DecodeQueue, &m_UploadQueue}) {
+            for (const auto& request : pQueue->TakeAll()) {
+                Finish(*request, AssetState::Cancelled);
+            }
+        }
+
+        m_ReadThread.join();
+        for (auto& thread : m_DecodeThreads) {
+            thread.join();
+        }
+    }
+
+    uint32_t AssetLoader::PumpUploads(const uint32_t maxUploads) {
+        uint32_t uploads = 0;
+
+        while (uploads < maxUploads) {
+            auto request = m_UploadQueue.TryPop();
+            if (!request) {
+                break;
+            }
+
+            AssetRequest& current = **request;
+            if (current.State.load(std::memory_order_acquire) == AssetState::Cancelled) {
+                Finish(current, AssetState::Cancelled);
+                continue;
+            }
+
+            try {
+                if (current.Upload) {
+                    current.Upload(current.Asset.get());
+                }
+
+                Finish(current, AssetState::Ready);
+            } catch (const std::exception& e) {
+                current.Error = e.what();
+                Finish(current, AssetState::Failed);
+            }
+
+            uploads++;
+        }
+
+        return uploads;
+    }
+
+    void AssetLoader::Wait(const std::shared_ptr<AssetRequest>& request) {
+        while (!IsTerminal(request->State.load(std::memory_order_acquire))) {
+            if (PumpUploads(1) == 0) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    void AssetLoader::Submit(std::shared_ptr<AssetRequest> request) {
+        request->Sequence = m_NextSequence.fetch_add(1, std::memory_order_relaxed);
+        request->Timings.Queued = AssetTimings::Clock::now();
+
+        // Waiting for room could deadlock the upload thread, which is the one draining the queues.
+        if (!m_ReadQueue.TryPush(request)) {
+            request->Error = "Asset loader read queue is full.";
+            Finish(*request, AssetState::Failed);
+        }
+    }
+
+    void AssetLoader::ReadMain() {
+        while (auto request = m_ReadQueue.Pop()) {
+            AssetRequest& current = **request;
+            if (!current.Advance(AssetState::Reading)) {
+                Finish(current, AssetState::Cancelled);
+                continue;
+            }
+
+            // Nothing catches past this thread, a failed allocation has to fail the request only.
+            bool read = false;
+            try {
+                read = ReadFile(current);
+            } catch (const std::exception& e) {
+                current.Error = e.what();
+            }
+
+            if (!read) {
+                current.FileData = {};
+                Finish(current, AssetState::Failed);
+                continue;
+            }
+
+            m_Stats.BytesRead.fetch_add(current.FileData.size(), std::memory_order_relaxed);
+            current.Timings.ReadFinished = AssetTimings::Clock::now();
+
+            // The queue only fails once the loader is shutting down.
+            if (!m_DecodeQueue.Push(*request)) {
+                Finish(current, AssetState::Cancelled);
+                return;
+            }
+        }
+    }
+
+    void AssetLoader::DecodeMain() {
+        while (auto request = m_DecodeQueue.Pop()) {
+            AssetRequest& current = **request;
+            if (!current.Advance(AssetState::Decoding)) {
+                Finish(current, AssetState::Cancelled);
+                continue;
+            }
+
+            try {
+                current.Asset = current.Decode(current.FileData);
+            } catch (const std::exception& e) {
+                current.Error = e.what();
+            }
+
+            // The raw bytes are not needed past this point.
+            current.FileData = {};
+
+            if (!current.Asset) {
+                if (current.Error.empty()) {
+                    current.Error = "Failed to decode " + current.Path.string();
+                }
+
+                Finish(current, AssetState::Failed);
+                continue;
+            }
+
+            current.Timings.DecodeFinished = AssetTimings::Clock::now();
+
+            if (!current.Advance(AssetState::WaitingForUpload)) {
+                Finish(current, AssetState::Cancelled);
+                continue;
+            }
+
+            if (!m_UploadQueue.Push(*request)) {
+                Finish(current, AssetState::Cancelled);
+                return;
+            }
+        }
+    }
+
+    void AssetLoader::Finish(AssetRequest& request, const AssetState state) {
+        switch (state) {
+        case AssetState::Ready:
+            request.Timings.Ready = AssetTimings::Clock::now();
+            if (request.Advance(AssetState::Ready)) {
+                m_Stats.Completed.fetch_add(1, std::memory_order_relaxed);
+            } else {
+                // Cancelled during the upload, drop what was loaded.
+                request.Asset.reset();
+                m_Stats.Cancelled.fetch_add(1, std::memory_order_relaxed);
+            }
+            break;
+        case AssetState::Failed:
+            request.Asset.reset();
+            if (request.Advance(AssetState::Failed)) {
+                m_Stats.Failed.fetch_add(1, std::memory_order_relaxed);
+            } else {
+                m_Stats.Cancelled.fetch_add(1, std::memory_order_relaxed);
+            }
+            break;
+        default:
+            request.Advance(AssetState::Cancelled);
+            request.Asset.reset();
+            request.FileData = {};
+            m_Stats.Cancelled.fetch_add(1, std::memory_order_relaxed);
+            break;
+        }
+    }
+}
@@ -0,0 +1,693 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/Assets/BlockCompressor.hpp>
+
+#include <D3D12Engine/Core/JobSystem.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#if defined(__SSE__) || defined(_M_X64) || defined(_M_AMD64)
+#define DE_BLOCKCOMPRESSOR_SSE
+#include <xmmintrin.h>
+#endif
+
+namespace D3D12Engine {
+    namespace {
+        using Color = std::array<float, 4>;
+
+        // Channels of a block in separate rows, so four pixels fit in one SSE register.
+        struct BlockChannels {
+            alignas(16) float Values[4][BlockCompressor::BlockPixelCount];
+        };
+
+        BlockChannels LoadChannels(const uint8_t* pPixels) {
+            BlockChannels block;
+            for (uint32_t i = 0; i < BlockCompressor::BlockPixelCount; ++i) {
+                for (uint32_t channel = 0; channel < 4; ++channel) {
+                    block.Values[channel][i] = static_cast<float>(pPixels[i * 4 + channel]);
+                }
+            }
+
+            return block;
+        }
+
+        // Index of the closest palette entry for each pixel, returns the summed squared error.
+        float FindClosestIndices(const BlockChannels& block, const uint32_t channelCount,
+                                 const Color* pPalette, const uint32_t paletteSize, uint8_t* pIndices) {
+#ifdef DE_BLOCKCOMPRESSOR_SSE
+            alignas(16) float errors[BlockCompressor::BlockPixelCount];
+            alignas(16) float indices[BlockCompressor::BlockPixelCount];
+
+            for (uint32_t group = 0; group < BlockCompressor::BlockPixelCount; group += 4) {
+                __m128 bestError = _mm_set1_ps(std::numeric_limits<float>::max());
+                __m128 bestIndex = _mm_setzero_ps();
+
+                for (uint32_t entry = 0; entry < paletteSize; ++entry) {
+                    __m128 error = _mm_setzero_ps();
+                    for (uint32_t channel = 0; channel < channelCount; ++channel) {
+                        const __m128 difference = _mm_sub_ps(_mm_load_ps(&block.Values[channel][group]), _mm_set1_ps(pPalette[entry][channel]));
+                        error = _mm_add_ps(error, _mm_mul_ps(difference, difference));
+                    }
+
+                    const __m128 closer = _mm_cmplt_ps(error, bestError);
+                    bestError = _mm_min_ps(error, bestError);
+                    bestIndex = _mm_or_ps(_mm_and_ps(closer, _mm_set1_ps(static_cast<float>(entry))), _mm_andnot_ps(closer, bestIndex));
+                }
+
+                _mm_store_ps(&errors[group], bestError);
+                _mm_store_ps(&indices[group], bestIndex);
+            }
+
+            float totalError = 0.0f;
+            for (uint32_t i = 0; i < BlockCompressor::BlockPixelCount; ++i) {
+                pIndices[i] = static_cast<uint8_t>(indices[i]);
+                totalError += errors[i];
+            }
+
+            return totalError;
+#else
+            float totalError = 0.0f;
+            for (uint32_t i = 0; i < BlockCompressor::BlockPixelCount; ++i) {
+                float bestError = std::numeric_limits<float>::max();
+                uint8_t bestIndex = 0;
+
+                for (uint32_t entry = 0; entry < paletteSize; ++entry) {
+                    float error = 0.0f;
+                    for (uint32_t channel = 0; channel < channelCount; ++channel) {
+                        const float difference = block.Values[channel][i] - pPalette[entry][channel];
+                        error += difference * difference;
+                    }
+
+                    if (error < bestError) {
+                        bestError = error;
+                        bestIndex = static_cast<uint8_t>(entry);
+                    }
+                }
+
+                pIndices[i] = bestIndex;
+                totalError += bestError;
+            }
+
+            return totalError;
+#endif
+        }
+
+        // Endpoints at both ends of the principal axis of the pixels, moved inwards by the given
+        // fraction of their distance since the extreme pixels are rarely worth a palette entry.
+        void FindEndpoints(const BlockChannels& block, const uint32_t channelCount, const float inset, Color& endpoint0, Color& endpoint1) {
+            constexpr float pixelCount = BlockCompressor::BlockPixelCount;
+
+            Color mean = {};
+            for (uint32_t channel = 0; channel < channelCount; ++channel) {
+                for (const float value : block.Values[channel]) {
+                    mean[channel] += value;
+                }
+                mean[channel] /= pixelCount;
+            }
+
+            float covariance[4][4] = {};
+            for (uint32_t i = 0; i < BlockCompressor::BlockPixelCount; ++i) {
+                for (uint32_t a = 0; a < channelCount; ++a) {
+                    for (uint32_t b = a; b < channelCount; ++b) {
+                        covariance[a][b] += (block.Values[a][i] - mean[a]) * (block.Values[b][i] - mean[b]);
+                    }
+                }
+            }
+
+            // Power iteration, from the channel that varies the most.
+            uint32_t largest = 0;
+            for (uint32_t channel = 0; channel < channelCount; ++channel) {
+                for (uint32_t other = 0; other < channel; ++other) {
+                    covariance[channel][other] = covariance[other][channel];
+                }
+                if (covariance[channel][channel] > covariance[largest][largest]) {
+                    largest = channel;
+                }
+            }
+
+            Color axis = {};
+            axis[largest] = 1.0f;
+            for (uint32_t iteration = 0; iteration < 8; ++iteration) {
+                Color next = {};
+                float lengthSquared = 0.0f;
+                for (uint32_t a = 0; a < channelCount; ++a) {
+                    for (uint32_t b = 0; b < channelCount; ++b) {
+                        next[a] += covariance[a][b] * axis[b];
+                    }
+                    lengthSquared += next[a] * next[a];
+                }
+
+                if (lengthSquared < 1e-12f) {
+                    break;
+                }
+
+                const float scale = 1.0f / std::sqrt(lengthSquared);
+                for (uint32_t channel = 0; channel < channelCount; ++channel) {
+                    axis[channel] = next[channel] * scale;
+                }
+            }
+
+            float minProjection = std::numeric_limits<float>::max();
+            float maxProjection = std::numeric_limits<float>::lowest();
+            for (uint32_t i = 0; i < BlockCompressor::BlockPixelCount; ++i) {
+                float projection = 0.0f;
+                for (uint32_t channel = 0; channel < channelCount; ++channel) {
+                    projection += (block.Values[channel][i] - mean[channel]) * axis[channel];
+                }
+                minProjection = std::min(minProjection, projection);
+                maxProjection = std::max(maxProjection, projection);
+            }
+
+            const float shrink = (maxProjection - minProjection) * inset;
+            minProjection += shrink;
+            maxProjection -= shrink;
+
+            for (uint32_t channel = 0; channel < 4; ++channel) {
+                endpoint0[channel] = std::clamp(mean[channel] + axis[channel] * minProjection, 0.0f, 255.0f);
+                endpoint1[channel] = std::clamp(mean[channel] + axis[channel] * maxProjection, 0.0f, 255.0f);
+            }
+        }
+
+        // Least squares endpoints for the chosen indices, weights give the share of the second
+        // endpoint in each palette entry. Returns false when the indices don't constrain both.
+        bool RefineEndpoints(const BlockChannels& block, const uint32_t channelCount, const uint8_t* pIndices,
+                             const float* pWeights, Color& endpoint0, Color& endpoint1) {
+            float alphaSquared = 0.0f;
+            float betaSquared = 0.0f;
+            float alphaBeta = 0.0f;
+            Color alphaX = {};
+            Color betaX = {};
+
+            for (uint32_t i = 0; i < BlockCompressor::BlockPixelCount; ++i) {
+                const float beta = pWeights[pIndices[i]];
+                const float alpha = 1.0f - beta;
+
+                alphaSquared += alpha * alpha;
+                betaSquared += beta * beta;
+                alphaBeta += alpha * beta;
+                for (uint32_t channel = 0; channel < channelCount; ++channel) {
+                    alphaX[channel] += alpha * block.Values[channel][i];
+                    betaX[channel] += beta * block.Values[channel][i];
+                }
+            }
+
+            const float determinant = alphaSquared * betaSquared - alphaBeta * alphaBeta;
+            if (std::abs(determinant) < 1e-6f) {
+                return false;
+            }
+
+            const float inverse = 1.0f / determinant;
+            for (uint32_t channel = 0; channel < channelCount; ++channel) {
+                endpoint0[channel] = std::clamp((alphaX[channel] * betaSquared - betaX[channel] * alphaBeta) * inverse, 0.0f, 255.0f);
+                endpoint1[channel] = std::clamp((betaX[channel] * alphaSquared - alphaX[channel] * alphaBeta) * inverse, 0.0f, 255.0f);
+            }
+
+            return true;
+        }
+
+        // Little endian bit stream over a 16 byte block.
+        class BlockBits {
+        public:
+            explicit BlockBits(const std::byte* pBlock = nullptr) {
+                if (pBlock != nullptr) {
+                    std::memcpy(m_Words, pBlock, sizeof(m_Words));
+                }
+            }
+
+            void Write(const uint32_t value, const uint32_t bitCount) {
+                for (uint32_t bit = 0; bit < bitCount; ++bit, ++m_Position) {
+                    m_Words[m_Position / 64] |= static_cast<uint64_t>((value >> bit) & 1) << (m_Position % 64);
+                }
+            }
+
+            uint32_t Read(const uint32_t bitCount) {
+                uint32_t value = 0;
+                for (uint32_t bit = 0; bit < bitCount; ++bit, ++m_Position) {
+                    value |= static_cast<uint32_t>((m_Words[m_Position / 64] >> (m_Position % 64)) & 1) << bit;
+                }
+
+                return value;
+            }
+
+            void Store(std::byte* pBlock) const {
+                std::memcpy(pBlock, m_Words, sizeof(m_Words));
+            }
+
+        private:
+            uint64_t m_Words[2] = {};
+            uint32_t m_Position = 0;
+        };
+
+        uint16_t QuantizeRgb565(const Color& color) {
+            const auto r = static_cast<uint16_t>(std::lround(color[0] * 31.0f / 255.0f));
+            const auto g = static_cast<uint16_t>(std::lround(color[1] * 63.0f / 255.0f));
+            const auto b = static_cast<uint16_t>(std::lround(color[2] * 31.0f / 255.0f));
+
+            return static_cast<uint16_t>(r << 11 | g << 5 | b);
+        }
+
+        std::array<uint8_t, 3> ExpandRgb565(const uint16_t color) {
+            const uint32_t r = color >> 11 & 0x1F;
+            const uint32_t g = color >> 5 & 0x3F;
+            const uint32_t b = color & 0x1F;
+
+            return {static_cast<uint8_t>(r << 3 | r >> 2), static_cast<uint8_t>(g << 2 | g >> 4), static_cast<uint8_t>(b << 3 | b >> 2)};
+        }
+
+        // Palette of a BC1 block, as the decoder computes it.
+        std::array<std::array<uint8_t, 4>, 4> GetBC1Palette(const uint16_t color0, const uint16_t color1) {
+            const auto c0 = ExpandRgb565(color0);
+            const auto c1 = ExpandRgb565(color1);
+
+            std::array<std::array<uint8_t, 4>, 4> palette;
+            palette[0] = {c0[0], c0[1], c0[2], 255};
+            palette[1] = {c1[0], c1[1], c1[2], 255};
+
+            for (size_t channel = 0; channel < 3; ++channel) {
+                if (color0 > color1) {
+                    palette[2][channel] = static_cast<uint8_t>((2 * c0[channel] + c1[channel]) / 3);
+                    palette[3][channel] = static_cast<uint8_t>((c0[channel] + 2 * c1[channel]) / 3);
+                } else {
+                    palette[2][channel] = static_cast<uint8_t>((c0[channel] + c1[channel]) / 2);
+                    palette[3][channel] = 0;
+                }
+            }
+            palette[2][3] = 255;
+            palette[3][3] = color0 > color1 ? 255 : 0;
+
+            return palette;
+        }
+
+        std::array<uint8_t, 8> GetBC4Palette(const uint8_t value0, const uint8_t value1) {
+            std::array<uint8_t, 8> palette = {value0, value1};
+            if (value0 > value1) {
+                for (uint32_t i = 2; i < 8; ++i) {
+                    palette[i] = static_cast<uint8_t>(((8 - i) * value0 + (i - 1) * value1) / 7);
+                }
+            } else {
+                for (uint32_t i = 2; i < 6; ++i) {
+                    palette[i] = static_cast<uint8_t>(((6 - i) * value0 + (i - 1) * value1) / 5);
+                }
+                palette[6] = 0;
+                palette[7] = 255;
+            }
+
+            return palette;
+        }
+
+        void EncodeBC4Block(const BlockChannels& block, const uint32_t channel, std::byte* pBlock) {
+            // Share of the second endpoint in each entry of the eight value palette.
+            constexpr float weights[8] = {0.0f, 1.0f, 1.0f / 7.0f, 2.0f / 7.0f, 3.0f / 7.0f, 4.0f / 7.0f, 5.0f / 7.0f, 6.0f / 7.0f};
+
+            BlockChannels values;
+            std::memcpy(values.Values[0], block.Values[channel], sizeof(values.Values[0]));
+
+            const auto [minValue, maxValue] = std::ranges::minmax(values.Values[0]);
+            Color endpoint0 = {maxValue};
+            Color endpoint1 = {minValue};
+
+            float bestError = std::numeric_limits<float>::max();
+            uint8_t bestValues[2] = {};
+            uint8_t bestIndices[BlockCompressor::BlockPixelCount] = {};
+
+            for (uint32_t iteration = 0; iteration < 2; ++iteration) {
+                auto value0 = static_cast<uint8_t>(std::lround(endpoint0[0]));
+                auto value1 = static_cast<uint8_t>(std::lround(endpoint1[0]));
+                // The eight value palette needs the first value to be the largest.
+                if (value0 < value1) {
+                    std::swap(value0, value1);
+                    std::swap(endpoint0, endpoint1);
+                }
+
+                uint8_t indices[BlockCompressor::BlockPixelCount] = {};
+                float error;
+                if (value0 == value1) {
+                    const Color solid = {static_cast<float>(value0)};
+                    error = FindClosestIndices(values, 1, &solid, 1, indices);
+                } else {
+                    const auto palette = GetBC4Palette(value0, value1);
+                    Color entries[8];
+                    for (uint32_t i = 0; i < 8; ++i) {
+                        entries[i] = {static_cast<float>(palette[i])};
+                    }
+                    error = FindClosestIndices(values, 1, entries, 8, indices);
+                }
+
+                if (error < bestError) {
+                    bestError = error;
+                    bestValues[0] = value0;
+                    bestValues[1] = value1;
+                    std::memcpy(bestIndices, indices, sizeof(indices));
+                }
+
+                if (value0 == value1 || !RefineEndpoints(values, 1, indices, weights, endpoint0, endpoint1)) {
+                    break;
+                }
+            }
+
+            uint64_t bits = 0;
+            for (uint32_t i = 0; i < BlockCompressor::BlockPixelCount; ++i) {
+                bits |= static_cast<uint64_t>(bestIndices[i]) << (i * 3);
+            }
+
+            pBlock[0] = static_cast<std::byte>(bestValues[0]);
+            pBlock[1] = static_cast<std::byte>(bestValues[1]);
+            for (uint32_t i = 0; i < 6; ++i) {
+                pBlock[2 + i] = static_cast<std::byte>(bits >> (i * 8));
+            }
+        }
+
+        void DecodeBC4Block(const std::byte* pBlock, const uint32_t channel, uint8_t* pPixels) {
+            const auto palette = GetBC4Palette(static_cast<uint8_t>(pBlock[0]), static_cast<uint8_t>(pBlock[1]));
+
+            uint64_t bits = 0;
+            for (uint32_t i = 0; i < 6; ++i) {
+                bits |= static_cast<uint64_t>(pBlock[2 + i]) << (i * 8);
+            }
+
+            for (uint32_t i = 0; i < BlockCompressor::BlockPixelCount; ++i) {
+                pPixels[i * 4 + channel] = palette[bits >> (i * 3) & 0x7];
+            }
+        }
+
+        // Interpolation weights of the 4 bit BC7 indices, out of 64.
+        constexpr uint32_t BC7Weights[16] = {0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+        constexpr uint32_t BC7Mode6 = 1u << 6;
+
+        // Mode 6 endpoints have 7 bits per channel and a shared lowest bit, keep the one
+        // closest to the color.
+        void QuantizeBC7Endpoint(const Color& color, uint8_t* pQuantized, uint32_t& pBit) {
+            float bestError = std::numeric_limits<float>::max();
+
+            for (uint32_t p = 0; p < 2; ++p) {
+                uint8_t quantized[4];
+                float error = 0.0f;
+                for (uint32_t channel = 0; channel < 4; ++channel) {
+                    quantized[channel] = static_cast<uint8_t>(std::clamp(std::lround((color[channel] - static_cast<float>(p)) * 0.5f), 0l, 127l));
+                    const float difference = static_cast<float>(quantized[channel] << 1 | p) - color[channel];
+                    error += difference * difference;
+                }
+
+                if (error < bestError) {
+                    bestError = error;
+                    pBit = p;
+                    std::memcpy(pQuantized, quantized, sizeof(quantized));
+                }
+            }
+        }
+
+        uint8_t InterpolateBC7(const uint32_t value0, const uint32_t value1, const uint32_t index) {
+            return static_cast<uint8_t>(((64 - BC7Weights[index]) * value0 + BC7Weights[index] * value1 + 32) >> 6);
+        }
+    }
+
+    bool BlockCompressor::IsSupported(const TextureFormat format) {
+        switch (format) {
+        case TextureFormat::BC1Unorm:
+        case TextureFormat::BC1UnormSrgb:
+        case TextureFormat::BC5Unorm:
+        case TextureFormat::BC7Unorm:
+        case TextureFormat::BC7UnormSrgb:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    void BlockCompressor::EncodeBC1Block(const uint8_t* pPixels, std::byte* pBlock) {
+        // Share of the second endpoint in each entry of the four color palette.
+        constexpr float weights[4] = {0.0f, 1.0f, 1.0f / 3.0f, 2.0f / 3.0f};
+
+        const BlockChannels block = LoadChannels(pPixels);
+
+        Color endpoint0;
+        Color endpoint1;
+        FindEndpoints(block, 3, 1.0f / 16.0f, endpoint0, endpoint1);
+
+        float bestError = std::numeric_limits<float>::max();
+        uint16_t bestColors[2] = {};
+        uint8_t bestIndices[BlockPixelCount] = {};
+
+        for (uint32_t iteration = 0; iteration < 2; ++iteration) {
+            uint16_t color0 = QuantizeRgb565(endpoint0);
+            uint16_t color1 = QuantizeRgb565(endpoint1);
+            // The four color palette needs the first color to be the largest.
+            if (color0 < color1) {
+                std::swap(color0, color1);
+                std::swap(endpoint0, endpoint1);
+            }
+
+            const auto palette = GetBC1Palette(color0, color1);
+            Color entries[4];
+            for (uint32_t i = 0; i < 4; ++i) {
+                entries[i] = {static_cast<float>(palette[i][0]), static_cast<float>(palette[i][1]), static_cast<float>(palette[i][2])};
+            }
+
+            // Equal colors leave the three color palette, only use its first entry.
+            uint8_t indices[BlockPixelCount] = {};
+            const float error = FindClosestIndices(block, 3, entries, color0 == color1 ? 1 : 4, indices);
+            if (error < bestError) {
+                bestError = error;
+                bestColors[0] = color0;
+                bestColors[1] = color1;
+                std::memcpy(bestIndices, indices, sizeof(indices));
+            }
+
+            if (color0 == color1 || !RefineEndpoints(block, 3, indices, weights, endpoint0, endpoint1)) {
+                break;
+            }
+        }
+
+        uint32_t indexBits = 0;
+        for (uint32_t i = 0; i < BlockPixelCount; ++i) {
+            indexBits |= static_cast<uint32_t>(bestIndices[i]) << (i * 2);
+        }
+
+        pBlock[0] = static_cast<std::byte>(bestColors[0]);
+        pBlock[1] = static_cast<std::byte>(bestColors[0] >> 8);
+        pBlock[2] = static_cast<std::byte>(bestColors[1]);
+        pBlock[3] = static_cast<std::byte>(bestColors[1] >> 8);
+        for (uint32_t i = 0; i < 4; ++i) {
+            pBlock[4 + i] = static_cast<std::byte>(indexBits >> (i * 8));
+        }
+    }
+
+    void BlockCompressor::EncodeBC5Block(const uint8_t* pPixels, std::byte* pBlock) {
+        const BlockChannels block = LoadChannels(pPixels);
+
+        EncodeBC4Block(block, 0, pBlock);
+        EncodeBC4Block(block, 1, pBlock + 8);
+    }
+
+    void BlockCompressor::EncodeBC7Block(const uint8_t* pPixels, std::byte* pBlock) {
+        float weights[16];
+        for (uint32_t i = 0; i < 16; ++i) {
+            weights[i] = static_cast<float>(BC7Weights[i]) / 64.0f;
+        }
+
+        const BlockChannels block = LoadChannels(pPixels);
+
+        Color endpoint0;
+        Color endpoint1;
+        FindEndpoints(block, 4, 1.0f / 32.0f, endpoint0, endpoint1);
+
+        float bestError = std::numeric_limits<float>::max();
+        uint8_t bestEndpoints[2][4] = {};
+        uint32_t bestPBits[2] = {};
+        uint8_t bestIndices[BlockPixelCount] = {};
+
+        for (uint32_t iteration = 0; iteration < 2; ++iteration) {
+            uint8_t quantized[2][4];
+            uint32_t pBits[2];
+            QuantizeBC7Endpoint(endpoint0, quantized[0], pBits[0]);
+            QuantizeBC7Endpoint(endpoint1, quantized[1], pBits[1]);
+
+            Color entries[16];
+            for (uint32_t i = 0; i < 16; ++i) {
+                for (uint32_t channel = 0; channel < 4; ++channel) {
+                    const uint32_t value0 = quantized[0][channel] << 1 | pBits[0];
+                    const uint32_t value1 = quantized[1][channel] << 1 | pBits[1];
+                    entries[i][channel] = static_cast<float>(InterpolateBC7(value0, value1, i));
+                }
+            }
+
+            uint8_t indices[BlockPixelCount];
+            const float error = FindClosestIndices(block, 4, entries, 16, indices);
+            if (error < bestError) {
+                bestError = error;
+                std::memcpy(bestEndpoints, quantized, sizeof(quantized));
+                bestPBits[0] = pBits[0];
+                bestPBits[1] = pBits[1];
+                std::memcpy(bestIndices, indices, sizeof(indices));
+            }
+
+            if (!RefineEndpoints(block, 4, indices, weights, endpoint0, endpoint1)) {
+                break;
+            }
+        }
+
+        // The first index is stored without its top bit, swap the endpoints when it is set.
+        if (bestIndices[0] & 0x8) {
+            std::swap(bestEndpoints[0], bestEndpoints[1]);
+            std::swap(bestPBits[0], bestPBits[1]);
+            for (uint8_t& index : bestIndices) {
+                index = static_cast<uint8_t>(15 - index);
+            }
+        }
+
+        BlockBits bits;
+        bits.Write(BC7Mode6, 7);
+        for (uint32_t channel = 0; channel < 4; ++channel) {
+            bits.Write(bestEndpoints[0][channel], 7);
+            bits.Write(bestEndpoints[1][channel], 7);
+        }
+        bits.Write(bestPBits[0], 1);
+        bits.Write(bestPBits[1], 1);
+        for (uint32_t i = 0; i < BlockPixelCount; ++i) {
+            bits.Write(bestIndices[i], i == 0 ? 3 : 4);
+        }
+        bits.Store(pBlock);
+    }
+
+    void BlockCompressor::DecodeBlock(const TextureFormat format, const std::byte* pBlock, uint8_t* pPixels) {
+        switch (format) {
+        case TextureFormat::BC1Unorm:
+        case TextureFormat::BC1UnormSrgb: {
+            const auto color0 = static_cast<uint16_t>(static_cast<uint8_t>(pBlock[0]) | static_cast<uint8_t>(pBlock[1]) << 8);
+            const auto color1 = static_cast<uint16_t>(static_cast<uint8_t>(pBlock[2]) | static_cast<uint8_t>(pBlock[3]) << 8);
+            const auto palette = GetBC1Palette(color0, color1);
+
+            for (uint32_t i = 0; i < BlockPixelCount; ++i) {
+                const auto index = static_cast<uint8_t>(pBlock[4 + i / 4]) >> (i % 4 * 2) & 0x3;
+                std::memcpy(&pPixels[i * 4], palette[index].data(), 4);
+            }
+            break;
+        }
+        case TextureFormat::BC5Unorm:
+            DecodeBC4Block(pBlock, 0, pPixels);
+            DecodeBC4Block(pBlock + 8, 1, pPixels);
+            for (uint32_t i = 0; i < BlockPixelCount; ++i) {
+                pPixels[i * 4 + 2] = 0;
+                pPixels[i * 4 + 3] = 255;
+            }
+            break;
+        case TextureFormat::BC7Unorm:
+        case TextureFormat::BC7UnormSrgb: {
+            BlockBits bits(pBlock);
+            if (bits.Read(7) != BC7Mode6) {
+                throw std::runtime_error("Only BC7 mode 6 blocks can be decoded.");
+            }
+
+            uint32_t endpoints[2][4];
+            for (uint32_t channel = 0; channel < 4; ++channel) {
+                endpoints[0][channel] = bits.Read(7);
+                endpoints[1][channel] = bits.Read(7);
+            }
+
+            const uint32_t pBit0 = bits.Read(1);
+            const uint32_t pBit1 = bits.Read(1);
+            for (uint32_t channel = 0; channel < 4; ++channel) {
+                endpoints[0][channel] = endpoints[0][channel] << 1 | pBit0;
+                endpoints[1][channel] = endpoints[1][channel] << 1 | pBit1;
+            }
+
+            for (uint32_t i = 0; i < BlockPixelCount; ++i) {
+                const uint32_t index = bits.Read(i == 0 ? 3 : 4);
+                for (uint32_t channel = 0; channel < 4; ++channel) {
+                    pPixels[i * 4 + channel] = InterpolateBC7(endpoints[0][channel], endpoints[1][channel], index);
+                }
+            }
+            break;
+        }
+        default:
+            throw std::invalid_argument("Unsupported block compressed format.");
+        }
+    }
+
+    void BlockCompressor::Compress(const TextureImage& image, const TextureFormat format, const std::span<std::byte> output, JobSystem* pJobSystem) {
+        void (*encodeBlock)(const uint8_t*, std::byte*);
+        switch (format) {
+        case TextureFormat::BC1Unorm:
+        case TextureFormat::BC1UnormSrgb:
+            encodeBlock = &EncodeBC1Block;
+            break;
+        case TextureFormat::BC5Unorm:
+            encodeBlock = &EncodeBC5Block;
+            break;
+        case TextureFormat::BC7Unorm:
+        case TextureFormat::BC7UnormSrgb:
+            encodeBlock = &EncodeBC7Block;
+            break;
+        default:
+            throw std::invalid_argument("Unsupported block compressed format.");
+        }
+
+        if (output.size() < GetSurfaceByteSize(format, image.Width, image.Height)) {
+            throw std::invalid_argument("Block compression output is too small.");
+        }
+
+        const uint32_t blocksWide = (image.Width + 3) / 4;
+        const uint32_t blocksHigh = (image.Height + 3) / 4;
+        const uint32_t blockSize = GetFormatElementSize(format);
+
+        const auto encodeRows = [&](const uint32_t begin, const uint32_t end) {
+            uint8_t pixels[BlockPixelCount * 4];
+
+            for (uint32_t blockY = begin; blockY < end; ++blockY) {
+                for (uint32_t blockX = 0; blockX < blocksWide; ++blockX) {
+                    for (uint32_t i = 0; i < BlockPixelCount; ++i) {
+                        const uint32_t x = std::min(blockX * 4 + i % 4, image.Width - 1);
+                        const uint32_t y = std::min(blockY * 4 + i / 4, image.Height - 1);
+                        std::memcpy(&pixels[i * 4], &image.Pixels[(static_cast<size_t>(y) * image.Width + x) * 4], 4);
+                    }
+
+                    encodeBlock(pixels, &output[(static_cast<size_t>(blockY) * blocksWide + blockX) * blockSize]);
+                }
+            }
+        };
+
+        if (pJobSystem != nullptr) {
+            pJobSystem->ParallelFor(blocksHigh, 1, encodeRows);
+        } else {
+            encodeRows(0, blocksHigh);
+        }
+    }
+
+    TextureImage BlockCompressor::Decompress(const std::span<const std::byte> data, const TextureFormat format, const uint32_t width, const uint32_t height) {
+        if (data.size() < GetSurfaceByteSize(format, width, height)) {
+            throw std::invalid_argument("Block compressed data is too small.");
+        }
+
+        const uint32_t blocksWide = (width + 3) / 4;
+        const uint32_t blocksHigh = (height + 3) / 4;
+        const uint32_t blockSize = GetFormatElementSize(format);
+
+        TextureImage image{width, height, {}};
+        image.Pixels.resize(static_cast<size_t>(width) * height * 4);
+
+        uint8_t pixels[BlockPixelCount * 4];
+        for (uint32_t blockY = 0; blockY < blocksHigh; ++blockY) {
+            for (uint32_t blockX = 0; blockX < blocksWide; ++blockX) {
+                DecodeBlock(format, &data[(static_cast<size_t>(blockY) * blocksWide + blockX) * blockSize], pixels);
+
+                for (uint32_t i = 0; i < BlockPixelCount; ++i) {
+                    const uint32_t x = blockX * 4 + i % 4;
+                    const uint32_t y = blockY * 4 + i / 4;
+                    if (x < width && y < height) {
+                        std::memcpy(&image.Pixels[(static_cast<size_t>(y) * width + x) * 4], &pixels[i * 4], 4);
+                    }
+                }
+            }
+        }
+
+        return image;
+    }
+}
@@ -0,0 +1,232 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/Assets/DdsFile.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <stdexcept>
+
+namespace D3D12Engine {
+    namespace {
+        constexpr uint32_t MakeFourCC(const char a, const char b, const char c, const char d) {
+            return static_cast<uint32_t>(static_cast<uint8_t>(a)) |
+                   static_cast<uint32_t>(static_cast<uint8_t>(b)) << 8 |
+                   static_cast<uint32_t>(static_cast<uint8_t>(c)) << 16 |
+                   static_cast<uint32_t>(static_cast<uint8_t>(d)) << 24;
+        }
+
+        constexpr uint32_t DdsMagic = MakeFourCC('D', 'D', 'S', ' ');
+
+        constexpr uint32_t DdsFlagCaps = 0x1;
+        constexpr uint32_t DdsFlagHeight = 0x2;
+        constexpr uint32_t DdsFlagWidth = 0x4;
+        constexpr uint32_t DdsFlagPixelFormat = 0x1000;
+        constexpr uint32_t DdsFlagMipMapCount = 0x20000;
+        constexpr uint32_t DdsFlagLinearSize = 0x80000;
+        constexpr uint32_t DdsFlagDepth = 0x800000;
+
+        constexpr uint32_t DdsCapsTexture = 0x1000;
+        constexpr uint32_t DdsCapsComplex = 0x8;
+        constexpr uint32_t DdsCapsMipMap = 0x400000;
+        constexpr uint32_t DdsCaps2CubeMap = 0x200;
+
+        constexpr uint32_t DdsPixelFormatFourCC = 0x4;
+        constexpr uint32_t DdsPixelFormatRgb = 0x40;
+
+        constexpr uint32_t DdsResourceDimensionTexture2D = 3;
+        constexpr uint32_t DdsResourceMiscTextureCube = 0x4;
+
+        struct DdsPixelFormat {
+            uint32_t Size;
+            uint32_t Flags;
+            uint32_t FourCC;
+            uint32_t RgbBitCount;
+            uint32_t RBitMask;
+            uint32_t GBitMask;
+            uint32_t BBitMask;
+            uint32_t ABitMask;
+        };
+
+        struct DdsHeader {
+            uint32_t Size;
+            uint32_t Flags;
+            uint32_t Height;
+            uint32_t Width;
+            uint32_t PitchOrLinearSize;
+            uint32_t Depth;
+            uint32_t MipMapCount;
+            uint32_t Reserved1[11];
+            DdsPixelFormat PixelFormat;
+            uint32_t Caps;
+            uint32_t Caps2;
+            uint32_t Caps3;
+            uint32_t Caps4;
+            uint32_t Reserved2;
+        };
+
+        struct DdsHeaderDxt10 {
+            uint32_t DxgiFormat;
+            uint32_t ResourceDimension;
+            uint32_t MiscFlag;
+            uint32_t ArraySize;
+            uint32_t MiscFlags2;
+        };
+
+        static_assert(sizeof(DdsHeader) == 124, "DDS header must be 124 bytes.");
+        static_assert(sizeof(DdsHeaderDxt10) == 20, "DDS DX10 header must be 20 bytes.");
+
+        TextureFormat GetLegacyFormat(const DdsPixelFormat& pixelFormat) {
+            if (pixelFormat.Flags & DdsPixelFormatFourCC) {
+                switch (pixelFormat.FourCC) {
+                case MakeFourCC('D', 'X', 'T', '1'):
+                    return TextureFormat::BC1Unorm;
+                case MakeFourCC('D', 'X', 'T', '2'):
+                case MakeFourCC('D', 'X', 'T', '3'):
+                    return TextureFormat::BC2Unorm;
+                case MakeFourCC('D', 'X', 'T', '4'):
+                case MakeFourCC('D', 'X', 'T', '5'):
+                    return TextureFormat::BC3Unorm;
+                case MakeFourCC('A', 'T', 'I', '1'):
+                case MakeFourCC('B', 'C', '4', 'U'):
+                    return TextureFormat::BC4Unorm;
+                case MakeFourCC('B', 'C', '4', 'S'):
+                    return TextureFormat::BC4Snorm;
+                case MakeFourCC('A', 'T', 'I', '2'):
+                case MakeFourCC('B', 'C', '5', 'U'):
+                    return TextureFormat::BC5Unorm;
+                case MakeFourCC('B', 'C', '5', 'S'):
+                    return TextureFormat::BC5Snorm;
+                default:
+                    return TextureFormat::Unknown;
+                }
+            }
+
+            if ((pixelFormat.Flags & DdsPixelFormatRgb) && pixelFormat.RgbBitCount == 32) {
+                if (pixelFormat.RBitMask == 0x000000ff && pixelFormat.GBitMask == 0x0000ff00 && pixelFormat.BBitMask == 0x00ff0000) {
+                    return TextureFormat::R8G8B8A8Unorm;
+                }
+
+                if (pixelFormat.RBitMask == 0x00ff0000 && pixelFormat.GBitMask == 0x0000ff00 && pixelFormat.BBitMask == 0x000000ff) {
+                    return TextureFormat::B8G8R8A8Unorm;
+                }
+            }
+
+            return TextureFormat::Unknown;
+        }
+    }
+
+    DdsLayout DdsFile::ParseHeader(const std::span<const std::byte> data) {
+        if (data.size() < sizeof(uint32_t) + sizeof(DdsHeader)) {
+            throw std::runtime_error("DDS file is too small to contain a header.");
+        }
+
+        uint32_t magic;
+        std::memcpy(&magic, data.data(), sizeof(magic));
+        if (magic != DdsMagic) {
+            throw std::runtime_error("Not a DDS file.");
+        }
+
+        DdsHeader header;
+        std::memcpy(&header, data.data() + sizeof(uint32_t), sizeof(header));
+        if (header.Size != sizeof(DdsHeader) || header.PixelFormat.Size != sizeof(DdsPixelFormat)) {
+            throw std::runtime_error("Invalid DDS header size.");
+        }
+
+        if ((header.Flags & DdsFlagDepth) || (header.Caps2 & DdsCaps2CubeMap)) {
+            throw std::runtime_error("Only 2D DDS textures can be streamed.");
+        }
+
+        if (header.Width == 0 || header.Height == 0) {
+            throw std::runtime_error("DDS texture has no texels.");
+        }
+
+        DdsLayout layout;
+        layout.Width = header.Width;
+        layout.Height = header.Height;
+
+        uint64_t dataOffset = sizeof(uint32_t) + sizeof(DdsHeader);
+
+        if ((header.PixelFormat.Flags & DdsPixelFormatFourCC) && header.PixelFormat.FourCC == MakeFourCC('D', 'X', '1', '0')) {
+            if (data.size() < dataOffset + sizeof(DdsHeaderDxt10)) {
+                throw std::runtime_error("DDS file is too small to contain a DX10 header.");
+            }
+
+            DdsHeaderDxt10 dx10Header;
+            std::memcpy(&dx10Header, data.data() + dataOffset, sizeof(dx10Header));
+            dataOffset += sizeof(DdsHeaderDxt10);
+
+            if (dx10Header.ResourceDimension != DdsResourceDimensionTexture2D ||
+                dx10Header.ArraySize > 1 ||
+                (dx10Header.MiscFlag & DdsResourceMiscTextureCube)) {
+                throw std::runtime_error("Only 2D DDS textures can be streamed.");
+            }
+
+            layout.Format = static_cast<TextureFormat>(dx10Header.DxgiFormat);
+        } else {
+            layout.Format = GetLegacyFormat(header.PixelFormat);
+        }
+
+        if (GetFormatElementSize(layout.Format) == 0) {
+            throw std::runtime_error("Unsupported DDS pixel format.");
+        }
+
+        const uint32_t mipCount = (header.Flags & DdsFlagMipMapCount) && header.MipMapCount > 0 ? header.MipMapCount : 1;
+        if (mipCount > std::bit_width(std::max(header.Width, header.Height))) {
+            throw std::runtime_error("DDS texture has more mips than its size allows.");
+        }
+
+        BuildMipChain(layout, mipCount, dataOffset);
+
+        return layout;
+    }
+
+    std::vector<std::byte> DdsFile::WriteHeader(DdsLayout& layout) {
+        const uint32_t mipCount = std::max(layout.GetMipCount(), 1u);
+        BuildMipChain(layout, mipCount, MaxHeaderSize);
+
+        DdsHeader header{};
+        header.Size = sizeof(DdsHeader);
+        header.Flags = DdsFlagCaps | DdsFlagHeight | DdsFlagWidth | DdsFlagPixelFormat | DdsFlagMipMapCount | DdsFlagLinearSize;
+        header.Height = layout.Height;
+        header.Width = layout.Width;
+        header.PitchOrLinearSize = static_cast<uint32_t>(layout.Mips.front().ByteSize);
+        header.MipMapCount = mipCount;
+        header.PixelFormat.Size = sizeof(DdsPixelFormat);
+        header.PixelFormat.Flags = DdsPixelFormatFourCC;
+        header.PixelFormat.FourCC = MakeFourCC('D', 'X', '1', '0');
+        header.Caps = DdsCapsTexture | (mipCount > 1 ? DdsCapsComplex | DdsCapsMipMap : 0);
+
+        DdsHeaderDxt10 dx10Header{};
+        dx10Header.DxgiFormat = static_cast<uint32_t>(layout.Format);
+        dx10Header.ResourceDimension = DdsResourceDimensionTexture2D;
+        dx10Header.ArraySize = 1;
+
+        std::vector<std::byte> bytes(MaxHeaderSize);
+        std::memcpy(bytes.data(), &DdsMagic, sizeof(DdsMagic));
+        std::memcpy(bytes.data() + sizeof(DdsMagic), &header, sizeof(header));
+        std::memcpy(bytes.data() + sizeof(DdsMagic) + sizeof(header), &dx10Header, sizeof(dx10Header));
+
+        return bytes;
+    }
+
+    void DdsFile::BuildMipChain(DdsLayout& layout, const uint32_t mipCount, const uint64_t dataOffset) {
+        layout.Mips.clear();
+        layout.Mips.reserve(mipCount);
+
+        uint32_t width = layout.Width;
+        uint32_t height = layout.Height;
+        uint64_t offset = dataOffset;
+
+        for (uint32_t mip = 0; mip < mipCount; mip++) {
+            const uint64_t size = GetSurfaceByteSize(layout.Format, width, height);
+            layout.Mips.push_back({width, height, offset, size});
+
+            offset += size;
+            width = std::max(width / 2, 1u);
+            height = std::max(height / 2, 1u);
+        }
+    }
+}
@@ -0,0 +1,203 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/Assets/ImageFile.hpp>
+
+#include <D3D12Engine/Assets/DdsFile.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+namespace D3D12Engine {
+    namespace {
+        constexpr size_t TgaHeaderSize = 18;
+
+        constexpr uint8_t TgaTypeTrueColor = 2;
+        constexpr uint8_t TgaTypeGrayscale = 3;
+        constexpr uint8_t TgaTypeTrueColorRle = 10;
+        constexpr uint8_t TgaTypeGrayscaleRle = 11;
+
+        // Origin in the top left corner instead of the bottom left one.
+        constexpr uint8_t TgaDescriptorTopOrigin = 0x20;
+
+        uint16_t ReadUInt16(const std::span<const std::byte> data, const size_t offset) {
+            return static_cast<uint16_t>(static_cast<uint8_t>(data[offset]) | static_cast<uint8_t>(data[offset + 1]) << 8);
+        }
+
+        std::vector<std::byte> ReadFile(const std::filesystem::path& path) {
+            std::ifstream file(path, std::ios::binary | std::ios::ate);
+            if (!file) {
+                throw std::runtime_error("Failed to open image " + path.string() + ".");
+            }
+
+            std::vector<std::byte> data(static_cast<size_t>(file.tellg()));
+            file.seekg(0);
+            if (!file.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(data.size()))) {
+                throw std::runtime_error("Failed to read image " + path.string() + ".");
+            }
+
+            return data;
+        }
+    }
+
+    TextureImage ImageFile::Load(const std::filesystem::path& path) {
+        std::string extension = path.extension().string();
+        std::ranges::transform(extension, extension.begin(), [](const char c) {
+            return static_cast<char>(c >= 'A' && c <= 'Z' ? c - 'A' + 'a' : c);
+        });
+
+        if (extension == ".tga") {
+            return LoadTga(ReadFile(path));
+        }
+
+        if (extension == ".dds") {
+            return LoadDds(ReadFile(path));
+        }
+
+        throw std::runtime_error("Unsupported image format " + extension + ".");
+    }
+
+    TextureImage ImageFile::LoadTga(const std::span<const std::byte> data) {
+        if (data.size() < TgaHeaderSize) {
+            throw std::runtime_error("TGA file is too small to contain a header.");
+        }
+
+        const auto idLength = static_cast<uint8_t>(data[0]);
+        const auto colorMapType = static_cast<uint8_t>(data[1]);
+        const auto imageType = static_cast<uint8_t>(data[2]);
+        const uint16_t colorMapLength = ReadUInt16(data, 5);
+        const auto colorMapEntrySize = static_cast<uint8_t>(data[7]);
+        const uint16_t width = ReadUInt16(data, 12);
+        const uint16_t height = ReadUInt16(data, 14);
+        const auto pixelDepth = static_cast<uint8_t>(data[16]);
+        const auto descriptor = static_cast<uint8_t>(data[17]);
+
+        const bool grayscale = imageType == TgaTypeGrayscale || imageType == TgaTypeGrayscaleRle;
+        const bool rle = imageType == TgaTypeTrueColorRle || imageType == TgaTypeGrayscaleRle;
+        if (!grayscale && imageType != TgaTypeTrueColor && !rle) {
+            throw std::runtime_error("Only truecolor and grayscale TGA images are supported.");
+        }
+
+        if (grayscale ? pixelDepth != 8 : pixelDepth != 24 && pixelDepth != 32) {
+            throw std::runtime_error("Unsupported TGA pixel depth.");
+        }
+
+        if (width == 0 || height == 0) {
+            throw std::runtime_error("TGA image is empty.");
+        }
+
+        // The color map of non color mapped images is only skipped.
+        size_t offset = TgaHeaderSize + idLength;
+        if (colorMapType != 0) {
+            offset += static_cast<size_t>(colorMapLength) * ((colorMapEntrySize + 7) / 8);
+        }
+
+        const size_t bytesPerPixel = pixelDepth / 8;
+        const size_t pixelCount = static_cast<size_t>(width) * height;
+
+        TextureImage image;
+        image.Width = width;
+        image.Height = height;
+        image.Pixels.resize(pixelCount * 4);
+
+        const bool topOrigin = (descriptor & TgaDescriptorTopOrigin) != 0;
+        const auto storePixel = [&](const size_t index, const std::byte* pSource) {
+            // Rows are stored bottom up unless the descriptor says otherwise.
+            const size_t x = index % width;
+            const size_t y = topOrigin ? index / width : height - 1 - index / width;
+            uint8_t* pDestination = &image.Pixels[(y * width + x) * 4];
+
+            if (grayscale) {
+                const auto value = static_cast<uint8_t>(pSource[0]);
+                pDestination[0] = value;
+                pDestination[1] = value;
+                pDestination[2] = value;
+                pDestination[3] = 255;
+            } else {
+                pDestination[0] = static_cast<uint8_t>(pSource[2]);
+                pDestination[1] = static_cast<uint8_t>(pSource[1]);
+                pDestination[2] = static_cast<uint8_t>(pSource[0]);
+                pDestination[3] = bytesPerPixel == 4 ? static_cast<uint8_t>(pSource[3]) : 255;
+            }
+        };
+
+        const auto require = [&](const size_t size) {
+            if (offset + size > data.size()) {
+                throw std::runtime_error("TGA file is truncated.");
+            }
+        };
+
+        if (!rle) {
+            require(pixelCount * bytesPerPixel);
+            for (size_t i = 0; i < pixelCount; ++i) {
+                storePixel(i, &data[offset + i * bytesPerPixel]);
+            }
+
+            return image;
+        }
+
+        // Packets of up to 128 pixels, either one pixel repeated or raw pixels.
+        for (size_t i = 0; i < pixelCount;) {
+            require(1);
+            const auto packet = static_cast<uint8_t>(data[offset++]);
+            const size_t count = std::min<size_t>((packet & 0x7F) + 1, pixelCount - i);
+
+            if (packet & 0x80) {
+                require(bytesPerPixel);
+                for (size_t j = 0; j < count; ++j) {
+                    storePixel(i++, &data[offset]);
+                }
+                offset += bytesPerPixel;
+            } else {
+                require(count * bytesPerPixel);
+                for (size_t j = 0; j < count; ++j) {
+                    storePixel(i++, &data[offset]);
+                    offset += bytesPerPixel;
+                }
+            }
+        }
+
+        return image;
+    }
+
+    TextureImage ImageFile::LoadDds(const std::span<const std::byte> data) {
+        const DdsLayout layout = DdsFile::ParseHeader(data);
+
+        bool swapRedBlue;
+        switch (layout.Format) {
+        case TextureFormat::R8G8B8A8Unorm:
+        case TextureFormat::R8G8B8A8UnormSrgb:
+            swapRedBlue = false;
+            break;
+        case TextureFormat::B8G8R8A8Unorm:
+        case TextureFormat::B8G8R8A8UnormSrgb:
+            swapRedBlue = true;
+            break;
+        default:
+            throw std::runtime_error("Only uncompressed RGBA8 and BGRA8 DDS images can be cooked.");
+        }
+
+        const DdsMipLevel& mip = layout.Mips.front();
+        if (mip.FileOffset + mip.ByteSize > data.size()) {
+            throw std::runtime_error("DDS file is truncated.");
+        }
+
+        TextureImage image;
+        image.Width = mip.Width;
+        image.Height = mip.Height;
+        image.Pixels.resize(mip.ByteSize);
+
+        const std::byte* pSource = data.data() + mip.FileOffset;
+        for (size_t i = 0; i < image.Pixels.size(); i += 4) {
+            image.Pixels[i + 0] = static_cast<uint8_t>(pSource[i + (swapRedBlue ? 2 : 0)]);
+            image.Pixels[i + 1] = static_cast<uint8_t>(pSource[i + 1]);
+            image.Pixels[i + 2] = static_cast<uint8_t>(pSource[i + (swapRedBlue ? 0 : 2)]);
+            image.Pixels[i + 3] = static_cast<uint8_t>(pSource[i + 3]);
+        }
+
+        return image;
+    }
+}
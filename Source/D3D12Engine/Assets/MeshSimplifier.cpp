@@ -0,0 +1,506 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/Assets/MeshSimplifier.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
+namespace D3D12Engine {
+    namespace {
+        constexpr uint32_t Dimension = 3 + MeshSimplifier::MaxAttributeComponents;
+        constexpr uint32_t MatrixSize = Dimension * (Dimension + 1) / 2;
+        // Weight of the planes keeping border vertices on the border, relative to triangle quadrics.
+        constexpr double BorderWeight = 10.0;
+
+        using Point = std::array<double, Dimension>;
+
+        double Dot(const Point& a, const Point& b) {
+            double result = 0.0;
+            for (uint32_t i = 0; i < Dimension; ++i) {
+                result += a[i] * b[i];
+            }
+
+            return result;
+        }
+
+        // Error(v) = v.A.v + 2 b.v + c, A symmetric and stored as its upper triangle. Terms are
+        // weighted by triangle area, Weight holds the total so errors can be made a distance again.
+        struct Quadric {
+            std::array<double, MatrixSize> A{};
+            Point B{};
+            double C = 0.0;
+            double Weight = 0.0;
+
+            void Add(const Quadric& other) {
+                for (uint32_t i = 0; i < MatrixSize; ++i) {
+                    A[i] += other.A[i];
+                }
+
+                for (uint32_t i = 0; i < Dimension; ++i) {
+                    B[i] += other.B[i];
+                }
+
+                C += other.C;
+                Weight += other.Weight;
+            }
+
+            [[nodiscard]] double Evaluate(const Point& v) const {
+                double result = C;
+                uint32_t k = 0;
+                for (uint32_t i = 0; i < Dimension; ++i) {
+                    result += A[k++] * v[i] * v[i];
+                    for (uint32_t j = i + 1; j < Dimension; ++j) {
+                        result += 2.0 * A[k++] * v[i] * v[j];
+                    }
+
+                    result += 2.0 * B[i] * v[i];
+                }
+
+                // Rounding can take it slightly below zero.
+                return std::max(result, 0.0);
+            }
+
+            // Area weighted mean squared distance.
+            [[nodiscard]] double EvaluateNormalized(const Point& v) const {
+                return Weight > 0.0 ? Evaluate(v) / Weight : Evaluate(v);
+            }
+
+            // Squared distance to the plane of the triangle in the combined space, weighted by the triangle area.
+            static Quadric FromTriangle(const Point& p, const Point& q, const Point& r, const double area) {
+                Quadric quadric;
+
+                Point e1;
+                Point e2;
+                for (uint32_t i = 0; i < Dimension; ++i) {
+                    e1[i] = q[i] - p[i];
+                    e2[i] = r[i] - p[i];
+                }
+
+                const double e1Length = std::sqrt(Dot(e1, e1));
+                if (e1Length == 0.0) {
+                    return quadric;
+                }
+
+                for (auto& value : e1) {
+                    value /= e1Length;
+                }
+
+                const double projection = Dot(e2, e1);
+                for (uint32_t i = 0; i < Dimension; ++i) {
+                    e2[i] -= projection * e1[i];
+                }
+
+                const double e2Length = std::sqrt(Dot(e2, e2));
+                if (e2Length == 0.0) {
+                    return quadric;
+                }
+
+                for (auto& value : e2) {
+                    value /= e2Length;
+                }
+
+                const double pe1 = Dot(p, e1);
+                const double pe2 = Dot(p, e2);
+
+                uint32_t k = 0;
+                for (uint32_t i = 0; i < Dimension; ++i) {
+                    for (uint32_t j = i; j < Dimension; ++j) {
+                        quadric.A[k++] = ((i == j ? 1.0 : 0.0) - e1[i] * e1[j] - e2[i] * e2[j]) * area;
+                    }
+
+                    quadric.B[i] = (pe1 * e1[i] + pe2 * e2[i] - p[i]) * area;
+                }
+
+                quadric.C = (Dot(p, p) - pe1 * pe1 - pe2 * pe2) * area;
+                quadric.Weight = area;
+
+                return quadric;
+            }
+
+            // Squared distance to a plane of the position space, attributes don't matter.
+            static Quadric FromPlane(const std::array<double, 3>& normal, const double distance, const double weight) {
+                Quadric quadric;
+
+                uint32_t k = 0;
+                for (uint32_t i = 0; i < Dimension; ++i) {
+                    for (uint32_t j = i; j < Dimension; ++j) {
+                        quadric.A[k++] = i < 3 && j < 3 ? normal[i] * normal[j] * weight : 0.0;
+                    }
+
+                    quadric.B[i] = i < 3 ? normal[i] * distance * weight : 0.0;
+                }
+
+                quadric.C = distance * distance * weight;
+
+                return quadric;
+            }
+        };
+
+        struct Collapse {
+            double Cost;
+            uint32_t From;
+            uint32_t To;
+            bool IsBorder;
+        };
+
+        std::array<double, 3> TriangleNormal(const Point& a, const Point& b, const Point& c) {
+            const double e1[] = {b[0] - a[0], b[1] - a[1], b[2] - a[2]};
+            const double e2[] = {c[0] - a[0], c[1] - a[1], c[2] - a[2]};
+
+            return {e1[1] * e2[2] - e1[2] * e2[1], e1[2] * e2[0] - e1[0] * e2[2], e1[0] * e2[1] - e1[1] * e2[0]};
+        }
+
+        // Positions are centered and scaled to a unit radius so errors are relative to the mesh size.
+        std::vector<Point> BuildPoints(const VertexAttributeStream& positions, const std::span<const VertexAttributeStream> attributes,
+                                       const size_t vertexCount, const float attributeWeight) {
+            uint32_t attributeComponents = 0;
+            for (const auto& attribute : attributes) {
+                attributeComponents += attribute.ComponentCount;
+            }
+
+            if (positions.ComponentCount < 3 || attributeComponents > MeshSimplifier::MaxAttributeComponents) {
+                throw std::invalid_argument("Simplification needs 3D positions and at most 4 attribute components.");
+            }
+
+            std::array<double, 3> min = {std::numeric_limits<double>::max(), std::numeric_limits<double>::max(), std::numeric_limits<double>::max()};
+            std::array<double, 3> max = {std::numeric_limits<double>::lowest(), std::numeric_limits<double>::lowest(), std::numeric_limits<double>::lowest()};
+            for (size_t vertex = 0; vertex < vertexCount; ++vertex) {
+                const float* pPosition = positions.Data + vertex * positions.Stride;
+                for (uint32_t axis = 0; axis < 3; ++axis) {
+                    min[axis] = std::min(min[axis], static_cast<double>(pPosition[axis]));
+                    max[axis] = std::max(max[axis], static_cast<double>(pPosition[axis]));
+                }
+            }
+
+            const double radius = vertexCount > 0
+                                      ? std::sqrt((max[0] - min[0]) * (max[0] - min[0]) + (max[1] - min[1]) * (max[1] - min[1]) +
+                                                  (max[2] - min[2]) * (max[2] - min[2])) * 0.5
+                                      : 0.0;
+            const double inverseRadius = radius > 0.0 ? 1.0 / radius : 1.0;
+
+            std::vector<Point> points(vertexCount);
+            for (size_t vertex = 0; vertex < vertexCount; ++vertex) {
+                Point& point = points[vertex];
+                const float* pPosition = positions.Data + vertex * positions.Stride;
+                for (uint32_t axis = 0; axis < 3; ++axis) {
+                    point[axis] = (pPosition[axis] - (min[axis] + max[axis]) * 0.5) * inverseRadius;
+                }
+
+                uint32_t component = 3;
+                for (const auto& attribute : attributes) {
+                    const float* pAttribute = attribute.Data + vertex * attribute.Stride;
+                    for (uint32_t i = 0; i < attribute.ComponentCount; ++i) {
+                        point[component++] = pAttribute[i] * attributeWeight;
+                    }
+                }
+            }
+
+            return points;
+        }
+
+        void ValidateTriangles(const std::span<const uint32_t> indices, const size_t vertexCount) {
+            if (indices.size() % 3 != 0) {
+                throw std::invalid_argument("Only triangle lists can be simplified.");
+            }
+
+            for (const uint32_t index : indices) {
+                if (index >= vertexCount) {
+                    throw std::invalid_argument("Index out of range.");
+                }
+            }
+        }
+
+        std::vector<uint32_t> SimplifyPoints(const std::vector<Point>& points, const std::span<const uint32_t> sourceIndices,
+                                             const size_t targetIndexCount, const float maxError, float* pError) {
+            const size_t vertexCount = points.size();
+            ValidateTriangles(sourceIndices, vertexCount);
+            std::vector<uint32_t> indices(sourceIndices.begin(), sourceIndices.end());
+
+            std::vector<Quadric> quadrics(vertexCount);
+            for (size_t i = 0; i < indices.size(); i += 3) {
+                const Point& p = points[indices[i]];
+                const Point& q = points[indices[i + 1]];
+                const Point& r = points[indices[i + 2]];
+                const auto normal = TriangleNormal(p, q, r);
+                const double area = std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]) * 0.5;
+
+                const Quadric quadric = Quadric::FromTriangle(p, q, r, area);
+                quadrics[indices[i]].Add(quadric);
+                quadrics[indices[i + 1]].Add(quadric);
+                quadrics[indices[i + 2]].Add(quadric);
+            }
+
+            // Border edges also get the plane through them perpendicular to their triangle,
+            // so moving a border vertex off the border line costs something.
+            {
+                std::vector<std::pair<uint64_t, uint32_t>> halfEdges;
+                halfEdges.reserve(indices.size());
+                for (size_t i = 0; i < indices.size(); ++i) {
+                    const uint32_t a = indices[i];
+                    const uint32_t b = indices[i - i % 3 + (i + 1) % 3];
+                    halfEdges.emplace_back(static_cast<uint64_t>(std::min(a, b)) << 32 | std::max(a, b), static_cast<uint32_t>(i));
+                }
+
+                std::sort(halfEdges.begin(), halfEdges.end());
+                for (size_t i = 0; i < halfEdges.size(); ++i) {
+                    const bool shared = (i > 0 && halfEdges[i - 1].first == halfEdges[i].first) ||
+                                        (i + 1 < halfEdges.size() && halfEdges[i + 1].first == halfEdges[i].first);
+                    if (shared) {
+                        continue;
+                    }
+
+                    const uint32_t corner = halfEdges[i].second;
+                    const uint32_t* pTriangle = &indices[corner - corner % 3];
+                    const uint32_t a = indices[corner];
+                    const uint32_t b = indices[corner - corner % 3 + (corner + 1) % 3];
+
+                    const auto normal = TriangleNormal(points[pTriangle[0]], points[pTriangle[1]], points[pTriangle[2]]);
+                    const std::array<double, 3> edge = {points[b][0] - points[a][0], points[b][1] - points[a][1], points[b][2] - points[a][2]};
+                    std::array<double, 3> planeNormal = {edge[1] * normal[2] - edge[2] * normal[1],
+                                                         edge[2] * normal[0] - edge[0] * normal[2],
+                                                         edge[0] * normal[1] - edge[1] * normal[0]};
+                    const double planeLength = std::sqrt(planeNormal[0] * planeNormal[0] + planeNormal[1] * planeNormal[1] + planeNormal[2] * planeNormal[2]);
+                    if (planeLength == 0.0) {
+                        continue;
+                    }
+
+                    for (auto& value : planeNormal) {
+                        value /= planeLength;
+                    }
+
+                    const double distance = -(planeNormal[0] * points[a][0] + planeNormal[1] * points[a][1] + planeNormal[2] * points[a][2]);
+                    const double edgeLengthSquared = edge[0] * edge[0] + edge[1] * edge[1] + edge[2] * edge[2];
+                    const Quadric quadric = Quadric::FromPlane(planeNormal, distance, edgeLengthSquared * BorderWeight);
+                    quadrics[a].Add(quadric);
+                    quadrics[b].Add(quadric);
+                }
+            }
+
+            const double maxCost = static_cast<double>(maxError) * maxError;
+            double reachedCost = 0.0;
+
+            std::vector<uint32_t> adjacencyOffsets;
+            std::vector<uint32_t> adjacency;
+            std::vector<uint64_t> edges;
+            std::vector<uint8_t> isBorderVertex(vertexCount);
+            std::vector<uint8_t> locked(vertexCount);
+            std::vector<uint32_t> remap(vertexCount);
+            std::vector<Collapse> collapses;
+
+            // Each pass collapses a set of independent edges, cheapest first, then rebuilds the topology.
+            while (indices.size() > targetIndexCount) {
+                const size_t triangleCount = indices.size() / 3;
+
+                adjacencyOffsets.assign(vertexCount + 1, 0);
+                for (const uint32_t index : indices) {
+                    adjacencyOffsets[index + 1]++;
+                }
+
+                std::partial_sum(adjacencyOffsets.begin(), adjacencyOffsets.end(), adjacencyOffsets.begin());
+                adjacency.resize(indices.size());
+                {
+                    std::vector<uint32_t> fill(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+                    for (size_t i = 0; i < indices.size(); ++i) {
+                        adjacency[fill[indices[i]]++] = static_cast<uint32_t>(i / 3);
+                    }
+                }
+
+                // Edges as (min, max) pairs, an edge used by a single triangle is on the border.
+                edges.clear();
+                for (size_t triangle = 0; triangle < triangleCount; ++triangle) {
+                    for (uint32_t corner = 0; corner < 3; ++corner) {
+                        const uint32_t a = indices[triangle * 3 + corner];
+                        const uint32_t b = indices[triangle * 3 + (corner + 1) % 3];
+                        edges.push_back(static_cast<uint64_t>(std::min(a, b)) << 32 | std::max(a, b));
+                    }
+                }
+
+                std::sort(edges.begin(), edges.end());
+                std::fill(isBorderVertex.begin(), isBorderVertex.end(), 0);
+                collapses.clear();
+
+                for (size_t i = 0; i < edges.size();) {
+                    size_t count = 1;
+                    while (i + count < edges.size() && edges[i + count] == edges[i]) {
+                        count++;
+                    }
+
+                    const auto a = static_cast<uint32_t>(edges[i] >> 32);
+                    const auto b = static_cast<uint32_t>(edges[i]);
+                    const bool isBorder = count == 1;
+                    if (isBorder) {
+                        isBorderVertex[a] = 1;
+                        isBorderVertex[b] = 1;
+                    }
+
+                    collapses.push_back({0.0, a, b, isBorder});
+                    i += count;
+                }
+
+                for (auto& collapse : collapses) {
+                    const uint32_t a = collapse.From;
+                    const uint32_t b = collapse.To;
+                    Quadric quadric = quadrics[a];
+                    quadric.Add(quadrics[b]);
+
+                    // Border vertices may only move along the border.
+                    const bool canMoveA = !isBorderVertex[a] || (collapse.IsBorder && isBorderVertex[b]);
+                    const bool canMoveB = !isBorderVertex[b] || (collapse.IsBorder && isBorderVertex[a]);
+                    const double costAToB = canMoveA ? quadric.EvaluateNormalized(points[b]) : std::numeric_limits<double>::max();
+                    const double costBToA = canMoveB ? quadric.EvaluateNormalized(points[a]) : std::numeric_limits<double>::max();
+
+                    if (costBToA < costAToB) {
+                        collapse = {costBToA, b, a, collapse.IsBorder};
+                    } else {
+                        collapse.Cost = costAToB;
+                    }
+                }
+
+                std::sort(collapses.begin(), collapses.end(), [](const Collapse& a, const Collapse& b) {
+                    return a.Cost < b.Cost;
+                });
+
+                std::fill(locked.begin(), locked.end(), 0);
+                std::iota(remap.begin(), remap.end(), 0u);
+
+                const size_t trianglesToRemove = (indices.size() - targetIndexCount + 2) / 3;
+                size_t removedTriangles = 0;
+                size_t collapseCount = 0;
+
+                // Locking makes a pass skip many candidates. Instead of reaching for expensive ones
+                // to make up for it, stop a bit past the cost the goal would have needed and let
+                // the next pass, on the updated mesh, continue.
+                const size_t collapseGoal = trianglesToRemove / 2;
+                const double passCost = collapseGoal < collapses.size() ? collapses[collapseGoal].Cost * 1.5 : std::numeric_limits<double>::max();
+
+                for (const Collapse& collapse : collapses) {
+                    if (collapse.Cost > maxCost || removedTriangles >= trianglesToRemove) {
+                        break;
+                    }
+
+                    if (collapse.Cost > passCost && removedTriangles > trianglesToRemove / 10) {
+                        break;
+                    }
+
+                    if (locked[collapse.From] || locked[collapse.To]) {
+                        continue;
+                    }
+
+                    // Reject collapses that flip or badly fold a remaining triangle around the moved vertex.
+                    bool flips = false;
+                    for (uint32_t j = adjacencyOffsets[collapse.From]; j < adjacencyOffsets[collapse.From + 1] && !flips; ++j) {
+                        const uint32_t* pTriangle = &indices[adjacency[j] * 3];
+                        if (pTriangle[0] == collapse.To || pTriangle[1] == collapse.To || pTriangle[2] == collapse.To) {
+                            continue;
+                        }
+
+                        const Point* before[3];
+                        const Point* after[3];
+                        for (uint32_t corner = 0; corner < 3; ++corner) {
+                            before[corner] = &points[pTriangle[corner]];
+                            after[corner] = pTriangle[corner] == collapse.From ? &points[collapse.To] : before[corner];
+                        }
+
+                        const auto n0 = TriangleNormal(*before[0], *before[1], *before[2]);
+                        const auto n1 = TriangleNormal(*after[0], *after[1], *after[2]);
+                        const double dot = n0[0] * n1[0] + n0[1] * n1[1] + n0[2] * n1[2];
+                        const double lengths = std::sqrt((n0[0] * n0[0] + n0[1] * n0[1] + n0[2] * n0[2]) * (n1[0] * n1[0] + n1[1] * n1[1] + n1[2] * n1[2]));
+                        flips = dot <= 0.25 * lengths;
+                    }
+
+                    if (flips) {
+                        continue;
+                    }
+
+                    remap[collapse.From] = collapse.To;
+                    quadrics[collapse.To].Add(quadrics[collapse.From]);
+                    reachedCost = std::max(reachedCost, collapse.Cost);
+
+                    // Lock the whole neighbourhood, the flip test of later collapses assumes it didn't move.
+                    for (uint32_t j = adjacencyOffsets[collapse.From]; j < adjacencyOffsets[collapse.From + 1]; ++j) {
+                        const uint32_t* pTriangle = &indices[adjacency[j] * 3];
+                        locked[pTriangle[0]] = 1;
+                        locked[pTriangle[1]] = 1;
+                        locked[pTriangle[2]] = 1;
+                    }
+
+                    removedTriangles += collapse.IsBorder ? 1 : 2;
+                    collapseCount++;
+                }
+
+                if (collapseCount == 0) {
+                    break;
+                }
+
+                size_t writeIndex = 0;
+                for (size_t i = 0; i < indices.size(); i += 3) {
+                    const uint32_t a = remap[indices[i]];
+                    const uint32_t b = remap[indices[i + 1]];
+                    const uint32_t c = remap[indices[i + 2]];
+
+                    if (a != b && b != c && a != c) {
+                        indices[writeIndex++] = a;
+                        indices[writeIndex++] = b;
+                        indices[writeIndex++] = c;
+                    }
+                }
+
+                indices.resize(writeIndex);
+            }
+
+            if (pError) {
+                *pError = static_cast<float>(std::sqrt(reachedCost));
+            }
+
+            return indices;
+        }
+    }
+
+    std::vector<uint32_t> MeshSimplifier::Simplify(const VertexAttributeStream& positions, const std::span<const VertexAttributeStream> attributes,
+                                                   const size_t vertexCount, const std::span<const uint32_t> indices, const size_t targetIndexCount,
+                                                   const MeshSimplifierSettings& settings, float* pError) {
+        const std::vector<Point> points = BuildPoints(positions, attributes, vertexCount, settings.AttributeWeight);
+
+        return SimplifyPoints(points, indices, targetIndexCount, settings.MaxError, pError);
+    }
+
+    MeshLodChain MeshSimplifier::BuildLodChain(const VertexAttributeStream& positions, const std::span<const VertexAttributeStream> attributes,
+                                               const size_t vertexCount, const std::span<const uint32_t> indices, const MeshSimplifierSettings& settings) {
+        // LOD 0 is the source, checked even when it is too small to simplify further.
+        ValidateTriangles(indices, vertexCount);
+
+        const std::vector<Point> points = BuildPoints(positions, attributes, vertexCount, settings.AttributeWeight);
+
+        MeshLodChain chain;
+        chain.Indices.assign(indices.begin(), indices.end());
+        chain.Lods.push_back({0, static_cast<uint32_t>(indices.size()), 0.0f});
+
+        size_t previousIndexCount = indices.size();
+        while (chain.Lods.size() < settings.MaxLodCount) {
+            const size_t targetIndexCount = static_cast<size_t>(static_cast<float>(previousIndexCount / 3) * settings.LodReduction) * 3;
+            if (targetIndexCount < static_cast<size_t>(settings.MinTriangleCount) * 3) {
+                break;
+            }
+
+            float error;
+            const std::vector<uint32_t> lodIndices = SimplifyPoints(points, indices, targetIndexCount, settings.MaxError, &error);
+
+            // The error limit was hit, further LODs wouldn't get any simpler.
+            if (lodIndices.size() > previousIndexCount - previousIndexCount / 10) {
+                break;
+            }
+
+            chain.Lods.push_back({static_cast<uint32_t>(chain.Indices.size()), static_cast<uint32_t>(lodIndices.size()),
+                                  std::max(error, chain.Lods.back().Error)});
+            chain.Indices.insert(chain.Indices.end(), lodIndices.begin(), lodIndices.end());
+            previousIndexCount = lodIndices.size();
+        }
+
+        return chain;
+    }
+}
@@ -0,0 +1,438 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/Assets/MeshletBuilder.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
+namespace D3D12Engine {
+    namespace {
+        using Float3 = std::array<float, 3>;
+
+        constexpr uint32_t InvalidTriangle = ~0u;
+        constexpr uint16_t NoLocalIndex = 0xffff;
+
+        Float3 Sub(const Float3& a, const Float3& b) {
+            return {a[0] - b[0], a[1] - b[1], a[2] - b[2]};
+        }
+
+        float Dot(const Float3& a, const Float3& b) {
+            return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+        }
+
+        Float3 Cross(const Float3& a, const Float3& b) {
+            return {a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2], a[0] * b[1] - a[1] * b[0]};
+        }
+
+        float Length(const Float3& a) {
+            return std::sqrt(Dot(a, a));
+        }
+
+        Float3 Normalize(const Float3& a) {
+            const float length = Length(a);
+            return length > 0.0f ? Float3{a[0] / length, a[1] / length, a[2] / length} : Float3{0.0f, 0.0f, 0.0f};
+        }
+
+        // Nearest neighbour queries over triangle centroids, skipping triangles already
+        // emitted. Emitted triangles stay in the tree, queries just step over them.
+        class CentroidTree {
+        public:
+            CentroidTree(const std::vector<Float3>& centroids, const std::vector<uint8_t>& emitted)
+                : m_Centroids(centroids), m_Emitted(emitted), m_Items(centroids.size()) {
+                std::iota(m_Items.begin(), m_Items.end(), 0u);
+                m_Nodes.reserve(centroids.size() / LeafSize * 2 + 1);
+                Build(0, static_cast<uint32_t>(m_Items.size()));
+            }
+
+            uint32_t FindNearest(const Float3& point) const {
+                uint32_t best = InvalidTriangle;
+                float bestDistance = std::numeric_limits<float>::max();
+                FindNearest(0, point, best, bestDistance);
+
+                return best;
+            }
+
+        private:
+            static constexpr uint32_t LeafSize = 8;
+            static constexpr uint32_t LeafAxis = 3;
+
+            struct Node {
+                float Split;
+                uint32_t Axis;
+                // Leaves: range of m_Items. Inner nodes: the left child follows the node, First is the right child.
+                uint32_t First;
+                uint32_t Count;
+            };
+
+            uint32_t Build(const uint32_t first, const uint32_t count) {
+                const auto nodeIndex = static_cast<uint32_t>(m_Nodes.size());
+                m_Nodes.push_back({0.0f, LeafAxis, first, count});
+
+                if (count <= LeafSize) {
+                    return nodeIndex;
+                }
+
+                // Split the widest axis at the median.
+                Float3 min = m_Centroids[m_Items[first]];
+                Float3 max = min;
+                for (uint32_t i = first; i < first + count; ++i) {
+                    for (uint32_t axis = 0; axis < 3; ++axis) {
+                        min[axis] = std::min(min[axis], m_Centroids[m_Items[i]][axis]);
+                        max[axis] = std::max(max[axis], m_Centroids[m_Items[i]][axis]);
+                    }
+                }
+
+                const Float3 extent = Sub(max, min);
+                const uint32_t axis = extent[0] >= extent[1] && extent[0] >= extent[2] ? 0 : extent[1] >= extent[2] ? 1 : 2;
+                const uint32_t half = count / 2;
+                const auto begin = m_Items.begin() + first;
+                std::nth_element(begin, begin + half, begin + count, [&](const uint32_t a, const uint32_t b) {
+                    return m_Centroids[a][axis] < m_Centroids[b][axis];
+                });
+
+                const float split = m_Centroids[m_Items[first + half]][axis];
+                Build(first, half);
+                const uint32_t right = Build(first + half, count - half);
+                m_Nodes[nodeIndex] = {split, axis, right, count};
+
+                return nodeIndex;
+            }
+
+            void FindNearest(const uint32_t nodeIndex, const Float3& point, uint32_t& best, float& bestDistance) const {
+                const Node& node = m_Nodes[nodeIndex];
+
+                if (node.Axis == LeafAxis) {
+                    for (uint32_t i = node.First; i < node.First + node.Count; ++i) {
+                        const uint32_t triangle = m_Items[i];
+                        if (m_Emitted[triangle]) {
+                            continue;
+                        }
+
+                        const Float3 delta = Sub(m_Centroids[triangle], point);
+                        if (const float distance = Dot(delta, delta); distance < bestDistance) {
+                            best = triangle;
+                            bestDistance = distance;
+                        }
+                    }
+
+                    return;
+                }
+
+                const float delta = point[node.Axis] - node.Split;
+                const uint32_t nearChild = delta < 0.0f ? nodeIndex + 1 : node.First;
+                const uint32_t farChild = delta < 0.0f ? node.First : nodeIndex + 1;
+
+                FindNearest(nearChild, point, best, bestDistance);
+                if (delta * delta < bestDistance) {
+                    FindNearest(farChild, point, best, bestDistance);
+                }
+            }
+
+            const std::vector<Float3>& m_Centroids;
+            const std::vector<uint8_t>& m_Emitted;
+            std::vector<uint32_t> m_Items;
+            std::vector<Node> m_Nodes;
+        };
+
+        // Bounding sphere from Ritter's algorithm: start from the most distant pair of
+        // axis extremes, then grow to enclose every point.
+        void ComputeSphere(const std::vector<Float3>& points, MeshletBounds& bounds) {
+            std::array<size_t, 3> minIndex{};
+            std::array<size_t, 3> maxIndex{};
+            for (size_t i = 1; i < points.size(); ++i) {
+                for (uint32_t axis = 0; axis < 3; ++axis) {
+                    if (points[i][axis] < points[minIndex[axis]][axis]) {
+                        minIndex[axis] = i;
+                    }
+
+                    if (points[i][axis] > points[maxIndex[axis]][axis]) {
+                        maxIndex[axis] = i;
+                    }
+                }
+            }
+
+            uint32_t widest = 0;
+            float widestDistance = -1.0f;
+            for (uint32_t axis = 0; axis < 3; ++axis) {
+                const Float3 delta = Sub(points[maxIndex[axis]], points[minIndex[axis]]);
+                if (const float distance = Dot(delta, delta); distance > widestDistance) {
+                    widest = axis;
+                    widestDistance = distance;
+                }
+            }
+
+            const Float3& a = points[minIndex[widest]];
+            const Float3& b = points[maxIndex[widest]];
+            Float3 center = {(a[0] + b[0]) * 0.5f, (a[1] + b[1]) * 0.5f, (a[2] + b[2]) * 0.5f};
+            float radius = std::sqrt(widestDistance) * 0.5f;
+
+            for (const Float3& point : points) {
+                const Float3 delta = Sub(point, center);
+                const float distance = Length(delta);
+                if (distance > radius) {
+                    const float k = (distance - radius) * 0.5f / distance;
+                    radius = (radius + distance) * 0.5f;
+                    center = {center[0] + delta[0] * k, center[1] + delta[1] * k, center[2] + delta[2] * k};
+                }
+            }
+
+            bounds.Center = center;
+            bounds.Radius = radius;
+        }
+
+        void ComputeCone(const std::vector<Float3>& points, std::span<const uint8_t> triangles, MeshletBounds& bounds) {
+            std::vector<Float3> normals;
+            normals.reserve(triangles.size() / 3);
+
+            Float3 normalSum = {0.0f, 0.0f, 0.0f};
+            for (size_t i = 0; i < triangles.size(); i += 3) {
+                const Float3& p0 = points[triangles[i]];
+                const Float3 normal = Normalize(Cross(Sub(points[triangles[i + 1]], p0), Sub(points[triangles[i + 2]], p0)));
+                normals.push_back(normal);
+                normalSum = {normalSum[0] + normal[0], normalSum[1] + normal[1], normalSum[2] + normal[2]};
+            }
+
+            const Float3 axis = Normalize(normalSum);
+            float minDot = 1.0f;
+            for (const Float3& normal : normals) {
+                // Degenerate triangles can't be seen from any side, they don't constrain the cone.
+                if (Dot(normal, normal) > 0.0f) {
+                    minDot = std::min(minDot, Dot(normal, axis));
+                }
+            }
+
+            // Past a small margin the cone is too wide to ever cull anything.
+            if (Dot(axis, axis) == 0.0f || minDot <= 0.1f) {
+                bounds.ConeApex = bounds.Center;
+                bounds.ConeAxis = {0.0f, 0.0f, 0.0f};
+                bounds.ConeCutoff = 1.0f;
+                return;
+            }
+
+            // Move the apex back along the axis until it is behind every triangle plane.
+            float maxT = 0.0f;
+            for (size_t i = 0; i < normals.size(); ++i) {
+                const Float3& normal = normals[i];
+                const float alignment = Dot(axis, normal);
+                if (alignment > 0.0f) {
+                    const float t = Dot(Sub(bounds.Center, points[triangles[i * 3]]), normal) / alignment;
+                    maxT = std::max(maxT, t);
+                }
+            }
+
+            bounds.ConeApex = {bounds.Center[0] - axis[0] * maxT, bounds.Center[1] - axis[1] * maxT, bounds.Center[2] - axis[2] * maxT};
+            bounds.ConeAxis = axis;
+            bounds.ConeCutoff = std::sqrt(1.0f - minDot * minDot);
+        }
+    }
+
+    MeshletMesh MeshletBuilder::Build(const VertexAttributeStream& positions, const size_t vertexCount,
+                                      const std::span<const uint32_t> indices, const MeshletBuilderSettings& settings) {
+        if (settings.MaxVertices < 3 || settings.MaxVertices > 256 || settings.MaxTriangles == 0) {
+            throw std::invalid_argument("Meshlets need between 3 and 256 vertices and at least one triangle.");
+        }
+
+        if (positions.ComponentCount < 3 || indices.size() % 3 != 0) {
+            throw std::invalid_argument("Meshlets are built from 3D positions and triangle lists.");
+        }
+
+        const size_t triangleCount = indices.size() / 3;
+        const auto getPosition = [&](const uint32_t vertex) -> Float3 {
+            const float* pPosition = positions.Data + vertex * positions.Stride;
+            return {pPosition[0], pPosition[1], pPosition[2]};
+        };
+
+        // Triangles using each vertex, and how many of them are still to be emitted.
+        std::vector<uint32_t> adjacencyOffsets(vertexCount + 1, 0);
+        for (const uint32_t index : indices) {
+            if (index >= vertexCount) {
+                throw std::invalid_argument("Index out of range.");
+            }
+
+            adjacencyOffsets[index + 1]++;
+        }
+
+        std::partial_sum(adjacencyOffsets.begin(), adjacencyOffsets.end(), adjacencyOffsets.begin());
+        std::vector<uint32_t> liveTriangles(vertexCount);
+        for (size_t vertex = 0; vertex < vertexCount; ++vertex) {
+            liveTriangles[vertex] = adjacencyOffsets[vertex + 1] - adjacencyOffsets[vertex];
+        }
+
+        std::vector<uint32_t> adjacency(indices.size());
+        {
+            std::vector<uint32_t> fill(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+            for (size_t i = 0; i < indices.size(); ++i) {
+                adjacency[fill[indices[i]]++] = static_cast<uint32_t>(i / 3);
+            }
+        }
+
+        std::vector<Float3> centroids(triangleCount);
+        std::vector<Float3> normals(triangleCount);
+        float totalArea = 0.0f;
+        for (size_t triangle = 0; triangle < triangleCount; ++triangle) {
+            const Float3 p0 = getPosition(indices[triangle * 3]);
+            const Float3 p1 = getPosition(indices[triangle * 3 + 1]);
+            const Float3 p2 = getPosition(indices[triangle * 3 + 2]);
+            const Float3 normal = Cross(Sub(p1, p0), Sub(p2, p0));
+
+            centroids[triangle] = {(p0[0] + p1[0] + p2[0]) / 3.0f, (p0[1] + p1[1] + p2[1]) / 3.0f, (p0[2] + p1[2] + p2[2]) / 3.0f};
+            normals[triangle] = Normalize(normal);
+            totalArea += Length(normal) * 0.5f;
+        }
+
+        // Radius of a disc holding a full meshlet of average triangles, used to make the
+        // distance term of the score independent of the mesh scale.
+        const float averageArea = triangleCount > 0 ? totalArea / static_cast<float>(triangleCount) : 0.0f;
+        const float expectedRadius = std::max(std::sqrt(averageArea * static_cast<float>(settings.MaxTriangles) / 3.14159265f), 1e-6f);
+
+        std::vector<uint8_t> emitted(triangleCount, 0);
+        const CentroidTree tree(centroids, emitted);
+
+        MeshletMesh mesh;
+        mesh.Meshlets.reserve(triangleCount / settings.MaxTriangles + 1);
+        mesh.VertexIndices.reserve(indices.size() / 2);
+        mesh.PrimitiveIndices.reserve(indices.size());
+
+        std::vector<uint16_t> localIndices(vertexCount, NoLocalIndex);
+        std::vector<Float3> meshletPoints;
+        Meshlet current{0, 0, 0, 0};
+        Float3 centroidSum = {0.0f, 0.0f, 0.0f};
+        Float3 normalSum = {0.0f, 0.0f, 0.0f};
+
+        const auto flush = [&]() {
+            if (current.TriangleCount == 0) {
+                return;
+            }
+
+            meshletPoints.clear();
+            for (uint32_t i = 0; i < current.VertexCount; ++i) {
+                const uint32_t vertex = mesh.VertexIndices[current.VertexOffset + i];
+                meshletPoints.push_back(getPosition(vertex));
+                localIndices[vertex] = NoLocalIndex;
+            }
+
+            MeshletBounds bounds;
+            ComputeSphere(meshletPoints, bounds);
+            ComputeCone(meshletPoints, std::span(mesh.PrimitiveIndices).subspan(current.TriangleOffset, current.TriangleCount * 3), bounds);
+
+            mesh.Meshlets.push_back(current);
+            mesh.Bounds.push_back(bounds);
+
+            current = {static_cast<uint32_t>(mesh.VertexIndices.size()), static_cast<uint32_t>(mesh.PrimitiveIndices.size()), 0, 0};
+            centroidSum = {0.0f, 0.0f, 0.0f};
+            normalSum = {0.0f, 0.0f, 0.0f};
+        };
+
+        const auto countNewVertices = [&](const uint32_t triangle) {
+            uint32_t count = 0;
+            for (uint32_t corner = 0; corner < 3; ++corner) {
+                count += localIndices[indices[triangle * 3 + corner]] == NoLocalIndex ? 1 : 0;
+            }
+
+            return count;
+        };
+
+        const auto findAdjacent = [&]() {
+            const float inverseCount = 1.0f / static_cast<float>(current.TriangleCount);
+            const Float3 center = {centroidSum[0] * inverseCount, centroidSum[1] * inverseCount, centroidSum[2] * inverseCount};
+            const Float3 axis = Normalize(normalSum);
+
+            uint32_t best = InvalidTriangle;
+            uint32_t bestExtra = ~0u;
+            float bestScore = std::numeric_limits<float>::max();
+
+            for (uint32_t i = 0; i < current.VertexCount; ++i) {
+                const uint32_t vertex = mesh.VertexIndices[current.VertexOffset + i];
+                if (liveTriangles[vertex] == 0) {
+                    continue;
+                }
+
+                for (uint32_t j = adjacencyOffsets[vertex]; j < adjacencyOffsets[vertex + 1]; ++j) {
+                    const uint32_t triangle = adjacency[j];
+                    if (emitted[triangle]) {
+                        continue;
+                    }
+
+                    uint32_t extra = countNewVertices(triangle);
+                    if (current.VertexCount + extra > settings.MaxVertices) {
+                        continue;
+                    }
+
+                    // Triangles that finish off a vertex go first, leaving it would fragment the mesh.
+                    for (uint32_t corner = 0; corner < 3; ++corner) {
+                        if (liveTriangles[indices[triangle * 3 + corner]] == 1) {
+                            extra = 0;
+                            break;
+                        }
+                    }
+
+                    const Float3 delta = Sub(centroids[triangle], center);
+                    const float cone = std::max(1.0f - Dot(normals[triangle], axis) * settings.ConeWeight, 1e-3f);
+                    const float score = (1.0f + Length(delta) / expectedRadius * (1.0f - settings.ConeWeight)) * cone;
+
+                    if (extra < bestExtra || (extra == bestExtra && score < bestScore)) {
+                        best = triangle;
+                        bestExtra = extra;
+                        bestScore = score;
+                    }
+                }
+            }
+
+            return best;
+        };
+
+        Float3 lastCenter = triangleCount > 0 ? centroids[0] : Float3{0.0f, 0.0f, 0.0f};
+        for (size_t emittedCount = 0; emittedCount < triangleCount; ++emittedCount) {
+            uint32_t triangle = current.TriangleCount > 0 ? findAdjacent() : InvalidTriangle;
+
+            if (triangle == InvalidTriangle) {
+                // Nothing connected fits, continue with whatever is closest.
+                if (current.TriangleCount > 0) {
+                    const float inverseCount = 1.0f / static_cast<float>(current.TriangleCount);
+                    lastCenter = {centroidSum[0] * inverseCount, centroidSum[1] * inverseCount, centroidSum[2] * inverseCount};
+                }
+
+                triangle = tree.FindNearest(lastCenter);
+            }
+
+            if (current.TriangleCount == settings.MaxTriangles || current.VertexCount + countNewVertices(triangle) > settings.MaxVertices) {
+                flush();
+            }
+
+            for (uint32_t corner = 0; corner < 3; ++corner) {
+                const uint32_t vertex = indices[triangle * 3 + corner];
+                if (localIndices[vertex] == NoLocalIndex) {
+                    localIndices[vertex] = static_cast<uint16_t>(current.VertexCount++);
+                    mesh.VertexIndices.push_back(vertex);
+                }
+
+                mesh.PrimitiveIndices.push_back(static_cast<uint8_t>(localIndices[vertex]));
+                liveTriangles[vertex]--;
+            }
+
+            const Float3& centroid = centroids[triangle];
+            const Float3& normal = normals[triangle];
+            centroidSum = {centroidSum[0] + centroid[0], centroidSum[1] + centroid[1], centroidSum[2] + centroid[2]};
+            normalSum = {normalSum[0] + normal[0], normalSum[1] + normal[1], normalSum[2] + normal[2]};
+            current.TriangleCount++;
+            emitted[triangle] = 1;
+        }
+
+        flush();
+
+        return mesh;
+    }
+
+    void MeshletBuilder::AppendIndices(const MeshletMesh& mesh, const Meshlet& meshlet, std::vector<uint32_t>& indices) {
+        const uint8_t* pTriangles = mesh.PrimitiveIndices.data() + meshlet.TriangleOffset;
+        const uint32_t* pVertices = mesh.VertexIndices.data() + meshlet.VertexOffset;
+
+        for (uint32_t i = 0; i < meshlet.TriangleCount * 3; ++i) {
+            indices.push_back(pVertices[pTriangles[i]]);
+        }
+    }
+}
@@ -0,0 +1,185 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/Assets/MipChainGenerator.hpp>
+
+#include <D3D12Engine/Core/JobSystem.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <stdexcept>
+
+namespace D3D12Engine {
+    namespace {
+        // RGBA in linear space, colors premultiplied by alpha. Normal maps keep their vector
+        // in RGB and aren't premultiplied.
+        struct LinearImage {
+            uint32_t Width;
+            uint32_t Height;
+            std::vector<std::array<float, 4>> Texels;
+        };
+
+        float SrgbToLinear(const float value) {
+            return value <= 0.04045f ? value / 12.92f : std::pow((value + 0.055f) / 1.055f, 2.4f);
+        }
+
+        float LinearToSrgb(const float value) {
+            return value <= 0.0031308f ? value * 12.92f : 1.055f * std::pow(value, 1.0f / 2.4f) - 0.055f;
+        }
+
+        uint8_t ToUnorm8(const float value) {
+            return static_cast<uint8_t>(std::clamp(value, 0.0f, 1.0f) * 255.0f + 0.5f);
+        }
+
+        template <typename F>
+        void ForEachRow(JobSystem* pJobSystem, const uint32_t rowCount, F&& function) {
+            if (pJobSystem == nullptr) {
+                function(0u, rowCount);
+                return;
+            }
+
+            pJobSystem->ParallelFor(rowCount, 16, function);
+        }
+
+        LinearImage ToLinear(const TextureImage& image, const MipChainSettings& settings, JobSystem* pJobSystem) {
+            std::array<float, 256> decode;
+            for (uint32_t i = 0; i < 256; ++i) {
+                const float value = static_cast<float>(i) / 255.0f;
+                decode[i] = settings.Srgb && !settings.NormalMap ? SrgbToLinear(value) : value;
+            }
+
+            LinearImage linear{image.Width, image.Height, {}};
+            linear.Texels.resize(static_cast<size_t>(image.Width) * image.Height);
+
+            ForEachRow(pJobSystem, image.Height, [&](const uint32_t begin, const uint32_t end) {
+                for (size_t i = static_cast<size_t>(begin) * image.Width; i < static_cast<size_t>(end) * image.Width; ++i) {
+                    const uint8_t* pPixel = &image.Pixels[i * 4];
+                    std::array<float, 4>& texel = linear.Texels[i];
+
+                    if (settings.NormalMap) {
+                        for (size_t c = 0; c < 3; ++c) {
+                            texel[c] = decode[pPixel[c]] * 2.0f - 1.0f;
+                        }
+                        texel[3] = decode[pPixel[3]];
+                    } else {
+                        const float alpha = static_cast<float>(pPixel[3]) / 255.0f;
+                        for (size_t c = 0; c < 3; ++c) {
+                            texel[c] = decode[pPixel[c]] * alpha;
+                        }
+                        texel[3] = alpha;
+                    }
+                }
+            });
+
+            return linear;
+        }
+
+        TextureImage FromLinear(const LinearImage& linear, const MipChainSettings& settings, JobSystem* pJobSystem) {
+            TextureImage image{linear.Width, linear.Height, {}};
+            image.Pixels.resize(linear.Texels.size() * 4);
+
+            ForEachRow(pJobSystem, linear.Height, [&](const uint32_t begin, const uint32_t end) {
+                for (size_t i = static_cast<size_t>(begin) * linear.Width; i < static_cast<size_t>(end) * linear.Width; ++i) {
+                    std::array<float, 4> texel = linear.Texels[i];
+                    uint8_t* pPixel = &image.Pixels[i * 4];
+
+                    if (settings.NormalMap) {
+                        const float length = std::sqrt(texel[0] * texel[0] + texel[1] * texel[1] + texel[2] * texel[2]);
+                        const float scale = length > 0.0f ? 1.0f / length : 0.0f;
+                        for (size_t c = 0; c < 3; ++c) {
+                            pPixel[c] = ToUnorm8(texel[c] * scale * 0.5f + 0.5f);
+                        }
+                    } else {
+                        const float alpha = texel[3];
+                        for (size_t c = 0; c < 3; ++c) {
+                            const float color = alpha > 0.0f ? texel[c] / alpha : 0.0f;
+                            pPixel[c] = ToUnorm8(settings.Srgb ? LinearToSrgb(std::clamp(color, 0.0f, 1.0f)) : color);
+                        }
+                    }
+                    pPixel[3] = ToUnorm8(texel[3]);
+                }
+            });
+
+            return image;
+        }
+
+        // Source texels a destination texel is filtered from along one axis. Even sizes use
+        // a box filter, odd sizes a [1, 2, 1] tent centered on the odd texel so the last one
+        // isn't dropped, and a 1 texel wide axis is reused as is.
+        struct AxisTaps {
+            uint32_t Indices[3];
+            float Weights[3];
+            uint32_t Count;
+        };
+
+        AxisTaps GetAxisTaps(const uint32_t destination, const uint32_t sourceSize) {
+            if (sourceSize == 1) {
+                return {{0, 0, 0}, {1.0f, 0.0f, 0.0f}, 1};
+            }
+
+            if (sourceSize % 2 != 0) {
+                return {{destination * 2, destination * 2 + 1, destination * 2 + 2}, {0.25f, 0.5f, 0.25f}, 3};
+            }
+
+            return {{destination * 2, destination * 2 + 1, 0}, {0.5f, 0.5f, 0.0f}, 2};
+        }
+
+        LinearImage Downsample(const LinearImage& source, JobSystem* pJobSystem) {
+            LinearImage destination{std::max(source.Width / 2, 1u), std::max(source.Height / 2, 1u), {}};
+            destination.Texels.resize(static_cast<size_t>(destination.Width) * destination.Height);
+
+            ForEachRow(pJobSystem, destination.Height, [&](const uint32_t begin, const uint32_t end) {
+                for (uint32_t y = begin; y < end; ++y) {
+                    const AxisTaps rows = GetAxisTaps(y, source.Height);
+
+                    for (uint32_t x = 0; x < destination.Width; ++x) {
+                        const AxisTaps columns = GetAxisTaps(x, source.Width);
+
+                        std::array<float, 4> texel = {};
+                        for (uint32_t row = 0; row < rows.Count; ++row) {
+                            for (uint32_t column = 0; column < columns.Count; ++column) {
+                                const auto& sample = source.Texels[static_cast<size_t>(rows.Indices[row]) * source.Width + columns.Indices[column]];
+                                const float weight = rows.Weights[row] * columns.Weights[column];
+                                for (size_t channel = 0; channel < 4; ++channel) {
+                                    texel[channel] += sample[channel] * weight;
+                                }
+                            }
+                        }
+
+                        destination.Texels[static_cast<size_t>(y) * destination.Width + x] = texel;
+                    }
+                }
+            });
+
+            return destination;
+        }
+    }
+
+    std::vector<TextureImage> MipChainGenerator::Generate(const TextureImage& image, const MipChainSettings& settings, JobSystem* pJobSystem) {
+        if (image.Width == 0 || image.Height == 0 || image.Pixels.size() != static_cast<size_t>(image.Width) * image.Height * 4) {
+            throw std::invalid_argument("Mips need a non empty RGBA8 image.");
+        }
+
+        const uint32_t fullMipCount = GetFullMipCount(image.Width, image.Height);
+        const uint32_t mipCount = settings.MaxMipCount == 0 ? fullMipCount : std::min(settings.MaxMipCount, fullMipCount);
+
+        std::vector<TextureImage> mips;
+        mips.reserve(mipCount);
+        mips.push_back(image);
+
+        LinearImage level = ToLinear(image, settings, pJobSystem);
+        for (uint32_t mip = 1; mip < mipCount; ++mip) {
+            level = Downsample(level, pJobSystem);
+            mips.push_back(FromLinear(level, settings, pJobSystem));
+        }
+
+        return mips;
+    }
+
+    uint32_t MipChainGenerator::GetFullMipCount(const uint32_t width, const uint32_t height) {
+        return static_cast<uint32_t>(std::bit_width(std::max(width, height)));
+    }
+}
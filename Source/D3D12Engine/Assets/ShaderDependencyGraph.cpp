@@ -0,0 +1,159 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/Assets/ShaderDependencyGraph.hpp>
+
+#include <algorithm>
+
+namespace D3D12Engine {
+    std::vector<std::string> ShaderDependencyGraph::FindIncludes(const std::string_view source) {
+        constexpr std::string_view directive = "include";
+
+        std::vector<std::string> includes;
+        bool lineStart = true;
+        size_t i = 0;
+
+        while (i < source.size()) {
+            const char c = source[i];
+
+            // Comments can hide directives and span lines.
+            if (c == '/' && i + 1 < source.size() && source[i + 1] == '/') {
+                i = source.find('\n', i);
+                continue;
+            }
+
+            if (c == '/' && i + 1 < source.size() && source[i + 1] == '*') {
+                const size_t end = source.find("*/", i + 2);
+                i = end == std::string_view::npos ? source.size() : end + 2;
+                continue;
+            }
+
+            if (c == '\n') {
+                lineStart = true;
+                i++;
+                continue;
+            }
+
+            if (c == ' ' || c == '\t' || c == '\r') {
+                i++;
+                continue;
+            }
+
+            if (c != '#' || !lineStart) {
+                lineStart = false;
+                i++;
+                continue;
+            }
+
+            lineStart = false;
+            i++;
+            while (i < source.size() && (source[i] == ' ' || source[i] == '\t')) {
+                i++;
+            }
+
+            if (source.substr(i, directive.size()) != directive) {
+                continue;
+            }
+
+            i += directive.size();
+            while (i < source.size() && (source[i] == ' ' || source[i] == '\t')) {
+                i++;
+            }
+
+            if (i >= source.size() || (source[i] != '"' && source[i] != '<')) {
+                continue;
+            }
+
+            // The name ends on the same line, with a quote or a chevron matching the opening one.
+            const std::string_view terminators = source[i] == '"' ? "\"\n" : ">\n";
+            const size_t end = source.find_first_of(terminators, i + 1);
+            if (end != std::string_view::npos && source[end] != '\n') {
+                includes.emplace_back(source.substr(i + 1, end - i - 1));
+                i = end + 1;
+            }
+        }
+
+        return includes;
+    }
+
+    std::filesystem::path ShaderDependencyGraph::ResolveInclude(const std::filesystem::path& includingFile, const std::string_view name) {
+        return Normalize(includingFile.parent_path() / std::filesystem::path(name));
+    }
+
+    void ShaderDependencyGraph::AddProgram(const std::filesystem::path& program) {
+        m_Nodes[GetOrAddNode(program)].IsProgram = true;
+    }
+
+    void ShaderDependencyGraph::SetIncludes(const std::filesystem::path& file, const std::span<const std::filesystem::path> includes) {
+        const uint32_t index = GetOrAddNode(file);
+
+        for (const uint32_t include : m_Nodes[index].Includes) {
+            std::erase(m_Nodes[include].IncludedBy, index);
+        }
+        m_Nodes[index].Includes.clear();
+
+        for (const auto& include : includes) {
+            const uint32_t includeIndex = GetOrAddNode(include);
+            // Indices, the node vector may have grown.
+            auto& edges = m_Nodes[index].Includes;
+            if (std::ranges::find(edges, includeIndex) == edges.end()) {
+                edges.push_back(includeIndex);
+                m_Nodes[includeIndex].IncludedBy.push_back(index);
+            }
+        }
+    }
+
+    std::vector<std::filesystem::path> ShaderDependencyGraph::GetAffectedPrograms(const std::span<const std::filesystem::path> changedFiles) const {
+        std::vector<bool> visited(m_Nodes.size(), false);
+        std::vector<uint32_t> stack;
+
+        for (const auto& file : changedFiles) {
+            if (const uint32_t index = Find(file); index != NotFound && !visited[index]) {
+                visited[index] = true;
+                stack.push_back(index);
+            }
+        }
+
+        // Walk up to every file including a changed one.
+        while (!stack.empty()) {
+            const uint32_t index = stack.back();
+            stack.pop_back();
+
+            for (const uint32_t parent : m_Nodes[index].IncludedBy) {
+                if (!visited[parent]) {
+                    visited[parent] = true;
+                    stack.push_back(parent);
+                }
+            }
+        }
+
+        std::vector<std::filesystem::path> programs;
+        for (uint32_t i = 0; i < m_Nodes.size(); ++i) {
+            if (visited[i] && m_Nodes[i].IsProgram) {
+                programs.push_back(m_Nodes[i].Path);
+            }
+        }
+
+        return programs;
+    }
+
+    std::filesystem::path ShaderDependencyGraph::Normalize(const std::filesystem::path& path) {
+        return path.lexically_normal().make_preferred();
+    }
+
+    uint32_t ShaderDependencyGraph::Find(const std::filesystem::path& path) const {
+        const auto it = m_Indices.find(Normalize(path).native());
+        return it != m_Indices.end() ? it->second : NotFound;
+    }
+
+    uint32_t ShaderDependencyGraph::GetOrAddNode(const std::filesystem::path& path) {
+        std::filesystem::path normalized = Normalize(path);
+        const auto [it, inserted] = m_Indices.try_emplace(normalized.native(), static_cast<uint32_t>(m_Nodes.size()));
+        if (inserted) {
+            m_Nodes.push_back({std::move(normalized)});
+        }
+
+        return it->second;
+    }
+}
@@ -0,0 +1,67 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/Assets/ShaderHotReloader.hpp>
+
+#include <fstream>
+#include <iterator>
+#include <limits>
+
+namespace D3D12Engine {
+    ShaderHotReloader::ShaderHotReloader(const ShaderHotReloaderSettings& settings)
+        : m_Settings(settings), m_LastPollTime(-std::numeric_limits<double>::infinity()) {
+    }
+
+    void ShaderHotReloader::AddProgram(const std::filesystem::path& program) {
+        const std::filesystem::path path = ShaderDependencyGraph::Normalize(program);
+        m_Dependencies.AddProgram(path);
+
+        if (!m_Watcher.IsWatching(path)) {
+            m_Watcher.Watch(path);
+            ScanIncludes(path);
+        }
+    }
+
+    std::span<const std::filesystem::path> ShaderHotReloader::Poll(const double time) {
+        m_ChangedPrograms.clear();
+        if (time - m_LastPollTime < m_Settings.PollIntervalSeconds) {
+            return {};
+        }
+        m_LastPollTime = time;
+
+        m_ChangedFiles.clear();
+        m_Watcher.Poll(m_ChangedFiles);
+        if (m_ChangedFiles.empty()) {
+            return {};
+        }
+
+        // A changed file may include different files now.
+        for (const auto& file : m_ChangedFiles) {
+            ScanIncludes(file);
+        }
+
+        m_ChangedPrograms = m_Dependencies.GetAffectedPrograms(m_ChangedFiles);
+
+        return m_ChangedPrograms;
+    }
+
+    void ShaderHotReloader::ScanIncludes(const std::filesystem::path& file) {
+        // A file that can't be read includes nothing until it comes back.
+        std::ifstream stream(file, std::ios::binary);
+        const std::string source{std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>()};
+
+        std::vector<std::filesystem::path> includes;
+        for (const auto& name : ShaderDependencyGraph::FindIncludes(source)) {
+            includes.push_back(ShaderDependencyGraph::ResolveInclude(file, name));
+        }
+        m_Dependencies.SetIncludes(file, includes);
+
+        for (const auto& include : includes) {
+            if (!m_Watcher.IsWatching(include)) {
+                m_Watcher.Watch(include);
+                ScanIncludes(include);
+            }
+        }
+    }
+}
@@ -0,0 +1,112 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/Assets/ShaderPermutation.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+
+namespace D3D12Engine {
+    ShaderPermutationSpace::ShaderPermutationSpace(std::vector<ShaderFeature> features)
+        : m_Features(std::move(features)) {
+        if (m_Features.size() > MaxFeatureCount) {
+            throw std::invalid_argument("A shader program can't have more than 32 features.");
+        }
+
+        const uint32_t featureCount = GetFeatureCount();
+        m_ValidBits = featureCount == MaxFeatureCount ? ~0u : (1u << featureCount) - 1;
+
+        for (uint32_t i = 0; i < featureCount; ++i) {
+            if (m_Features[i].Requires & ~m_ValidBits) {
+                throw std::invalid_argument("Shader feature " + m_Features[i].Define + " requires a feature that doesn't exist.");
+            }
+
+            for (uint32_t j = 0; j < i; ++j) {
+                if (m_Features[i].Define == m_Features[j].Define) {
+                    throw std::invalid_argument("Shader feature " + m_Features[i].Define + " is declared twice.");
+                }
+            }
+        }
+
+        // Requirements can chain, grow every closure until nothing changes. Cycles are
+        // fine, the features of a cycle always come together.
+        m_Closures.resize(featureCount);
+        for (uint32_t i = 0; i < featureCount; ++i) {
+            m_Closures[i] = (1u << i) | m_Features[i].Requires;
+        }
+
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            for (uint32_t i = 0; i < featureCount; ++i) {
+                uint32_t closure = m_Closures[i];
+                for (uint32_t j = 0; j < featureCount; ++j) {
+                    if (closure & (1u << j)) {
+                        closure |= m_Closures[j];
+                    }
+                }
+
+                if (closure != m_Closures[i]) {
+                    m_Closures[i] = closure;
+                    changed = true;
+                }
+            }
+        }
+    }
+
+    ShaderPermutationKey ShaderPermutationSpace::MakeKey(const std::span<const std::string_view> defines) const {
+        ShaderPermutationKey key;
+        for (const std::string_view define : defines) {
+            const auto it = std::ranges::find(m_Features, define, &ShaderFeature::Define);
+            if (it == m_Features.end()) {
+                throw std::invalid_argument("Unknown shader feature " + std::string(define) + ".");
+            }
+
+            key.Bits |= 1u << static_cast<uint32_t>(it - m_Features.begin());
+        }
+
+        return Normalize(key);
+    }
+
+    ShaderPermutationKey ShaderPermutationSpace::Normalize(const ShaderPermutationKey key) const {
+        if (key.Bits & ~m_ValidBits) {
+            throw std::invalid_argument("Shader permutation key has bits past the program's features.");
+        }
+
+        ShaderPermutationKey normalized;
+        for (uint32_t bits = key.Bits; bits != 0; bits &= bits - 1) {
+            normalized.Bits |= m_Closures[std::countr_zero(bits)];
+        }
+
+        return normalized;
+    }
+
+    std::vector<ShaderDefine> ShaderPermutationSpace::GetDefines(const ShaderPermutationKey key) const {
+        const ShaderPermutationKey normalized = Normalize(key);
+
+        std::vector<ShaderDefine> defines;
+        for (uint32_t i = 0; i < GetFeatureCount(); ++i) {
+            if (normalized.Bits & (1u << i)) {
+                defines.push_back({m_Features[i].Define, "1"});
+            }
+        }
+
+        return defines;
+    }
+
+    std::vector<ShaderPermutationKey> ShaderPermutationSpace::GetReachableKeys(const std::span<const ShaderPermutationKey> referencedKeys) const {
+        std::vector<ShaderPermutationKey> keys;
+        keys.reserve(referencedKeys.size());
+        for (const ShaderPermutationKey key : referencedKeys) {
+            keys.push_back(Normalize(key));
+        }
+
+        std::ranges::sort(keys);
+        const auto duplicates = std::ranges::unique(keys);
+        keys.erase(duplicates.begin(), duplicates.end());
+
+        return keys;
+    }
+}
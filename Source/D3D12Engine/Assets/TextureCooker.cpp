@@ -0,0 +1,83 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/Assets/TextureCooker.hpp>
+
+#include <D3D12Engine/Assets/BlockCompressor.hpp>
+#include <D3D12Engine/Assets/MipChainGenerator.hpp>
+
+#include <cmath>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+
+namespace D3D12Engine {
+    CookedTexture TextureCooker::Cook(const TextureImage& image, const TextureCookSettings& settings, JobSystem* pJobSystem) {
+        if (!BlockCompressor::IsSupported(settings.Format)) {
+            throw std::invalid_argument("Textures can only be cooked to BC1, BC5 or BC7.");
+        }
+
+        MipChainSettings mipSettings;
+        mipSettings.Srgb = IsSrgbFormat(settings.Format);
+        mipSettings.NormalMap = settings.NormalMap;
+        mipSettings.MaxMipCount = settings.GenerateMips ? 0 : 1;
+
+        CookedTexture texture;
+        texture.SourceMips = MipChainGenerator::Generate(image, mipSettings, pJobSystem);
+
+        texture.Layout.Format = settings.Format;
+        texture.Layout.Width = image.Width;
+        texture.Layout.Height = image.Height;
+        DdsFile::BuildMipChain(texture.Layout, static_cast<uint32_t>(texture.SourceMips.size()), DdsFile::MaxHeaderSize);
+
+        const uint64_t dataOffset = texture.Layout.Mips.front().FileOffset;
+        texture.Data.resize(texture.Layout.GetTotalByteSize());
+
+        for (size_t mip = 0; mip < texture.SourceMips.size(); ++mip) {
+            const DdsMipLevel& level = texture.Layout.Mips[mip];
+            BlockCompressor::Compress(texture.SourceMips[mip], settings.Format,
+                                      std::span(texture.Data).subspan(level.FileOffset - dataOffset, level.ByteSize), pJobSystem);
+        }
+
+        return texture;
+    }
+
+    std::vector<std::byte> TextureCooker::WriteDds(const CookedTexture& texture) {
+        DdsLayout layout = texture.Layout;
+        std::vector<std::byte> bytes = DdsFile::WriteHeader(layout);
+        bytes.insert(bytes.end(), texture.Data.begin(), texture.Data.end());
+
+        return bytes;
+    }
+
+    void TextureCooker::WriteDds(const CookedTexture& texture, const std::filesystem::path& path) {
+        const std::vector<std::byte> bytes = WriteDds(texture);
+
+        std::ofstream file(path, std::ios::binary);
+        if (!file || !file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()))) {
+            throw std::runtime_error("Failed to write texture " + path.string() + ".");
+        }
+    }
+
+    double TextureCooker::ComputePsnr(const TextureImage& reference, const TextureImage& image, const uint32_t channelCount) {
+        if (reference.Width != image.Width || reference.Height != image.Height || reference.Pixels.size() != image.Pixels.size()) {
+            throw std::invalid_argument("PSNR needs images of the same size.");
+        }
+
+        double squaredError = 0.0;
+        for (size_t i = 0; i < reference.Pixels.size(); i += 4) {
+            for (uint32_t channel = 0; channel < channelCount; ++channel) {
+                const double difference = static_cast<double>(reference.Pixels[i + channel]) - static_cast<double>(image.Pixels[i + channel]);
+                squaredError += difference * difference;
+            }
+        }
+
+        const double sampleCount = static_cast<double>(reference.Pixels.size() / 4) * channelCount;
+        if (squaredError == 0.0 || sampleCount == 0.0) {
+            return std::numeric_limits<double>::infinity();
+        }
+
+        return 10.0 * std::log10(255.0 * 255.0 * sampleCount / squaredError);
+    }
+}
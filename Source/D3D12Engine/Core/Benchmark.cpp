@@ -0,0 +1,167 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/Core/Benchmark.hpp>
+
+#include <cmath>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+
+namespace D3D12Engine {
+    namespace {
+        uint32_t ParseCount(const std::wstring_view value) {
+            if (value.empty()) {
+                throw std::invalid_argument("Missing benchmark frame count.");
+            }
+
+            uint64_t count = 0;
+            for (const wchar_t c : value) {
+                if (c < L'0' || c > L'9') {
+                    throw std::invalid_argument("Invalid benchmark frame count.");
+                }
+
+                count = count * 10 + static_cast<uint64_t>(c - L'0');
+                if (count > std::numeric_limits<uint32_t>::max()) {
+                    throw std::invalid_argument("Benchmark frame count is too large.");
+                }
+            }
+
+            return static_cast<uint32_t>(count);
+        }
+
+        void WriteString(std::ostream& stream, const std::string_view value) {
+            stream << '"';
+            for (const char c : value) {
+                switch (c) {
+                    case '"': stream << "\\\""; break;
+                    case '\\': stream << "\\\\"; break;
+                    case '\n': stream << "\\n"; break;
+                    case '\r': stream << "\\r"; break;
+                    case '\t': stream << "\\t"; break;
+                    default:
+                        if (static_cast<unsigned char>(c) < 0x20) {
+                            constexpr char digits[] = "0123456789abcdef";
+                            stream << "\\u00" << digits[(c >> 4) & 0xF] << digits[c & 0xF];
+                        } else {
+                            stream << c;
+                        }
+                        break;
+                }
+            }
+            stream << '"';
+        }
+
+        // JSON has no NaN nor infinity, they are written as null.
+        void WriteNumber(std::ostream& stream, const double value) {
+            if (std::isfinite(value)) {
+                stream << value;
+            } else {
+                stream << "null";
+            }
+        }
+
+        void WriteSummary(std::ostream& stream, const std::string_view name, const StatisticSummary& summary) {
+            stream << "  \"" << name << "\": {\"min\": ";
+            WriteNumber(stream, summary.Min);
+            stream << ", \"mean\": ";
+            WriteNumber(stream, summary.Mean);
+            stream << ", \"p50\": ";
+            WriteNumber(stream, summary.P50);
+            stream << ", \"p95\": ";
+            WriteNumber(stream, summary.P95);
+            stream << ", \"p99\": ";
+            WriteNumber(stream, summary.P99);
+            stream << ", \"max\": ";
+            WriteNumber(stream, summary.Max);
+            stream << "},\n";
+        }
+    }
+
+    std::optional<BenchmarkSettings> BenchmarkSettings::Parse(const std::span<const std::wstring_view> arguments) {
+        constexpr std::wstring_view framesOption = L"--benchmark-frames=";
+        constexpr std::wstring_view warmupOption = L"--benchmark-warmup=";
+        constexpr std::wstring_view reportOption = L"--benchmark-report=";
+
+        BenchmarkSettings settings;
+        bool enabled = false;
+
+        for (const std::wstring_view argument : arguments) {
+            if (argument == L"--benchmark") {
+                enabled = true;
+            } else if (argument.starts_with(framesOption)) {
+                settings.FrameCount = ParseCount(argument.substr(framesOption.size()));
+            } else if (argument.starts_with(warmupOption)) {
+                settings.WarmupFrameCount = ParseCount(argument.substr(warmupOption.size()));
+            } else if (argument.starts_with(reportOption)) {
+                settings.ReportPath = argument.substr(reportOption.size());
+            }
+        }
+
+        if (!enabled) {
+            return std::nullopt;
+        }
+
+        if (settings.FrameCount == 0) {
+            throw std::invalid_argument("A benchmark needs at least one frame.");
+        }
+
+        return settings;
+    }
+
+    BenchmarkRun::BenchmarkRun(const BenchmarkSettings& settings)
+        : m_Settings(settings),
+          m_FrameIndex(0),
+          m_FinalMemory(0) {
+        m_Statistics.Reserve(settings.FrameCount);
+    }
+
+    void BenchmarkRun::AddFrame(const FrameSample& sample) {
+        if (IsFinished()) {
+            return;
+        }
+
+        if (m_FrameIndex >= m_Settings.WarmupFrameCount) {
+            m_Statistics.Add(sample);
+            m_FinalMemory = sample.MemoryBytes;
+        }
+
+        ++m_FrameIndex;
+    }
+
+    void BenchmarkRun::WriteReport(std::ostream& stream, const BenchmarkEnvironment& environment) const {
+        stream << "{\n";
+        stream << "  \"build\": ";
+        WriteString(stream, environment.Build);
+        stream << ",\n  \"adapter\": ";
+        WriteString(stream, environment.Adapter);
+        stream << ",\n";
+        stream << "  \"resolution\": {\"width\": " << environment.Width << ", \"height\": " << environment.Height << "},\n";
+        stream << "  \"warmupFrames\": " << m_Settings.WarmupFrameCount << ",\n";
+        stream << "  \"frames\": " << m_Statistics.GetFrameCount() << ",\n";
+        stream << "  \"stepSeconds\": ";
+        WriteNumber(stream, m_Settings.StepSeconds);
+        stream << ",\n";
+
+        WriteSummary(stream, "frameMs", m_Statistics.Summarize(&FrameSample::FrameMs));
+        WriteSummary(stream, "cpuMs", m_Statistics.Summarize(&FrameSample::CpuMs));
+        WriteSummary(stream, "gpuMs", m_Statistics.Summarize(&FrameSample::GpuMs));
+
+        stream << "  \"memoryBytes\": {\"peak\": " << m_Statistics.GetPeakMemory() << ", \"final\": " << m_FinalMemory << "}\n";
+        stream << "}\n";
+    }
+
+    void BenchmarkRun::WriteReport(const std::filesystem::path& path, const BenchmarkEnvironment& environment) const {
+        std::ofstream file(path);
+        if (!file) {
+            throw std::runtime_error("Failed to open the benchmark report " + path.string() + ".");
+        }
+
+        WriteReport(file, environment);
+
+        if (!file) {
+            throw std::runtime_error("Failed to write the benchmark report " + path.string() + ".");
+        }
+    }
+}
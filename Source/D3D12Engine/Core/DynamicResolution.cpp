@@ -0,0 +1,64 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/Core/DynamicResolution.hpp>
+
+#include <algorithm>
+
+namespace D3D12Engine {
+    DynamicResolutionController::DynamicResolutionController(const DynamicResolutionSettings& settings)
+        : m_Settings(settings),
+          m_Area(settings.MaxScale * settings.MaxScale) {
+    }
+
+    float DynamicResolutionController::Update(const double gpuFrameTimeMs) {
+        if (!m_HasSample) {
+            m_FilteredFrameTimeMs = gpuFrameTimeMs;
+            m_HasSample = true;
+        } else {
+            m_FilteredFrameTimeMs += m_Settings.SmoothingFactor * (gpuFrameTimeMs - m_FilteredFrameTimeMs);
+        }
+
+        // Positive when there is spare time, so the area can grow.
+        float error = static_cast<float>((m_Settings.TargetFrameTimeMs - m_FilteredFrameTimeMs) / m_Settings.TargetFrameTimeMs);
+        if (std::abs(error) < m_Settings.Deadband) {
+            error = 0.0f;
+        }
+
+        float step = m_Settings.ProportionalGain * (error - m_PreviousError) +
+                     m_Settings.IntegralGain * error +
+                     m_Settings.DerivativeGain * (error - 2.0f * m_PreviousError + m_PreviousPreviousError);
+        step = std::clamp(step, -m_Settings.MaxAreaStep, m_Settings.MaxAreaStep);
+
+        const float minArea = m_Settings.MinScale * m_Settings.MinScale;
+        const float maxArea = m_Settings.MaxScale * m_Settings.MaxScale;
+        m_Area = std::clamp(m_Area + step * m_Area, minArea, maxArea);
+
+        m_PreviousPreviousError = m_PreviousError;
+        m_PreviousError = error;
+
+        return GetScale();
+    }
+
+    void DynamicResolutionController::Reset() {
+        m_Area = m_Settings.MaxScale * m_Settings.MaxScale;
+        m_PreviousError = 0.0f;
+        m_PreviousPreviousError = 0.0f;
+        m_FilteredFrameTimeMs = 0.0;
+        m_HasSample = false;
+    }
+
+    RenderSize DynamicResolutionController::ComputeRenderSize(const uint32_t outputWidth, const uint32_t outputHeight) const {
+        const float scale = GetScale();
+        const uint32_t granularity = std::max(m_Settings.SizeGranularity, 1u);
+
+        const auto scaleAxis = [&](const uint32_t size) {
+            const auto scaled = static_cast<uint32_t>(static_cast<float>(size) * scale + 0.5f);
+            const uint32_t rounded = (scaled + granularity / 2) / granularity * granularity;
+            return std::clamp(rounded, std::min(granularity, size), size);
+        };
+
+        return {scaleAxis(outputWidth), scaleAxis(outputHeight)};
+    }
+}
@@ -0,0 +1,61 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/Core/FileWatcher.hpp>
+
+namespace D3D12Engine {
+    void FileWatcher::Watch(const std::filesystem::path& path) {
+        if (IsWatching(path)) {
+            return;
+        }
+
+        m_Files.push_back({path, GetStamp(path)});
+    }
+
+    void FileWatcher::Unwatch(const std::filesystem::path& path) {
+        if (const auto it = Find(path); it != m_Files.end()) {
+            m_Files.erase(it);
+        }
+    }
+
+    void FileWatcher::Poll(std::vector<std::filesystem::path>& changedFiles) {
+        for (WatchedFile& file : m_Files) {
+            const FileStamp stamp = GetStamp(file.Path);
+            if (stamp == file.Stamp) {
+                // Changed and changed back, or a save that left the file as it was.
+                file.HasPending = false;
+                continue;
+            }
+
+            if (file.HasPending && stamp == file.PendingStamp) {
+                file.Stamp = stamp;
+                file.HasPending = false;
+                changedFiles.push_back(file.Path);
+            } else {
+                // Still being written, look again next poll.
+                file.PendingStamp = stamp;
+                file.HasPending = true;
+            }
+        }
+    }
+
+    FileWatcher::FileStamp FileWatcher::GetStamp(const std::filesystem::path& path) {
+        // Errors mean the file is gone or not accessible right now, both read as missing.
+        std::error_code error;
+        FileStamp stamp;
+        stamp.WriteTime = std::filesystem::last_write_time(path, error);
+        if (error) {
+            return {};
+        }
+
+        stamp.Size = std::filesystem::file_size(path, error);
+        if (error) {
+            return {};
+        }
+
+        stamp.Exists = true;
+
+        return stamp;
+    }
+}
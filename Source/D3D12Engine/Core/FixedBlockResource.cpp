@@ -0,0 +1,79 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/Core/FixedBlockResource.hpp>
+
+#include <algorithm>
+
+namespace D3D12Engine {
+    FixedBlockResource::FixedBlockResource(const size_t blockSize, const size_t blockAlignment, const size_t blocksPerChunk,
+                                           std::pmr::memory_resource* pUpstream)
+        : m_Upstream(pUpstream),
+          m_BlockAlignment(std::max(blockAlignment, alignof(FreeBlock))),
+          m_BlocksPerChunk(std::max<size_t>(blocksPerChunk, 1)) {
+        // Free blocks hold the list link, and every block of a chunk must stay aligned.
+        const size_t size = std::max(blockSize, sizeof(FreeBlock));
+        m_BlockSize = (size + m_BlockAlignment - 1) & ~(m_BlockAlignment - 1);
+    }
+
+    FixedBlockResource::~FixedBlockResource() {
+        for (const auto& [pChunk, size] : m_Chunks) {
+            m_Upstream->deallocate(pChunk, size, m_BlockAlignment);
+        }
+    }
+
+    void FixedBlockResource::Reserve(const size_t blockCount) {
+        if (blockCount > m_FreeBlockCount) {
+            AddChunk(blockCount - m_FreeBlockCount);
+        }
+    }
+
+    void* FixedBlockResource::do_allocate(const size_t bytes, const size_t alignment) {
+        if (bytes > m_BlockSize || alignment > m_BlockAlignment) {
+            return m_Upstream->allocate(bytes, alignment);
+        }
+
+        if (!m_FreeList) {
+            AddChunk(m_BlocksPerChunk);
+        }
+
+        FreeBlock* pBlock = m_FreeList;
+        m_FreeList = pBlock->Next;
+        m_FreeBlockCount--;
+
+        return pBlock;
+    }
+
+    void FixedBlockResource::do_deallocate(void* p, const size_t bytes, const size_t alignment) {
+        if (bytes > m_BlockSize || alignment > m_BlockAlignment) {
+            m_Upstream->deallocate(p, bytes, alignment);
+            return;
+        }
+
+        auto* pBlock = static_cast<FreeBlock*>(p);
+        pBlock->Next = m_FreeList;
+        m_FreeList = pBlock;
+        m_FreeBlockCount++;
+    }
+
+    bool FixedBlockResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+        return this == &other;
+    }
+
+    void FixedBlockResource::AddChunk(const size_t blockCount) {
+        const size_t size = blockCount * m_BlockSize;
+        auto* pChunk = static_cast<std::byte*>(m_Upstream->allocate(size, m_BlockAlignment));
+        m_Chunks.emplace_back(pChunk, size);
+
+        // Thread the new blocks in address order so consecutive allocations are contiguous.
+        for (size_t i = blockCount; i > 0; --i) {
+            auto* pBlock = reinterpret_cast<FreeBlock*>(pChunk + (i - 1) * m_BlockSize);
+            pBlock->Next = m_FreeList;
+            m_FreeList = pBlock;
+        }
+
+        m_BlockCount += blockCount;
+        m_FreeBlockCount += blockCount;
+    }
+}
@@ -0,0 +1,80 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/Core/FrameStatistics.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <compare>
+#include <numeric>
+
+namespace D3D12Engine {
+    void FrameStatistics::Reserve(const size_t frameCount) {
+        m_Samples.reserve(frameCount);
+    }
+
+    void FrameStatistics::Add(const FrameSample& sample) {
+        m_Samples.push_back(sample);
+    }
+
+    void FrameStatistics::Clear() {
+        m_Samples.clear();
+    }
+
+    StatisticSummary FrameStatistics::Summarize(double FrameSample::* timing) const {
+        std::vector<double> values;
+        values.reserve(m_Samples.size());
+        for (const FrameSample& sample : m_Samples) {
+            values.push_back(sample.*timing);
+        }
+
+        return Summarize(values);
+    }
+
+    uint64_t FrameStatistics::GetPeakMemory() const {
+        uint64_t peak = 0;
+        for (const FrameSample& sample : m_Samples) {
+            peak = std::max(peak, sample.MemoryBytes);
+        }
+
+        return peak;
+    }
+
+    StatisticSummary FrameStatistics::Summarize(const std::span<double> values) {
+        if (values.empty()) {
+            return {};
+        }
+
+        // A total order, a NaN timing from a failed query mustn't break the sort.
+        std::ranges::sort(values, [](const double a, const double b) { return std::strong_order(a, b) < 0; });
+
+        StatisticSummary summary;
+        summary.Min = values.front();
+        summary.Max = values.back();
+        summary.Mean = std::accumulate(values.begin(), values.end(), 0.0) / static_cast<double>(values.size());
+        summary.P50 = Percentile(values, 50.0);
+        summary.P95 = Percentile(values, 95.0);
+        summary.P99 = Percentile(values, 99.0);
+
+        return summary;
+    }
+
+    double FrameStatistics::Percentile(const std::span<const double> sortedValues, const double percentile) {
+        if (sortedValues.empty()) {
+            return 0.0;
+        }
+
+        const double rank = std::clamp(percentile, 0.0, 100.0) / 100.0 * static_cast<double>(sortedValues.size() - 1);
+        const auto lower = static_cast<size_t>(std::floor(rank));
+        const size_t upper = std::min(lower + 1, sortedValues.size() - 1);
+        const double t = rank - static_cast<double>(lower);
+
+        // Exact ranks skip the interpolation, which an infinite neighbour would turn into NaN.
+        if (t == 0.0) {
+            return sortedValues[lower];
+        }
+
+        return sortedValues[lower] + (sortedValues[upper] - sortedValues[lower]) * t;
+    }
+}
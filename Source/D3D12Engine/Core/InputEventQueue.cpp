@@ -0,0 +1,33 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/Core/InputEventQueue.hpp>
+
+namespace D3D12Engine {
+    InputEventQueue::InputEventQueue(const size_t capacity)
+        : m_Events(capacity) {
+    }
+
+    bool InputEventQueue::Push(const InputEvent& event) {
+        if (!m_Events.TryPush(event)) {
+            m_DroppedCount.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        return true;
+    }
+
+    void InputEventQueue::Synchronize(const double time, const double simulationTime) {
+        // Re-anchored every tick, so the deltas the timer clamped or rounded never add up.
+        m_SimulationOffset = simulationTime - time;
+    }
+
+    double InputEventQueue::ToSimulationTime(const double time) const {
+        return time + m_SimulationOffset;
+    }
+
+    double InputEventQueue::ToTime(const double simulationTime) const {
+        return simulationTime - m_SimulationOffset;
+    }
+}
@@ -0,0 +1,102 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/Core/JobSystem.hpp>
+
+#include <algorithm>
+
+namespace D3D12Engine {
+    JobSystem::JobSystem(const uint32_t workerCount) {
+        m_Workers.reserve(workerCount);
+        for (uint32_t i = 0; i < workerCount; ++i) {
+            m_Workers.emplace_back([this] { WorkerMain(); });
+        }
+    }
+
+    JobSystem::~JobSystem() {
+        {
+            std::lock_guard lock(m_Mutex);
+            m_Stop = true;
+        }
+        m_LoopStarted.notify_all();
+
+        for (auto& worker : m_Workers) {
+            worker.join();
+        }
+    }
+
+    uint32_t JobSystem::GetDefaultWorkerCount() {
+        const uint32_t coreCount = std::thread::hardware_concurrency();
+        return coreCount > 1 ? coreCount - 1 : 0;
+    }
+
+    void JobSystem::Run(const uint32_t count, const uint32_t grainSize, const ChunkFunction function, void* pContext) {
+        if (count == 0) {
+            return;
+        }
+
+        const uint32_t grain = std::max(grainSize, 1u);
+        const uint32_t chunkCount = (count + grain - 1) / grain;
+
+        // Not worth waking anyone up.
+        if (m_Workers.empty() || chunkCount == 1) {
+            function(pContext, 0, count);
+            return;
+        }
+
+        std::lock_guard runLock(m_RunMutex);
+
+        Loop loop{function, pContext, count, grain, chunkCount};
+        {
+            std::lock_guard lock(m_Mutex);
+            m_pLoop = &loop;
+            m_LoopIndex++;
+        }
+        m_LoopStarted.notify_all();
+
+        RunChunks(loop);
+
+        // Every chunk was handed out, wait for the workers still running one. Workers that
+        // didn't pick the loop up yet won't see it anymore.
+        std::unique_lock lock(m_Mutex);
+        m_LoopFinished.wait(lock, [&] { return loop.ActiveWorkers == 0; });
+        m_pLoop = nullptr;
+    }
+
+    void JobSystem::RunChunks(Loop& loop) {
+        for (uint32_t chunk = loop.NextChunk.fetch_add(1, std::memory_order_relaxed);
+             chunk < loop.ChunkCount;
+             chunk = loop.NextChunk.fetch_add(1, std::memory_order_relaxed)) {
+            const uint32_t begin = chunk * loop.GrainSize;
+            const uint32_t end = std::min(begin + loop.GrainSize, loop.Count);
+            loop.Function(loop.pContext, begin, end);
+        }
+    }
+
+    void JobSystem::WorkerMain() {
+        uint64_t lastLoopIndex = 0;
+
+        while (true) {
+            Loop* pLoop;
+            {
+                std::unique_lock lock(m_Mutex);
+                m_LoopStarted.wait(lock, [&] { return m_Stop || (m_pLoop && m_LoopIndex != lastLoopIndex); });
+                if (m_Stop) {
+                    return;
+                }
+
+                lastLoopIndex = m_LoopIndex;
+                pLoop = m_pLoop;
+                pLoop->ActiveWorkers++;
+            }
+
+            RunChunks(*pLoop);
+
+            std::lock_guard lock(m_Mutex);
+            if (--pLoop->ActiveWorkers == 0) {
+                m_LoopFinished.notify_one();
+            }
+        }
+    }
+}
@@ -0,0 +1,86 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/Core/LinearArena.hpp>
+
+#include <algorithm>
+#include <memory>
+
+namespace D3D12Engine {
+    LinearArena::LinearArena(const size_t capacity)
+        : m_Memory(static_cast<std::byte*>(::operator new(capacity, std::align_val_t{BlockAlignment}))),
+          m_Capacity(capacity) {
+        // The overflow list is the only thing that could allocate while in use, reserve it up front.
+        m_Overflow.reserve(16);
+    }
+
+    LinearArena::~LinearArena() {
+        FreeOverflow(0);
+        ::operator delete(m_Memory, std::align_val_t{BlockAlignment});
+    }
+
+    void* LinearArena::Allocate(const size_t size, const size_t alignment) {
+        const size_t alignedOffset = (m_Offset + alignment - 1) & ~(alignment - 1);
+
+        // Alignments above the block's can't be honoured by offsetting alone.
+        if (alignment <= BlockAlignment && alignedOffset + size <= m_Capacity) {
+            m_Offset = alignedOffset + size;
+            m_HighWaterMark = std::max(m_HighWaterMark, GetUsed());
+
+            return m_Memory + alignedOffset;
+        }
+
+        void* pMemory = ::operator new(size, std::align_val_t{alignment});
+        m_Overflow.push_back({pMemory, size, alignment});
+        m_OverflowBytes += size;
+        m_HighWaterMark = std::max(m_HighWaterMark, GetUsed());
+
+        return pMemory;
+    }
+
+    void LinearArena::Reset() {
+        // Over-aligned allocations and ones pushed out by padding overflow without raising the
+        // high water mark past the block, they have to go whether it grows or not.
+        FreeOverflow(0);
+
+        // Checked against the high water mark rather than the overflow list, which rewinds may
+        // have emptied already.
+        if (m_HighWaterMark > m_Capacity) {
+            // Grow so everything used this time fits in the block next time.
+            const size_t capacity = std::max(m_Capacity * 2, m_HighWaterMark + m_HighWaterMark / 4);
+
+            ::operator delete(m_Memory, std::align_val_t{BlockAlignment});
+            m_Memory = static_cast<std::byte*>(::operator new(capacity, std::align_val_t{BlockAlignment}));
+            m_Capacity = capacity;
+        }
+
+        m_Offset = 0;
+    }
+
+    void LinearArena::Rewind(const Marker marker) {
+        FreeOverflow(marker.OverflowCount);
+        m_Offset = marker.Offset;
+    }
+
+    void* LinearArena::do_allocate(const size_t bytes, const size_t alignment) {
+        return Allocate(bytes, alignment);
+    }
+
+    void LinearArena::do_deallocate(void*, size_t, size_t) {
+        // Memory is only released by Reset() and Rewind().
+    }
+
+    bool LinearArena::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+        return this == &other;
+    }
+
+    void LinearArena::FreeOverflow(const size_t keepCount) {
+        while (m_Overflow.size() > keepCount) {
+            const Overflow& overflow = m_Overflow.back();
+            ::operator delete(overflow.Memory, std::align_val_t{overflow.Alignment});
+            m_OverflowBytes -= overflow.Size;
+            m_Overflow.pop_back();
+        }
+    }
+}
@@ -0,0 +1,58 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/Core/ResizeCoalescer.hpp>
+
+namespace D3D12Engine {
+    ResizeCoalescer::ResizeCoalescer(const WindowSize currentSize, const ResizeCoalescerSettings& settings)
+        : m_Settings(settings),
+          m_CurrentSize(currentSize) {
+    }
+
+    void ResizeCoalescer::OnResize(const WindowSize size, const double time) {
+        if (size.Width == 0 || size.Height == 0) {
+            return;
+        }
+
+        if (size == m_CurrentSize) {
+            // Back to where we are, e.g. a drag that ended at the starting size.
+            m_PendingSize.reset();
+            return;
+        }
+
+        if (!m_PendingSize) {
+            // Start the interval from the first change, not from the last resize done ages ago.
+            m_LastApplyTime = time;
+        }
+
+        m_PendingSize = size;
+        m_LastEventTime = time;
+    }
+
+    void ResizeCoalescer::OnBeginInteractiveResize() {
+        m_Interactive = true;
+    }
+
+    void ResizeCoalescer::OnEndInteractiveResize() {
+        m_Interactive = false;
+    }
+
+    std::optional<WindowSize> ResizeCoalescer::Poll(const double time) {
+        if (!m_PendingSize) {
+            return std::nullopt;
+        }
+
+        if (m_Interactive &&
+            time - m_LastEventTime < m_Settings.SettleTimeSeconds &&
+            time - m_LastApplyTime < m_Settings.MaxIntervalSeconds) {
+            return std::nullopt;
+        }
+
+        m_CurrentSize = *m_PendingSize;
+        m_PendingSize.reset();
+        m_LastApplyTime = time;
+
+        return m_CurrentSize;
+    }
+}
@@ -0,0 +1,25 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/Core/ScratchArena.hpp>
+
+namespace D3D12Engine {
+    ScratchArena::ScratchArena()
+        : m_Arena(GetThreadArena()), m_Marker(m_Arena.GetMarker()) {
+    }
+
+    ScratchArena::~ScratchArena() {
+        // Back at the bottom of the stack, a reset also lets the arena grow if scopes overflowed it.
+        if (m_Marker.Offset == 0 && m_Marker.OverflowCount == 0) {
+            m_Arena.Reset();
+        } else {
+            m_Arena.Rewind(m_Marker);
+        }
+    }
+
+    LinearArena& ScratchArena::GetThreadArena() {
+        thread_local LinearArena arena(ThreadCapacity);
+        return arena;
+    }
+}
@@ -0,0 +1,65 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/Core/ScriptedCamera.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace D3D12Engine {
+    ScriptedCamera::ScriptedCamera(const std::span<const CameraKeyframe> keyframes)
+        : m_Keyframes(keyframes.begin(), keyframes.end()) {
+        if (m_Keyframes.size() < 2) {
+            throw std::invalid_argument("A camera path needs at least two keyframes.");
+        }
+
+        if (m_Keyframes.front().Time != 0.0) {
+            throw std::invalid_argument("A camera path must start at time zero.");
+        }
+
+        for (size_t i = 1; i < m_Keyframes.size(); ++i) {
+            if (m_Keyframes[i].Time <= m_Keyframes[i - 1].Time) {
+                throw std::invalid_argument("Camera keyframe times must be increasing.");
+            }
+        }
+    }
+
+    std::array<float, 3> ScriptedCamera::Evaluate(const double time) const {
+        double wrapped = std::fmod(time, GetDuration());
+        if (wrapped < 0.0) {
+            wrapped += GetDuration();
+        }
+
+        // Segment [i, i + 1] containing the time.
+        const auto next = std::ranges::upper_bound(m_Keyframes, wrapped, {}, &CameraKeyframe::Time);
+        const size_t i = std::min(static_cast<size_t>(next - m_Keyframes.begin()), m_Keyframes.size() - 1) - 1;
+        const size_t last = m_Keyframes.size() - 1;
+
+        const CameraKeyframe& k1 = m_Keyframes[i];
+        const CameraKeyframe& k2 = m_Keyframes[i + 1];
+        // The ends reuse their own keyframe as the missing neighbour.
+        const CameraKeyframe& k0 = m_Keyframes[i == 0 ? 0 : i - 1];
+        const CameraKeyframe& k3 = m_Keyframes[std::min(i + 2, last)];
+
+        const auto t = static_cast<float>((wrapped - k1.Time) / (k2.Time - k1.Time));
+        const float t2 = t * t;
+        const float t3 = t2 * t;
+
+        std::array<float, 3> position;
+        for (size_t axis = 0; axis < 3; ++axis) {
+            const float p0 = k0.Position[axis];
+            const float p1 = k1.Position[axis];
+            const float p2 = k2.Position[axis];
+            const float p3 = k3.Position[axis];
+
+            position[axis] = 0.5f * (2.0f * p1 +
+                                     (p2 - p0) * t +
+                                     (2.0f * p0 - 5.0f * p1 + 4.0f * p2 - p3) * t2 +
+                                     (3.0f * p1 - p0 - 3.0f * p2 + p3) * t3);
+        }
+
+        return position;
+    }
+}
@@ -71,8 +71,13 @@ namespace D3D12Engine {
         case WM_DESTROY:
             PostQuitMessage(0);
             return 0;
-        case WM_ACTIVATE:
         case WM_INPUT:
+            // The raw input handle is only valid while the message is being handled, so it
+            // cannot be queued.
+            DirectX::Mouse::ProcessMessage(msg, wParam, lParam);
+            break;
+
+        case WM_ACTIVATE:
         case WM_MOUSEMOVE:
         case WM_LBUTTONDOWN:
         case WM_LBUTTONUP:
@@ -84,24 +89,34 @@ namespace D3D12Engine {
         case WM_XBUTTONDOWN:
         case WM_XBUTTONUP:
         case WM_MOUSEHOVER:
-            DirectX::Mouse::ProcessMessage(msg, wParam, lParam);
-            break;
-
         case WM_KEYDOWN:
         case WM_KEYUP:
         case WM_SYSKEYDOWN:
         case WM_SYSKEYUP:
-            DirectX::Keyboard::ProcessMessage(msg, wParam, lParam);
+            if (app) {
+                app->OnInputMessage(msg, wParam, lParam);
+            }
+            break;
+
+        case WM_SIZE:
+            if (app && wParam != SIZE_MINIMIZED) {
+                app->OnWindowSizeChanged(LOWORD(lParam), HIWORD(lParam));
+            }
             break;
 
         case WM_ENTERSIZEMOVE:
             sizeMove = true;
+            if (app) {
+                app->OnBeginInteractiveResize();
+            }
             break;
 
         case WM_EXITSIZEMOVE:
             {
                 sizeMove = false;
                 if (app) {
+                    app->OnEndInteractiveResize();
+
                     RECT rc;
                     GetClientRect(hWnd, &rc);
 
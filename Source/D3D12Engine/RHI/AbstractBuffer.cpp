@@ -4,32 +4,28 @@
 
 #include <D3D12Engine/RHI/AbstractBuffer.hpp>
 
-#include <D3D12Engine/RHI/DxUtils.hpp>
-
-#include <format>
-
 namespace D3D12Engine {
-    AbstractBuffer::AbstractBuffer(ID3D12Device* pDevice, const size_t size)
-        : m_Device(pDevice) {
-        const auto heapProperties = CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_UPLOAD);
-        const auto ibResDesc = CD3DX12_RESOURCE_DESC::Buffer(size);
+    AbstractBuffer::AbstractBuffer(RenderDevice& device, const size_t size, const BufferUsage usage, const std::string_view name)
+        : m_Device(device), m_Size(size) {
+        BufferDesc desc;
+        desc.Size = size;
+        desc.Memory = MemoryType::Upload;
+        desc.Usage = usage;
+        desc.InitialState = ResourceState::GenericRead;
+        desc.Name = name;
+
+        m_Buffer = m_Device.CreateBuffer(desc);
+    }
 
-        ThrowIfFailed(m_Device->CreateCommittedResource(
-                &heapProperties,
-                D3D12_HEAP_FLAG_NONE,
-                &ibResDesc,
-                D3D12_RESOURCE_STATE_GENERIC_READ,
-                nullptr,
-                IID_PPV_ARGS(&m_Buffer))
-        );
+    AbstractBuffer::~AbstractBuffer() {
+        m_Device.DestroyResource(m_Buffer);
     }
 
-    void AbstractBuffer::Map(UINT8** pDataBegin) const {
-        const CD3DX12_RANGE readRange(0, 0);
-        ThrowIfFailed(m_Buffer->Map(0, &readRange, reinterpret_cast<void**>(pDataBegin)));
+    void AbstractBuffer::Map(uint8_t** pDataBegin) const {
+        *pDataBegin = m_Device.Map(m_Buffer);
     }
 
     void AbstractBuffer::Unmap() const {
-        m_Buffer->Unmap(0, nullptr);
+        m_Device.Unmap(m_Buffer);
     }
 }
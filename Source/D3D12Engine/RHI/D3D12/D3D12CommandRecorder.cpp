@@ -0,0 +1,95 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/RHI/D3D12/D3D12CommandRecorder.hpp>
+
+#include <algorithm>
+
+namespace D3D12Engine {
+    D3D12CommandRecorder::D3D12CommandRecorder(const D3D12RenderDevice& device, ID3D12GraphicsCommandList* pCommandList)
+        : m_Device(device), m_CommandList(pCommandList) {
+    }
+
+    void D3D12CommandRecorder::ResourceBarrier(const std::span<const ResourceTransition> transitions) {
+        // Submitted in batches from the stack to keep recording allocation free.
+        constexpr size_t BatchSize = 16;
+        std::array<D3D12_RESOURCE_BARRIER, BatchSize> barriers;
+
+        for (size_t first = 0; first < transitions.size(); first += BatchSize) {
+            const size_t count = std::min(BatchSize, transitions.size() - first);
+            for (size_t i = 0; i < count; ++i) {
+                const auto& transition = transitions[first + i];
+                barriers[i] = CD3DX12_RESOURCE_BARRIER::Transition(
+                    m_Device.GetResource(transition.Resource),
+                    static_cast<D3D12_RESOURCE_STATES>(transition.Before),
+                    static_cast<D3D12_RESOURCE_STATES>(transition.After),
+                    transition.Subresource);
+            }
+
+            m_CommandList->ResourceBarrier(static_cast<UINT>(count), barriers.data());
+        }
+    }
+
+    void D3D12CommandRecorder::SetPipeline(const PipelineHandle pipeline) {
+        const auto& entry = m_Device.GetPipeline(pipeline);
+        m_CommandList->SetPipelineState(entry.PipelineState.Get());
+        m_CommandList->SetGraphicsRootSignature(entry.RootSignature.Get());
+        m_CommandList->IASetPrimitiveTopology(entry.Topology);
+    }
+
+    void D3D12CommandRecorder::SetViewport(const Viewport& viewport) {
+        const D3D12_VIEWPORT d3dViewport{viewport.X, viewport.Y, viewport.Width, viewport.Height, viewport.MinDepth, viewport.MaxDepth};
+        m_CommandList->RSSetViewports(1, &d3dViewport);
+    }
+
+    void D3D12CommandRecorder::SetScissorRect(const ScissorRect& rect) {
+        const D3D12_RECT d3dRect{rect.Left, rect.Top, rect.Right, rect.Bottom};
+        m_CommandList->RSSetScissorRects(1, &d3dRect);
+    }
+
+    void D3D12CommandRecorder::SetRenderTarget(const ResourceHandle texture) {
+        const D3D12_CPU_DESCRIPTOR_HANDLE rtvHandle = m_Device.GetRenderTargetView(texture);
+        m_CommandList->OMSetRenderTargets(1, &rtvHandle, FALSE, nullptr);
+    }
+
+    void D3D12CommandRecorder::ClearRenderTarget(const ResourceHandle texture, const std::array<float, 4>& color, const ScissorRect* pRect) {
+        if (pRect) {
+            const D3D12_RECT d3dRect{pRect->Left, pRect->Top, pRect->Right, pRect->Bottom};
+            m_CommandList->ClearRenderTargetView(m_Device.GetRenderTargetView(texture), color.data(), 1, &d3dRect);
+        } else {
+            m_CommandList->ClearRenderTargetView(m_Device.GetRenderTargetView(texture), color.data(), 0, nullptr);
+        }
+    }
+
+    void D3D12CommandRecorder::SetRootConstants(const uint32_t rootIndex, const std::span<const uint32_t> values, const uint32_t offset) {
+        m_CommandList->SetGraphicsRoot32BitConstants(rootIndex, static_cast<UINT>(values.size()), values.data(), offset);
+    }
+
+    void D3D12CommandRecorder::SetShaderResource(const uint32_t rootIndex, const ResourceHandle texture) {
+        if (!m_DescriptorHeapBound) {
+            ID3D12DescriptorHeap* ppHeaps[] = {m_Device.GetShaderResourceHeap()};
+            m_CommandList->SetDescriptorHeaps(_countof(ppHeaps), ppHeaps);
+            m_DescriptorHeapBound = true;
+        }
+
+        m_CommandList->SetGraphicsRootDescriptorTable(rootIndex, m_Device.GetShaderResourceView(texture));
+    }
+
+    void D3D12CommandRecorder::SetVertexBuffer(const VertexBufferView& view) {
+        const D3D12_VERTEX_BUFFER_VIEW d3dView{m_Device.GetResource(view.Buffer)->GetGPUVirtualAddress(), view.Size, view.Stride};
+        m_CommandList->IASetVertexBuffers(0, 1, &d3dView);
+    }
+
+    void D3D12CommandRecorder::Draw(const uint32_t vertexCount, const uint32_t instanceCount, const uint32_t firstVertex, const uint32_t firstInstance) {
+        m_CommandList->DrawInstanced(vertexCount, instanceCount, firstVertex, firstInstance);
+    }
+
+    void D3D12CommandRecorder::ExecuteIndirect(const CommandSignatureHandle signature, const uint32_t maxCommandCount,
+                                               const ResourceHandle argumentBuffer, const uint64_t argumentOffset,
+                                               const ResourceHandle countBuffer, const uint64_t countOffset) {
+        m_CommandList->ExecuteIndirect(m_Device.GetCommandSignature(signature), maxCommandCount,
+                                       m_Device.GetResource(argumentBuffer), argumentOffset,
+                                       countBuffer.IsValid() ? m_Device.GetResource(countBuffer) : nullptr, countOffset);
+    }
+}
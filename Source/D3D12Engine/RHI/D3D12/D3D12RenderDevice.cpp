@@ -0,0 +1,379 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/RHI/D3D12/D3D12RenderDevice.hpp>
+
+#include <D3D12Engine/Core/ScratchArena.hpp>
+#include <D3D12Engine/RHI/DxUtils.hpp>
+
+namespace D3D12Engine {
+    namespace {
+        D3D12_HEAP_TYPE GetHeapType(const MemoryType memory) {
+            switch (memory) {
+            case MemoryType::Upload:
+                return D3D12_HEAP_TYPE_UPLOAD;
+            case MemoryType::Readback:
+                return D3D12_HEAP_TYPE_READBACK;
+            default:
+                return D3D12_HEAP_TYPE_DEFAULT;
+            }
+        }
+
+        void SetObjectName(ID3D12Object* pObject, const std::string_view name) {
+            if (!name.empty()) {
+                // Widened into scratch memory, D3D12 copies the name.
+                const ScratchArena scratch;
+                const std::pmr::wstring wName(name.begin(), name.end(), scratch.GetResource());
+                ThrowIfFailed(pObject->SetName(wName.c_str()));
+            }
+        }
+
+        D3D12_SHADER_VISIBILITY GetShaderVisibility(const ShaderVisibility visibility) {
+            switch (visibility) {
+            case ShaderVisibility::Vertex:
+                return D3D12_SHADER_VISIBILITY_VERTEX;
+            case ShaderVisibility::Pixel:
+                return D3D12_SHADER_VISIBILITY_PIXEL;
+            default:
+                return D3D12_SHADER_VISIBILITY_ALL;
+            }
+        }
+
+        D3D_PRIMITIVE_TOPOLOGY GetTopology(const PrimitiveTopology topology) {
+            switch (topology) {
+            case PrimitiveTopology::TriangleStrip:
+                return D3D_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP;
+            case PrimitiveTopology::LineList:
+                return D3D_PRIMITIVE_TOPOLOGY_LINELIST;
+            default:
+                return D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
+            }
+        }
+
+        D3D12_SHADER_BYTECODE GetBytecode(const std::span<const std::byte> bytecode) {
+            return {bytecode.data(), bytecode.size()};
+        }
+    }
+
+    UINT D3D12RenderDevice::DescriptorHeap::Allocate() {
+        if (!FreeIndices.empty()) {
+            const UINT index = FreeIndices.back();
+            FreeIndices.pop_back();
+            return index;
+        }
+
+        if (Next == Capacity) {
+            throw std::exception("Descriptor heap is full.");
+        }
+
+        return Next++;
+    }
+
+    void D3D12RenderDevice::DescriptorHeap::Free(const UINT index) {
+        FreeIndices.push_back(index);
+    }
+
+    D3D12RenderDevice::D3D12RenderDevice(ID3D12Device* pDevice, const UINT maxRenderTargetViews, const UINT maxShaderResourceViews)
+        : m_Device(pDevice) {
+        D3D12_DESCRIPTOR_HEAP_DESC rtvHeapDesc = {};
+        rtvHeapDesc.NumDescriptors = maxRenderTargetViews;
+        rtvHeapDesc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_RTV;
+        rtvHeapDesc.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_NONE;
+        ThrowIfFailed(m_Device->CreateDescriptorHeap(&rtvHeapDesc, IID_PPV_ARGS(&m_RtvHeap.Heap)), "Failed to create RTV heap.");
+        m_RtvHeap.DescriptorSize = m_Device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_RTV);
+        m_RtvHeap.Capacity = maxRenderTargetViews;
+
+        D3D12_DESCRIPTOR_HEAP_DESC srvHeapDesc = {};
+        srvHeapDesc.NumDescriptors = maxShaderResourceViews;
+        srvHeapDesc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV;
+        srvHeapDesc.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE;
+        ThrowIfFailed(m_Device->CreateDescriptorHeap(&srvHeapDesc, IID_PPV_ARGS(&m_SrvHeap.Heap)), "Failed to create SRV heap.");
+        m_SrvHeap.DescriptorSize = m_Device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+        m_SrvHeap.Capacity = maxShaderResourceViews;
+
+        m_MemoryStatistics.RecordAllocation(GpuMemoryCategory::DescriptorHeap,
+                                            static_cast<uint64_t>(maxRenderTargetViews) * m_RtvHeap.DescriptorSize +
+                                            static_cast<uint64_t>(maxShaderResourceViews) * m_SrvHeap.DescriptorSize);
+    }
+
+    ResourceHandle D3D12RenderDevice::CreateBuffer(const BufferDesc& desc) {
+        const auto heapProperties = CD3DX12_HEAP_PROPERTIES(GetHeapType(desc.Memory));
+        const auto bufferDesc = CD3DX12_RESOURCE_DESC::Buffer(desc.Size);
+
+        ComPtr<ID3D12Resource> buffer;
+        ThrowIfFailed(m_Device->CreateCommittedResource(
+                &heapProperties,
+                D3D12_HEAP_FLAG_NONE,
+                &bufferDesc,
+                static_cast<D3D12_RESOURCE_STATES>(desc.InitialState),
+                nullptr,
+                IID_PPV_ARGS(&buffer)),
+            "Failed to create buffer."
+        );
+        SetObjectName(buffer.Get(), desc.Name);
+
+        const ResourceHandle handle = AddResource(std::move(buffer), {}, DXGI_FORMAT_UNKNOWN);
+        m_Resources[handle.Index].Memory = desc.Memory;
+        m_MemoryStatistics.RecordAllocation(handle, GetMemoryCategory(desc), GetAllocationSize(bufferDesc));
+
+        // Upload and readback buffers can't leave their initial state, there is nothing to track.
+        if (desc.Memory == MemoryType::Default) {
+            m_ResourceStates.Register(handle, desc.InitialState);
+        }
+
+        return handle;
+    }
+
+    ResourceHandle D3D12RenderDevice::CreateTexture(const TextureDesc& desc) {
+        const auto format = static_cast<DXGI_FORMAT>(desc.Format);
+        const bool isRenderTarget = HasUsage(desc.Usage, TextureUsage::RenderTarget);
+
+        const auto heapProperties = CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_DEFAULT);
+        const auto textureDesc = CD3DX12_RESOURCE_DESC::Tex2D(format, desc.Width, desc.Height, 1, 1, 1, 0,
+                                                              isRenderTarget ? D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET : D3D12_RESOURCE_FLAG_NONE);
+        const CD3DX12_CLEAR_VALUE clearValue(format, desc.ClearColor.data());
+
+        ComPtr<ID3D12Resource> texture;
+        ThrowIfFailed(m_Device->CreateCommittedResource(
+                &heapProperties,
+                D3D12_HEAP_FLAG_NONE,
+                &textureDesc,
+                static_cast<D3D12_RESOURCE_STATES>(desc.InitialState),
+                isRenderTarget ? &clearValue : nullptr,
+                IID_PPV_ARGS(&texture)),
+            "Failed to create texture."
+        );
+        SetObjectName(texture.Get(), desc.Name);
+
+        const ResourceHandle handle = AddResource(std::move(texture), desc.Usage, format);
+        m_ResourceStates.Register(handle, desc.InitialState);
+        m_MemoryStatistics.RecordAllocation(handle, GetMemoryCategory(desc.Usage), GetAllocationSize(textureDesc));
+
+        return handle;
+    }
+
+    void D3D12RenderDevice::DestroyResource(const ResourceHandle resource) {
+        auto& entry = m_Resources[resource.Index];
+        if (entry.RtvIndex != NoDescriptor) {
+            m_RtvHeap.Free(entry.RtvIndex);
+        }
+
+        if (entry.SrvIndex != NoDescriptor) {
+            m_SrvHeap.Free(entry.SrvIndex);
+        }
+
+        m_ResourceStates.Unregister(resource);
+        m_MemoryStatistics.RecordRelease(resource);
+        entry = Resource{};
+        m_FreeResources.push_back(resource.Index);
+    }
+
+    uint8_t* D3D12RenderDevice::Map(const ResourceHandle buffer) {
+        // We never read back from upload buffers, readback buffers may be read entirely.
+        const auto& entry = m_Resources[buffer.Index];
+        const CD3DX12_RANGE emptyRange(0, 0);
+        uint8_t* pData;
+        ThrowIfFailed(entry.Resource->Map(0, entry.Memory == MemoryType::Upload ? &emptyRange : nullptr, reinterpret_cast<void**>(&pData)),
+                      "Failed to map buffer.");
+
+        return pData;
+    }
+
+    void D3D12RenderDevice::Unmap(const ResourceHandle buffer) {
+        const auto& entry = m_Resources[buffer.Index];
+        const CD3DX12_RANGE emptyRange(0, 0);
+        entry.Resource->Unmap(0, entry.Memory == MemoryType::Readback ? &emptyRange : nullptr);
+    }
+
+    void D3D12RenderDevice::SetDebugName(const ResourceHandle resource, const std::string_view name) {
+        SetObjectName(GetResource(resource), name);
+    }
+
+    PipelineHandle D3D12RenderDevice::CreatePipeline(const PipelineDesc& desc) {
+        m_Pipelines.push_back(BuildPipeline(desc));
+
+        return {static_cast<uint32_t>(m_Pipelines.size() - 1)};
+    }
+
+    void D3D12RenderDevice::ReplacePipeline(const PipelineHandle pipeline, const PipelineDesc& desc) {
+        // Same root parameters give back the cached root signature, command signatures stay valid.
+        Pipeline replacement = BuildPipeline(desc);
+        if (replacement.RootSignature != m_Pipelines[pipeline.Index].RootSignature) {
+            throw std::invalid_argument("Replaced pipelines must keep their root parameters.");
+        }
+
+        m_Pipelines[pipeline.Index] = std::move(replacement);
+    }
+
+    CommandSignatureHandle D3D12RenderDevice::CreateCommandSignature(const CommandSignatureDesc& desc) {
+        D3D12_INDIRECT_ARGUMENT_DESC arguments[2] = {};
+        UINT argumentCount = 0;
+
+        if (desc.RootConstantCount > 0) {
+            arguments[argumentCount].Type = D3D12_INDIRECT_ARGUMENT_TYPE_CONSTANT;
+            arguments[argumentCount].Constant.RootParameterIndex = desc.RootConstantsIndex;
+            arguments[argumentCount].Constant.DestOffsetIn32BitValues = 0;
+            arguments[argumentCount].Constant.Num32BitValuesToSet = desc.RootConstantCount;
+            argumentCount++;
+        }
+
+        arguments[argumentCount].Type = D3D12_INDIRECT_ARGUMENT_TYPE_DRAW;
+        argumentCount++;
+
+        D3D12_COMMAND_SIGNATURE_DESC signatureDesc = {};
+        signatureDesc.ByteStride = GetCommandStride(desc);
+        signatureDesc.NumArgumentDescs = argumentCount;
+        signatureDesc.pArgumentDescs = arguments;
+
+        // The root signature is only needed when the commands change root arguments.
+        ID3D12RootSignature* pRootSignature = desc.RootConstantCount > 0 ? GetPipeline(desc.Pipeline).RootSignature.Get() : nullptr;
+
+        ComPtr<ID3D12CommandSignature> signature;
+        ThrowIfFailed(m_Device->CreateCommandSignature(&signatureDesc, pRootSignature, IID_PPV_ARGS(&signature)),
+                      "Failed to create command signature.");
+        m_CommandSignatures.push_back(std::move(signature));
+
+        return {static_cast<uint32_t>(m_CommandSignatures.size() - 1)};
+    }
+
+    ResourceHandle D3D12RenderDevice::RegisterResource(ComPtr<ID3D12Resource> resource, const TextureUsage usage, const ResourceState state) {
+        const D3D12_RESOURCE_DESC desc = resource->GetDesc();
+        const ResourceHandle handle = AddResource(std::move(resource), usage, desc.Format);
+        m_ResourceStates.Register(handle, state);
+        m_MemoryStatistics.RecordAllocation(handle, GetMemoryCategory(usage), GetAllocationSize(desc));
+
+        return handle;
+    }
+
+    D3D12RenderDevice::Pipeline D3D12RenderDevice::BuildPipeline(const PipelineDesc& desc) {
+        const ScratchArena scratch;
+        std::pmr::vector<D3D12_INPUT_ELEMENT_DESC> elements(scratch.GetResource());
+        elements.reserve(desc.InputLayout.size());
+        for (const VertexElement& element : desc.InputLayout) {
+            elements.push_back({element.SemanticName, element.SemanticIndex, static_cast<DXGI_FORMAT>(element.Format), 0,
+                                element.Offset, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0});
+        }
+
+        Pipeline pipeline;
+        pipeline.RootSignature = GetRootSignature(desc);
+        pipeline.Topology = GetTopology(desc.Topology);
+
+        D3D12_GRAPHICS_PIPELINE_STATE_DESC psoDesc = {};
+        psoDesc.InputLayout = {elements.data(), static_cast<UINT>(elements.size())};
+        psoDesc.pRootSignature = pipeline.RootSignature.Get();
+        psoDesc.VS = GetBytecode(desc.VertexShader);
+        psoDesc.PS = GetBytecode(desc.PixelShader);
+        psoDesc.RasterizerState = CD3DX12_RASTERIZER_DESC(D3D12_DEFAULT);
+        psoDesc.BlendState = CD3DX12_BLEND_DESC(D3D12_DEFAULT);
+        psoDesc.DepthStencilState.DepthEnable = FALSE;
+        psoDesc.DepthStencilState.StencilEnable = FALSE;
+        psoDesc.SampleMask = UINT_MAX;
+        psoDesc.PrimitiveTopologyType = desc.Topology == PrimitiveTopology::LineList ? D3D12_PRIMITIVE_TOPOLOGY_TYPE_LINE
+                                                                                      : D3D12_PRIMITIVE_TOPOLOGY_TYPE_TRIANGLE;
+        psoDesc.NumRenderTargets = 1;
+        psoDesc.RTVFormats[0] = static_cast<DXGI_FORMAT>(desc.RenderTargetFormat);
+        psoDesc.SampleDesc.Count = 1;
+
+        ThrowIfFailed(m_Device->CreateGraphicsPipelineState(&psoDesc, IID_PPV_ARGS(&pipeline.PipelineState)),
+                      "Failed to create pipeline state.");
+        SetObjectName(pipeline.PipelineState.Get(), desc.Name);
+
+        return pipeline;
+    }
+
+    ComPtr<ID3D12RootSignature> D3D12RenderDevice::GetRootSignature(const PipelineDesc& desc) {
+        const ScratchArena scratch;
+        // One range per parameter so the tables can point into it.
+        std::pmr::vector<CD3DX12_DESCRIPTOR_RANGE> ranges(desc.RootParameters.size(), scratch.GetResource());
+        std::pmr::vector<CD3DX12_ROOT_PARAMETER> parameters(desc.RootParameters.size(), scratch.GetResource());
+        for (size_t i = 0; i < desc.RootParameters.size(); i++) {
+            const RootParameterDesc& parameter = desc.RootParameters[i];
+            const D3D12_SHADER_VISIBILITY visibility = GetShaderVisibility(parameter.Visibility);
+            if (parameter.Type == RootParameterType::Constants) {
+                parameters[i].InitAsConstants(parameter.ConstantCount, parameter.ShaderRegister, 0, visibility);
+            } else {
+                ranges[i].Init(D3D12_DESCRIPTOR_RANGE_TYPE_SRV, 1, parameter.ShaderRegister);
+                parameters[i].InitAsDescriptorTable(1, &ranges[i], visibility);
+            }
+        }
+
+        const CD3DX12_STATIC_SAMPLER_DESC linearClampSampler(0, D3D12_FILTER_MIN_MAG_MIP_LINEAR,
+                                                              D3D12_TEXTURE_ADDRESS_MODE_CLAMP,
+                                                              D3D12_TEXTURE_ADDRESS_MODE_CLAMP,
+                                                              D3D12_TEXTURE_ADDRESS_MODE_CLAMP);
+
+        CD3DX12_ROOT_SIGNATURE_DESC rootSignatureDesc;
+        rootSignatureDesc.Init(static_cast<UINT>(parameters.size()), parameters.data(),
+                               desc.LinearClampSampler ? 1 : 0, desc.LinearClampSampler ? &linearClampSampler : nullptr,
+                               desc.InputLayout.empty() ? D3D12_ROOT_SIGNATURE_FLAG_NONE
+                                                        : D3D12_ROOT_SIGNATURE_FLAG_ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT);
+
+        ComPtr<ID3DBlob> signature;
+        ComPtr<ID3DBlob> error;
+        ThrowIfFailed(D3D12SerializeRootSignature(&rootSignatureDesc, D3D_ROOT_SIGNATURE_VERSION_1, &signature, &error),
+                      "Failed to serialize root signature.");
+
+        std::string key(static_cast<const char*>(signature->GetBufferPointer()), signature->GetBufferSize());
+        auto& rootSignature = m_RootSignatures[std::move(key)];
+        if (!rootSignature) {
+            ThrowIfFailed(m_Device->CreateRootSignature(0, signature->GetBufferPointer(), signature->GetBufferSize(), IID_PPV_ARGS(&rootSignature)),
+                          "Failed to create root signature.");
+        }
+
+        return rootSignature;
+    }
+
+    D3D12_CPU_DESCRIPTOR_HANDLE D3D12RenderDevice::GetRenderTargetView(const ResourceHandle resource) const {
+        return CD3DX12_CPU_DESCRIPTOR_HANDLE(m_RtvHeap.Heap->GetCPUDescriptorHandleForHeapStart(),
+                                             static_cast<INT>(m_Resources[resource.Index].RtvIndex), m_RtvHeap.DescriptorSize);
+    }
+
+    D3D12_GPU_DESCRIPTOR_HANDLE D3D12RenderDevice::GetShaderResourceView(const ResourceHandle resource) const {
+        return CD3DX12_GPU_DESCRIPTOR_HANDLE(m_SrvHeap.Heap->GetGPUDescriptorHandleForHeapStart(),
+                                             static_cast<INT>(m_Resources[resource.Index].SrvIndex), m_SrvHeap.DescriptorSize);
+    }
+
+    uint64_t D3D12RenderDevice::GetAllocationSize(const D3D12_RESOURCE_DESC& desc) const {
+        // Committed resources take what the device reports for their description, 64KB at least for buffers.
+        return m_Device->GetResourceAllocationInfo(0, 1, &desc).SizeInBytes;
+    }
+
+    ResourceHandle D3D12RenderDevice::AddResource(ComPtr<ID3D12Resource> resource, const TextureUsage usage, const DXGI_FORMAT viewFormat) {
+        Resource entry;
+        entry.Resource = std::move(resource);
+
+        if (HasUsage(usage, TextureUsage::RenderTarget)) {
+            entry.RtvIndex = m_RtvHeap.Allocate();
+            const CD3DX12_CPU_DESCRIPTOR_HANDLE rtvHandle(m_RtvHeap.Heap->GetCPUDescriptorHandleForHeapStart(),
+                                                          static_cast<INT>(entry.RtvIndex), m_RtvHeap.DescriptorSize);
+            m_Device->CreateRenderTargetView(entry.Resource.Get(), nullptr, rtvHandle);
+        }
+
+        if (HasUsage(usage, TextureUsage::ShaderResource)) {
+            entry.SrvIndex = m_SrvHeap.Allocate();
+
+            D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
+            srvDesc.Format = viewFormat;
+            srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
+            srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
+            srvDesc.Texture2D.MipLevels = 1;
+
+            const CD3DX12_CPU_DESCRIPTOR_HANDLE srvHandle(m_SrvHeap.Heap->GetCPUDescriptorHandleForHeapStart(),
+                                                          static_cast<INT>(entry.SrvIndex), m_SrvHeap.DescriptorSize);
+            m_Device->CreateShaderResourceView(entry.Resource.Get(), &srvDesc, srvHandle);
+        }
+
+        uint32_t index;
+        if (!m_FreeResources.empty()) {
+            index = m_FreeResources.back();
+            m_FreeResources.pop_back();
+            m_Resources[index] = std::move(entry);
+        } else {
+            index = static_cast<uint32_t>(m_Resources.size());
+            m_Resources.push_back(std::move(entry));
+        }
+
+        return {index};
+    }
+}
@@ -0,0 +1,144 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/RHI/GpuMemoryStatistics.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+
+namespace D3D12Engine {
+    namespace {
+        void WriteUsage(std::ostream& stream, const GpuMemoryUsage& usage) {
+            stream << "{\"current\": " << usage.CurrentBytes
+                   << ", \"peak\": " << usage.PeakBytes
+                   << ", \"allocations\": " << usage.AllocationCount << "}";
+        }
+
+        void WriteBudget(std::ostream& stream, const GpuMemoryBudget& budget) {
+            stream << "{\"budget\": " << budget.Budget
+                   << ", \"currentUsage\": " << budget.CurrentUsage
+                   << ", \"availableForReservation\": " << budget.AvailableForReservation
+                   << ", \"currentReservation\": " << budget.CurrentReservation << "}";
+        }
+    }
+
+    std::optional<GpuMemoryReportSettings> GpuMemoryReportSettings::Parse(const std::span<const std::wstring_view> arguments) {
+        constexpr std::wstring_view reportOption = L"--memory-report=";
+
+        GpuMemoryReportSettings settings;
+        bool enabled = false;
+
+        for (const std::wstring_view argument : arguments) {
+            if (argument == L"--memory-report") {
+                enabled = true;
+            } else if (argument.starts_with(reportOption)) {
+                settings.Path = argument.substr(reportOption.size());
+                enabled = true;
+            }
+        }
+
+        if (!enabled) {
+            return std::nullopt;
+        }
+
+        if (settings.Path.empty()) {
+            throw std::invalid_argument("Missing GPU memory report path.");
+        }
+
+        return settings;
+    }
+
+    void GpuMemoryStatistics::RecordAllocation(const ResourceHandle resource, const GpuMemoryCategory category, const uint64_t size) {
+        if (resource.Index >= m_Allocations.size()) {
+            m_Allocations.resize(resource.Index + 1);
+        }
+
+        auto& allocation = m_Allocations[resource.Index];
+        if (allocation.Live) {
+            throw std::invalid_argument("Recording a resource that is already recorded.");
+        }
+
+        allocation = {size, category, true};
+        RecordAllocation(category, size);
+    }
+
+    void GpuMemoryStatistics::RecordRelease(const ResourceHandle resource) {
+        if (resource.Index >= m_Allocations.size() || !m_Allocations[resource.Index].Live) {
+            throw std::invalid_argument("Releasing a resource that wasn't recorded.");
+        }
+
+        auto& allocation = m_Allocations[resource.Index];
+        Remove(m_Categories[static_cast<size_t>(allocation.Category)], allocation.Size);
+        Remove(m_Total, allocation.Size);
+        allocation = Allocation{};
+    }
+
+    void GpuMemoryStatistics::RecordAllocation(const GpuMemoryCategory category, const uint64_t size) {
+        Add(m_Categories[static_cast<size_t>(category)], size);
+        Add(m_Total, size);
+    }
+
+    void GpuMemoryStatistics::BeginFrame() {
+        m_FrameTransientBytes = 0;
+        ++m_FrameCount;
+    }
+
+    void GpuMemoryStatistics::RecordTransient(const uint64_t size) {
+        m_FrameTransientBytes += size;
+        m_PeakFrameTransientBytes = std::max(m_PeakFrameTransientBytes, m_FrameTransientBytes);
+    }
+
+    void GpuMemoryStatistics::SetBudget(const GpuMemoryBudget& local, const GpuMemoryBudget& nonLocal) {
+        m_LocalBudget = local;
+        m_NonLocalBudget = nonLocal;
+    }
+
+    void GpuMemoryStatistics::WriteReport(std::ostream& stream) const {
+        stream << "{\n";
+        stream << "  \"frames\": " << m_FrameCount << ",\n";
+        stream << "  \"total\": ";
+        WriteUsage(stream, m_Total);
+        stream << ",\n  \"categories\": {\n";
+
+        for (size_t i = 0; i < m_Categories.size(); ++i) {
+            stream << "    \"" << GetCategoryName(static_cast<GpuMemoryCategory>(i)) << "\": ";
+            WriteUsage(stream, m_Categories[i]);
+            stream << (i + 1 < m_Categories.size() ? ",\n" : "\n");
+        }
+
+        stream << "  },\n";
+        stream << "  \"transient\": {\"frame\": " << m_FrameTransientBytes << ", \"peakFrame\": " << m_PeakFrameTransientBytes << "},\n";
+        stream << "  \"budget\": {\"local\": ";
+        WriteBudget(stream, m_LocalBudget);
+        stream << ", \"nonLocal\": ";
+        WriteBudget(stream, m_NonLocalBudget);
+        stream << "}\n";
+        stream << "}\n";
+    }
+
+    void GpuMemoryStatistics::WriteReport(const std::filesystem::path& path) const {
+        std::ofstream file(path);
+        if (!file) {
+            throw std::runtime_error("Failed to open the GPU memory report " + path.string() + ".");
+        }
+
+        WriteReport(file);
+
+        if (!file) {
+            throw std::runtime_error("Failed to write the GPU memory report " + path.string() + ".");
+        }
+    }
+
+    void GpuMemoryStatistics::Add(GpuMemoryUsage& usage, const uint64_t size) {
+        usage.CurrentBytes += size;
+        usage.PeakBytes = std::max(usage.PeakBytes, usage.CurrentBytes);
+        ++usage.AllocationCount;
+    }
+
+    void GpuMemoryStatistics::Remove(GpuMemoryUsage& usage, const uint64_t size) {
+        usage.CurrentBytes -= size;
+        --usage.AllocationCount;
+    }
+}
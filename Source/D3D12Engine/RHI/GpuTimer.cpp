@@ -0,0 +1,62 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/RHI/GpuTimer.hpp>
+
+#include <D3D12Engine/RHI/DxUtils.hpp>
+
+namespace D3D12Engine {
+    GpuTimer::GpuTimer(ID3D12Device* pDevice, ID3D12CommandQueue* pCommandQueue, const UINT scopeCount)
+        : m_Frequency(0),
+          m_ScopeCount(scopeCount),
+          m_ElapsedMs(scopeCount, 0.0) {
+        ThrowIfFailed(pCommandQueue->GetTimestampFrequency(&m_Frequency), "Failed to get timestamp frequency.");
+
+        D3D12_QUERY_HEAP_DESC queryHeapDesc = {};
+        queryHeapDesc.Type = D3D12_QUERY_HEAP_TYPE_TIMESTAMP;
+        queryHeapDesc.Count = scopeCount * 2;
+        ThrowIfFailed(pDevice->CreateQueryHeap(&queryHeapDesc, IID_PPV_ARGS(&m_QueryHeap)), "Failed to create timestamp query heap.");
+
+        const auto heapProperties = CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_READBACK);
+        const auto bufferDesc = CD3DX12_RESOURCE_DESC::Buffer(sizeof(UINT64) * scopeCount * 2);
+        ThrowIfFailed(pDevice->CreateCommittedResource(
+                &heapProperties,
+                D3D12_HEAP_FLAG_NONE,
+                &bufferDesc,
+                D3D12_RESOURCE_STATE_COPY_DEST,
+                nullptr,
+                IID_PPV_ARGS(&m_ReadbackBuffer)),
+            "Failed to create timestamp readback buffer."
+        );
+        ThrowIfFailed(m_ReadbackBuffer->SetName(L"GPU timer readback buffer"));
+    }
+
+    void GpuTimer::Begin(ID3D12GraphicsCommandList* pCommandList, const UINT scope) const {
+        pCommandList->EndQuery(m_QueryHeap.Get(), D3D12_QUERY_TYPE_TIMESTAMP, scope * 2);
+    }
+
+    void GpuTimer::End(ID3D12GraphicsCommandList* pCommandList, const UINT scope) const {
+        pCommandList->EndQuery(m_QueryHeap.Get(), D3D12_QUERY_TYPE_TIMESTAMP, scope * 2 + 1);
+    }
+
+    void GpuTimer::Resolve(ID3D12GraphicsCommandList* pCommandList) const {
+        pCommandList->ResolveQueryData(m_QueryHeap.Get(), D3D12_QUERY_TYPE_TIMESTAMP, 0, m_ScopeCount * 2, m_ReadbackBuffer.Get(), 0);
+    }
+
+    void GpuTimer::ReadBack() {
+        const CD3DX12_RANGE readRange(0, sizeof(UINT64) * m_ScopeCount * 2);
+        UINT64* pTimestamps;
+        ThrowIfFailed(m_ReadbackBuffer->Map(0, &readRange, reinterpret_cast<void**>(&pTimestamps)));
+
+        for (UINT scope = 0; scope < m_ScopeCount; scope++) {
+            const UINT64 begin = pTimestamps[scope * 2];
+            const UINT64 end = pTimestamps[scope * 2 + 1];
+            m_ElapsedMs[scope] = end > begin ? static_cast<double>(end - begin) * 1000.0 / static_cast<double>(m_Frequency) : 0.0;
+        }
+
+        // Nothing was written by the CPU.
+        const CD3DX12_RANGE writeRange(0, 0);
+        m_ReadbackBuffer->Unmap(0, &writeRange);
+    }
+}
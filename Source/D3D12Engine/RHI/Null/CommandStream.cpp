@@ -0,0 +1,14 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/RHI/Null/CommandStream.hpp>
+
+namespace D3D12Engine {
+    void CommandStream::Reset() {
+        // clear() keeps the capacity.
+        m_Data.clear();
+        m_CommandCounts.fill(0);
+        m_CommandCount = 0;
+    }
+}
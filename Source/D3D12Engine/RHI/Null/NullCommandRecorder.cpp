@@ -0,0 +1,65 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/RHI/Null/NullCommandRecorder.hpp>
+
+namespace D3D12Engine {
+    NullCommandRecorder::NullCommandRecorder(CommandStream& stream)
+        : m_Stream(stream) {
+    }
+
+    void NullCommandRecorder::ResourceBarrier(const std::span<const ResourceTransition> transitions) {
+        const RecordedCommands::ResourceBarrier payload{static_cast<uint32_t>(transitions.size())};
+        m_Stream.Write(RecordedCommand::ResourceBarrier, payload, std::as_bytes(transitions));
+    }
+
+    void NullCommandRecorder::SetPipeline(const PipelineHandle pipeline) {
+        m_Stream.Write(RecordedCommand::SetPipeline, RecordedCommands::SetPipeline{pipeline});
+    }
+
+    void NullCommandRecorder::SetViewport(const Viewport& viewport) {
+        m_Stream.Write(RecordedCommand::SetViewport, viewport);
+    }
+
+    void NullCommandRecorder::SetScissorRect(const ScissorRect& rect) {
+        m_Stream.Write(RecordedCommand::SetScissorRect, rect);
+    }
+
+    void NullCommandRecorder::SetRenderTarget(const ResourceHandle texture) {
+        m_Stream.Write(RecordedCommand::SetRenderTarget, RecordedCommands::SetRenderTarget{texture});
+    }
+
+    void NullCommandRecorder::ClearRenderTarget(const ResourceHandle texture, const std::array<float, 4>& color, const ScissorRect* pRect) {
+        RecordedCommands::ClearRenderTarget payload{texture, color, {}, pRect != nullptr};
+        if (pRect) {
+            payload.Rect = *pRect;
+        }
+
+        m_Stream.Write(RecordedCommand::ClearRenderTarget, payload);
+    }
+
+    void NullCommandRecorder::SetRootConstants(const uint32_t rootIndex, const std::span<const uint32_t> values, const uint32_t offset) {
+        const RecordedCommands::SetRootConstants payload{rootIndex, offset, static_cast<uint32_t>(values.size())};
+        m_Stream.Write(RecordedCommand::SetRootConstants, payload, std::as_bytes(values));
+    }
+
+    void NullCommandRecorder::SetShaderResource(const uint32_t rootIndex, const ResourceHandle texture) {
+        m_Stream.Write(RecordedCommand::SetShaderResource, RecordedCommands::SetShaderResource{rootIndex, texture});
+    }
+
+    void NullCommandRecorder::SetVertexBuffer(const VertexBufferView& view) {
+        m_Stream.Write(RecordedCommand::SetVertexBuffer, view);
+    }
+
+    void NullCommandRecorder::Draw(const uint32_t vertexCount, const uint32_t instanceCount, const uint32_t firstVertex, const uint32_t firstInstance) {
+        m_Stream.Write(RecordedCommand::Draw, RecordedCommands::Draw{vertexCount, instanceCount, firstVertex, firstInstance});
+    }
+
+    void NullCommandRecorder::ExecuteIndirect(const CommandSignatureHandle signature, const uint32_t maxCommandCount,
+                                              const ResourceHandle argumentBuffer, const uint64_t argumentOffset,
+                                              const ResourceHandle countBuffer, const uint64_t countOffset) {
+        const RecordedCommands::ExecuteIndirect payload{signature, maxCommandCount, argumentBuffer, countBuffer, argumentOffset, countOffset};
+        m_Stream.Write(RecordedCommand::ExecuteIndirect, payload);
+    }
+}
@@ -0,0 +1,129 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/RHI/Null/NullRenderDevice.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace D3D12Engine {
+    ResourceHandle NullRenderDevice::CreateBuffer(const BufferDesc& desc) {
+        const ResourceHandle handle = Allocate();
+        auto& resource = m_Resources[handle.Index];
+        resource.Buffer = desc;
+        resource.Buffer.Name = {};
+        resource.IsBuffer = true;
+
+        // Upload and readback buffers can't leave their initial state, there is nothing to track.
+        if (desc.Memory != MemoryType::Default) {
+            resource.Memory.resize(desc.Size);
+        } else {
+            m_ResourceStates.Register(handle, desc.InitialState);
+        }
+
+        m_MemoryStatistics.RecordAllocation(handle, GetMemoryCategory(desc), desc.Size);
+
+        return handle;
+    }
+
+    ResourceHandle NullRenderDevice::CreateTexture(const TextureDesc& desc) {
+        const ResourceHandle handle = Allocate();
+        m_Resources[handle.Index].Texture = desc;
+        m_Resources[handle.Index].Texture.Name = {};
+        m_ResourceStates.Register(handle, desc.InitialState);
+        m_MemoryStatistics.RecordAllocation(handle, GetMemoryCategory(desc.Usage), GetSurfaceByteSize(desc.Format, desc.Width, desc.Height));
+
+        return handle;
+    }
+
+    void NullRenderDevice::DestroyResource(const ResourceHandle resource) {
+        if (!IsAlive(resource)) {
+            throw std::runtime_error("Destroying a resource that doesn't exist.");
+        }
+
+        m_ResourceStates.Unregister(resource);
+        m_MemoryStatistics.RecordRelease(resource);
+        m_Resources[resource.Index] = Resource{};
+        m_FreeResources.push_back(resource.Index);
+        m_LiveResourceCount--;
+    }
+
+    uint8_t* NullRenderDevice::Map(const ResourceHandle buffer) {
+        if (!IsAlive(buffer) || m_Resources[buffer.Index].Memory.empty()) {
+            throw std::runtime_error("Only upload and readback buffers can be mapped.");
+        }
+
+        auto& resource = m_Resources[buffer.Index];
+        resource.Mapped = true;
+
+        return resource.Memory.data();
+    }
+
+    void NullRenderDevice::Unmap(const ResourceHandle buffer) {
+        if (!IsAlive(buffer) || !m_Resources[buffer.Index].Mapped) {
+            throw std::runtime_error("Unmapping a buffer that isn't mapped.");
+        }
+
+        m_Resources[buffer.Index].Mapped = false;
+    }
+
+    void NullRenderDevice::SetDebugName(ResourceHandle, std::string_view) {
+        // There is no debugging tool to show it to.
+    }
+
+    PipelineHandle NullRenderDevice::CreatePipeline(const PipelineDesc& desc) {
+        m_Pipelines.push_back({std::string(desc.Name), {desc.RootParameters.begin(), desc.RootParameters.end()}});
+
+        return {static_cast<uint32_t>(m_Pipelines.size() - 1)};
+    }
+
+    void NullRenderDevice::ReplacePipeline(const PipelineHandle pipeline, const PipelineDesc& desc) {
+        if (pipeline.Index >= m_Pipelines.size()) {
+            throw std::invalid_argument("Replacing a pipeline that doesn't exist.");
+        }
+
+        // Command signatures were created against the previous root parameters.
+        if (!std::ranges::equal(m_Pipelines[pipeline.Index].RootParameters, desc.RootParameters)) {
+            throw std::invalid_argument("Replaced pipelines must keep their root parameters.");
+        }
+
+        m_Pipelines[pipeline.Index].Name = desc.Name;
+    }
+
+    CommandSignatureHandle NullRenderDevice::CreateCommandSignature(const CommandSignatureDesc& desc) {
+        if (desc.RootConstantCount > 0) {
+            if (desc.Pipeline.Index >= m_Pipelines.size()) {
+                throw std::invalid_argument("Command signatures with root constants need a pipeline.");
+            }
+
+            // The constants have to fit the parameter they are written to, like D3D12 validates.
+            const auto& parameters = m_Pipelines[desc.Pipeline.Index].RootParameters;
+            if (desc.RootConstantsIndex >= parameters.size() ||
+                parameters[desc.RootConstantsIndex].Type != RootParameterType::Constants ||
+                parameters[desc.RootConstantsIndex].ConstantCount < desc.RootConstantCount) {
+                throw std::invalid_argument("Command signature root constants don't match the pipeline.");
+            }
+        }
+
+        m_CommandSignatures.push_back(desc);
+
+        return {static_cast<uint32_t>(m_CommandSignatures.size() - 1)};
+    }
+
+    ResourceHandle NullRenderDevice::Allocate() {
+        uint32_t index;
+        if (!m_FreeResources.empty()) {
+            index = m_FreeResources.back();
+            m_FreeResources.pop_back();
+        } else {
+            index = static_cast<uint32_t>(m_Resources.size());
+            m_Resources.emplace_back();
+        }
+
+        m_Resources[index].Alive = true;
+        m_LiveResourceCount++;
+
+        return {index};
+    }
+}
@@ -0,0 +1,41 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/RHI/ResourceStateRegistry.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace D3D12Engine {
+    void ResourceStateRegistry::Register(const ResourceHandle resource, const ResourceState state, const uint32_t subresourceCount) {
+        if (!resource.IsValid() || subresourceCount == 0) {
+            throw std::invalid_argument("Registering an invalid resource.");
+        }
+
+        if (IsRegistered(resource)) {
+            throw std::invalid_argument("Resource is already registered.");
+        }
+
+        if (resource.Index >= m_States.size()) {
+            m_States.resize(resource.Index + 1);
+        }
+
+        m_States[resource.Index].assign(subresourceCount, state);
+    }
+
+    void ResourceStateRegistry::Unregister(const ResourceHandle resource) {
+        if (IsRegistered(resource)) {
+            m_States[resource.Index].clear();
+        }
+    }
+
+    void ResourceStateRegistry::SetState(const ResourceHandle resource, const ResourceState state, const uint32_t subresource) {
+        auto& states = m_States[resource.Index];
+        if (subresource == ResourceTransition::AllSubresources) {
+            std::ranges::fill(states, state);
+        } else {
+            states[subresource] = state;
+        }
+    }
+}
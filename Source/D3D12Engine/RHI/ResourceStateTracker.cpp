@@ -0,0 +1,187 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/RHI/ResourceStateTracker.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace D3D12Engine {
+    ResourceStateTracker::ResourceStateTracker(ResourceStateRegistry& registry)
+        : m_Registry(registry) {
+    }
+
+    void ResourceStateTracker::Require(const ResourceHandle resource, const ResourceState state, const uint32_t subresource) {
+        // Resources that never change state aren't registered.
+        if (!m_Registry.IsRegistered(resource)) {
+            return;
+        }
+
+        TrackedResource& tracked = GetTracked(resource);
+        const std::span<ResourceState> states = std::span(m_States).subspan(tracked.FirstState, tracked.SubresourceCount);
+        if (subresource != ResourceTransition::AllSubresources) {
+            RequireSubresource(tracked, states[subresource], state, subresource);
+            return;
+        }
+
+        // A single transition covers the whole resource when its subresources agree.
+        if (std::ranges::all_of(states, [&](const ResourceState s) { return s == states.front(); })) {
+            ResourceState current = states.front();
+            RequireSubresource(tracked, current, state, ResourceTransition::AllSubresources);
+            std::ranges::fill(states, current);
+        } else {
+            for (uint32_t i = 0; i < states.size(); ++i) {
+                RequireSubresource(tracked, states[i], state, i);
+            }
+        }
+    }
+
+    void ResourceStateTracker::FlushBarriers(CommandRecorder& recorder) {
+        if (m_Pending.empty()) {
+            return;
+        }
+
+        recorder.ResourceBarrier(m_Pending);
+        m_BarrierCount += static_cast<uint32_t>(m_Pending.size());
+        m_BarrierBatchCount++;
+
+        for (const ResourceTransition& transition : m_Pending) {
+            m_Tracked[m_TrackedIndices[transition.Resource.Index]].LastPending = NotTracked;
+        }
+
+        m_Pending.clear();
+    }
+
+    void ResourceStateTracker::Resolve(std::pmr::vector<ResourceTransition>& transitions) {
+        if (!m_Pending.empty()) {
+            throw std::runtime_error("Resolving a command list with barriers that weren't flushed.");
+        }
+
+        for (const ResourceTransition& firstUse : m_FirstUses) {
+            if (!m_Registry.IsRegistered(firstUse.Resource)) {
+                continue;
+            }
+
+            const ResourceHandle resource = firstUse.Resource;
+            const uint32_t subresourceCount = m_Registry.GetSubresourceCount(resource);
+            if (firstUse.Subresource != ResourceTransition::AllSubresources) {
+                if (const ResourceState before = m_Registry.GetState(resource, firstUse.Subresource); before != firstUse.After) {
+                    transitions.push_back({resource, before, firstUse.After, firstUse.Subresource});
+                }
+                continue;
+            }
+
+            bool uniform = true;
+            for (uint32_t i = 1; i < subresourceCount && uniform; ++i) {
+                uniform = m_Registry.GetState(resource, i) == m_Registry.GetState(resource, 0);
+            }
+
+            if (uniform) {
+                if (const ResourceState before = m_Registry.GetState(resource, 0); before != firstUse.After) {
+                    transitions.push_back({resource, before, firstUse.After, ResourceTransition::AllSubresources});
+                }
+            } else {
+                for (uint32_t i = 0; i < subresourceCount; ++i) {
+                    if (const ResourceState before = m_Registry.GetState(resource, i); before != firstUse.After) {
+                        transitions.push_back({resource, before, firstUse.After, i});
+                    }
+                }
+            }
+        }
+
+        // Lists submitted after this one start from the states it leaves.
+        for (const TrackedResource& tracked : m_Tracked) {
+            if (m_Registry.GetSubresourceCount(tracked.Resource) != tracked.SubresourceCount) {
+                continue;
+            }
+
+            for (uint32_t i = 0; i < tracked.SubresourceCount; ++i) {
+                if (const ResourceState state = m_States[tracked.FirstState + i]; state != UnknownState) {
+                    m_Registry.SetState(tracked.Resource, state, i);
+                }
+            }
+        }
+    }
+
+    void ResourceStateTracker::Reset() {
+        for (const TrackedResource& tracked : m_Tracked) {
+            m_TrackedIndices[tracked.Resource.Index] = NotTracked;
+        }
+
+        m_Tracked.clear();
+        m_States.clear();
+        m_Pending.clear();
+        m_FirstUses.clear();
+        m_BarrierCount = 0;
+        m_BarrierBatchCount = 0;
+    }
+
+    ResourceStateTracker::TrackedResource& ResourceStateTracker::GetTracked(const ResourceHandle resource) {
+        if (resource.Index >= m_TrackedIndices.size()) {
+            m_TrackedIndices.resize(resource.Index + 1, NotTracked);
+        }
+
+        uint32_t& index = m_TrackedIndices[resource.Index];
+        if (index == NotTracked) {
+            index = static_cast<uint32_t>(m_Tracked.size());
+
+            const uint32_t subresourceCount = m_Registry.GetSubresourceCount(resource);
+            m_Tracked.push_back({resource, static_cast<uint32_t>(m_States.size()), subresourceCount, NotTracked});
+            m_States.insert(m_States.end(), subresourceCount, UnknownState);
+        }
+
+        return m_Tracked[index];
+    }
+
+    void ResourceStateTracker::RequireSubresource(TrackedResource& tracked, ResourceState& current, ResourceState state, const uint32_t subresource) {
+        if (current == UnknownState) {
+            m_FirstUses.push_back({tracked.Resource, UnknownState, state, subresource});
+            current = state;
+            return;
+        }
+
+        if (current == state) {
+            return;
+        }
+
+        if (IsReadOnlyState(current) && IsReadOnlyState(state)) {
+            if ((current & state) == state) {
+                return;
+            }
+
+            // Keep the states already there so the next read of either kind needs no barrier.
+            state = current | state;
+        }
+
+        AddBarrier(tracked, current, state, subresource);
+        current = state;
+    }
+
+    void ResourceStateTracker::AddBarrier(TrackedResource& tracked, const ResourceState before, const ResourceState after, const uint32_t subresource) {
+        // Merged into the last transition queued for the resource, unless that one is for another
+        // part of the resource: then the order matters and both are kept.
+        if (tracked.LastPending != NotTracked && m_Pending[tracked.LastPending].Subresource == subresource) {
+            ResourceTransition& pending = m_Pending[tracked.LastPending];
+            pending.After = after;
+            if (pending.After != pending.Before) {
+                return;
+            }
+
+            // Back where it started, the transition goes and the ones after it move down a slot.
+            for (uint32_t i = tracked.LastPending + 1; i < m_Pending.size(); ++i) {
+                uint32_t& lastPending = m_Tracked[m_TrackedIndices[m_Pending[i].Resource.Index]].LastPending;
+                if (lastPending == i) {
+                    lastPending--;
+                }
+            }
+
+            m_Pending.erase(m_Pending.begin() + tracked.LastPending);
+            tracked.LastPending = NotTracked;
+            return;
+        }
+
+        tracked.LastPending = static_cast<uint32_t>(m_Pending.size());
+        m_Pending.push_back({tracked.Resource, before, after, subresource});
+    }
+}
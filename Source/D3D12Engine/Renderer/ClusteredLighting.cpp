@@ -0,0 +1,257 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/Renderer/ClusteredLighting.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <stdexcept>
+
+#if defined(__SSE__) || defined(_M_X64) || defined(_M_AMD64)
+#define DE_LIGHTBINNER_SSE
+#include <xmmintrin.h>
+#endif
+
+namespace D3D12Engine {
+    LightBinner::LightBinner(const ClusterGridSettings& settings)
+        : m_Settings(settings), m_Constants{}, m_ClusterCount(settings.TileCountX * settings.TileCountY * settings.SliceCount) {
+        if (m_ClusterCount == 0 || settings.MaxLightsPerCluster == 0) {
+            throw std::invalid_argument("Cluster grids need at least one cluster and one light per cluster.");
+        }
+
+        m_Constants.TileCountX = settings.TileCountX;
+        m_Constants.TileCountY = settings.TileCountY;
+        m_Constants.SliceCount = settings.SliceCount;
+
+        m_SliceDepths.resize(settings.SliceCount + 1);
+        for (auto* pBounds : {&m_MinX, &m_MinY, &m_MinZ, &m_MaxX, &m_MaxY, &m_MaxZ}) {
+            pBounds->resize(m_ClusterCount + 3);
+        }
+
+        m_Slots.resize(static_cast<size_t>(m_ClusterCount) * settings.MaxLightsPerCluster);
+        m_SlotCounts.resize(m_ClusterCount);
+        m_SliceOverflow.resize(settings.SliceCount);
+        m_Cells.resize(m_ClusterCount);
+
+        SetProjection(1.0f, 16.0f / 9.0f, 0.1f, 100.0f);
+    }
+
+    void LightBinner::SetProjection(const float verticalFov, const float aspectRatio, const float nearZ, const float farZ) {
+        if (nearZ <= 0.0f || farZ <= nearZ) {
+            throw std::invalid_argument("Clusters need 0 < near < far.");
+        }
+
+        const uint32_t tileCountX = m_Settings.TileCountX;
+        const uint32_t tileCountY = m_Settings.TileCountY;
+        const uint32_t sliceCount = m_Settings.SliceCount;
+        const float logDepthRange = std::log(farZ / nearZ);
+
+        m_Constants.TanHalfFovY = std::tan(verticalFov * 0.5f);
+        m_Constants.TanHalfFovX = m_Constants.TanHalfFovY * aspectRatio;
+        m_Constants.DepthSliceScale = static_cast<float>(sliceCount) / logDepthRange;
+        m_Constants.DepthSliceBias = -static_cast<float>(sliceCount) * std::log(nearZ) / logDepthRange;
+
+        for (uint32_t slice = 0; slice <= sliceCount; ++slice) {
+            m_SliceDepths[slice] = nearZ * std::pow(farZ / nearZ, static_cast<float>(slice) / static_cast<float>(sliceCount));
+        }
+        m_SliceDepths[sliceCount] = farZ;
+
+        // Each cluster is the part of a tile's frustum between two slices, bounded by a box.
+        const float tileWidth = 2.0f / static_cast<float>(tileCountX);
+        const float tileHeight = 2.0f / static_cast<float>(tileCountY);
+        uint32_t cluster = 0;
+        for (uint32_t slice = 0; slice < sliceCount; ++slice) {
+            const float nearDepth = m_SliceDepths[slice];
+            const float farDepth = m_SliceDepths[slice + 1];
+
+            for (uint32_t tileY = 0; tileY < tileCountY; ++tileY) {
+                // Tile rows go down the screen.
+                const float ndcTop = 1.0f - static_cast<float>(tileY) * tileHeight;
+                const float ndcBottom = ndcTop - tileHeight;
+
+                for (uint32_t tileX = 0; tileX < tileCountX; ++tileX, ++cluster) {
+                    const float ndcLeft = -1.0f + static_cast<float>(tileX) * tileWidth;
+                    const float ndcRight = ndcLeft + tileWidth;
+
+                    const float xScale = m_Constants.TanHalfFovX;
+                    const float yScale = m_Constants.TanHalfFovY;
+                    m_MinX[cluster] = std::min(ndcLeft * xScale * nearDepth, ndcLeft * xScale * farDepth);
+                    m_MaxX[cluster] = std::max(ndcRight * xScale * nearDepth, ndcRight * xScale * farDepth);
+                    m_MinY[cluster] = std::min(ndcBottom * yScale * nearDepth, ndcBottom * yScale * farDepth);
+                    m_MaxY[cluster] = std::max(ndcTop * yScale * nearDepth, ndcTop * yScale * farDepth);
+                    m_MinZ[cluster] = nearDepth;
+                    m_MaxZ[cluster] = farDepth;
+                }
+            }
+        }
+    }
+
+    void LightBinner::Bin(const std::span<const PointLight> lights, JobSystem* pJobSystem) {
+        const uint32_t sliceCount = m_Settings.SliceCount;
+        const uint32_t clustersPerSlice = m_Settings.TileCountX * m_Settings.TileCountY;
+
+        // Slices own their clusters, they are binned independently.
+        const auto binSlices = [&](const uint32_t begin, const uint32_t end) {
+            for (uint32_t slice = begin; slice < end; ++slice) {
+                BinSlice(lights, slice);
+            }
+        };
+
+        if (pJobSystem) {
+            pJobSystem->ParallelFor(sliceCount, 1, binSlices);
+        } else {
+            binSlices(0, sliceCount);
+        }
+
+        uint32_t offset = 0;
+        m_OverflowCount = 0;
+        for (uint32_t cluster = 0; cluster < m_ClusterCount; ++cluster) {
+            m_Cells[cluster] = {offset, m_SlotCounts[cluster]};
+            offset += m_SlotCounts[cluster];
+        }
+
+        for (const uint32_t overflow : m_SliceOverflow) {
+            m_OverflowCount += overflow;
+        }
+
+        m_LightIndices.resize(offset);
+        const auto compactSlices = [&](const uint32_t begin, const uint32_t end) {
+            for (uint32_t cluster = begin * clustersPerSlice; cluster < end * clustersPerSlice; ++cluster) {
+                const auto first = m_Slots.begin() + static_cast<ptrdiff_t>(cluster) * m_Settings.MaxLightsPerCluster;
+                std::copy_n(first, m_Cells[cluster].Count, m_LightIndices.begin() + m_Cells[cluster].Offset);
+            }
+        };
+
+        if (pJobSystem) {
+            pJobSystem->ParallelFor(sliceCount, 1, compactSlices);
+        } else {
+            compactSlices(0, sliceCount);
+        }
+
+        m_Constants.LightCount = static_cast<uint32_t>(lights.size());
+    }
+
+    uint32_t LightBinner::GetClusterIndex(const std::array<float, 3>& viewPosition) const {
+        const float depth = std::max(viewPosition[2], m_SliceDepths.front());
+        const float sliceValue = std::floor(std::log(depth) * m_Constants.DepthSliceScale + m_Constants.DepthSliceBias);
+        const auto slice = static_cast<uint32_t>(std::clamp(sliceValue, 0.0f, static_cast<float>(m_Settings.SliceCount - 1)));
+
+        const uint32_t tileX = GetTileX(viewPosition[0] / (depth * m_Constants.TanHalfFovX));
+        const uint32_t tileY = GetTileY(viewPosition[1] / (depth * m_Constants.TanHalfFovY));
+
+        return (slice * m_Settings.TileCountY + tileY) * m_Settings.TileCountX + tileX;
+    }
+
+    void LightBinner::BinSlice(const std::span<const PointLight> lights, const uint32_t slice) {
+        const uint32_t tileCountX = m_Settings.TileCountX;
+        const uint32_t firstCluster = slice * tileCountX * m_Settings.TileCountY;
+        const float nearDepth = m_SliceDepths[slice];
+        const float farDepth = m_SliceDepths[slice + 1];
+
+        std::fill_n(m_SlotCounts.begin() + firstCluster, tileCountX * m_Settings.TileCountY, 0u);
+        uint32_t overflow = 0;
+
+        for (uint32_t lightIndex = 0; lightIndex < lights.size(); ++lightIndex) {
+            const PointLight& light = lights[lightIndex];
+
+            // Depth range of the light's box within the slice.
+            const float minDepth = std::max(light.Position[2] - light.Radius, nearDepth);
+            const float maxDepth = std::min(light.Position[2] + light.Radius, farDepth);
+            if (minDepth > maxDepth) {
+                continue;
+            }
+
+            // Screen bounds of the box over that range. x / z is extreme at a corner, and the
+            // depths are positive so the near and far ends are enough.
+            const float minXNear = (light.Position[0] - light.Radius) / (minDepth * m_Constants.TanHalfFovX);
+            const float minXFar = (light.Position[0] - light.Radius) / (maxDepth * m_Constants.TanHalfFovX);
+            const float maxXNear = (light.Position[0] + light.Radius) / (minDepth * m_Constants.TanHalfFovX);
+            const float maxXFar = (light.Position[0] + light.Radius) / (maxDepth * m_Constants.TanHalfFovX);
+            const float minYNear = (light.Position[1] - light.Radius) / (minDepth * m_Constants.TanHalfFovY);
+            const float minYFar = (light.Position[1] - light.Radius) / (maxDepth * m_Constants.TanHalfFovY);
+            const float maxYNear = (light.Position[1] + light.Radius) / (minDepth * m_Constants.TanHalfFovY);
+            const float maxYFar = (light.Position[1] + light.Radius) / (maxDepth * m_Constants.TanHalfFovY);
+
+            const float minNdcX = std::min(minXNear, minXFar);
+            const float maxNdcX = std::max(maxXNear, maxXFar);
+            const float minNdcY = std::min(minYNear, minYFar);
+            const float maxNdcY = std::max(maxYNear, maxYFar);
+            if (maxNdcX < -1.0f || minNdcX > 1.0f || maxNdcY < -1.0f || minNdcY > 1.0f) {
+                continue;
+            }
+
+            const uint32_t firstTileX = GetTileX(minNdcX);
+            const uint32_t tileCount = GetTileX(maxNdcX) - firstTileX + 1;
+            const uint32_t lastTileY = GetTileY(minNdcY);
+            for (uint32_t tileY = GetTileY(maxNdcY); tileY <= lastTileY; ++tileY) {
+                BinRow(firstCluster + tileY * tileCountX + firstTileX, tileCount, light, lightIndex, overflow);
+            }
+        }
+
+        m_SliceOverflow[slice] = overflow;
+    }
+
+    void LightBinner::BinRow(const uint32_t firstCluster, const uint32_t tileCount, const PointLight& light, const uint32_t lightIndex, uint32_t& overflow) {
+        const uint32_t maxLights = m_Settings.MaxLightsPerCluster;
+        const auto addLight = [&](const uint32_t cluster) {
+            uint32_t& count = m_SlotCounts[cluster];
+            if (count < maxLights) {
+                m_Slots[static_cast<size_t>(cluster) * maxLights + count++] = lightIndex;
+            } else {
+                overflow++;
+            }
+        };
+
+#ifdef DE_LIGHTBINNER_SSE
+        // Squared distance from the light to each box, summed over the axes on which the
+        // light is outside the box.
+        const __m128 centerX = _mm_set1_ps(light.Position[0]);
+        const __m128 centerY = _mm_set1_ps(light.Position[1]);
+        const __m128 centerZ = _mm_set1_ps(light.Position[2]);
+        const __m128 radiusSquared = _mm_set1_ps(light.Radius * light.Radius);
+        const __m128 zero = _mm_setzero_ps();
+
+        for (uint32_t tile = 0; tile < tileCount; tile += 4) {
+            const uint32_t cluster = firstCluster + tile;
+            const __m128 dx = _mm_add_ps(_mm_max_ps(_mm_sub_ps(_mm_loadu_ps(&m_MinX[cluster]), centerX), zero),
+                                         _mm_max_ps(_mm_sub_ps(centerX, _mm_loadu_ps(&m_MaxX[cluster])), zero));
+            const __m128 dy = _mm_add_ps(_mm_max_ps(_mm_sub_ps(_mm_loadu_ps(&m_MinY[cluster]), centerY), zero),
+                                         _mm_max_ps(_mm_sub_ps(centerY, _mm_loadu_ps(&m_MaxY[cluster])), zero));
+            const __m128 dz = _mm_add_ps(_mm_max_ps(_mm_sub_ps(_mm_loadu_ps(&m_MinZ[cluster]), centerZ), zero),
+                                         _mm_max_ps(_mm_sub_ps(centerZ, _mm_loadu_ps(&m_MaxZ[cluster])), zero));
+            const __m128 distanceSquared = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+
+            auto mask = static_cast<uint32_t>(_mm_movemask_ps(_mm_cmple_ps(distanceSquared, radiusSquared)));
+            // The last group may run past the row.
+            if (const uint32_t remaining = tileCount - tile; remaining < 4) {
+                mask &= (1u << remaining) - 1;
+            }
+
+            for (; mask != 0; mask &= mask - 1) {
+                addLight(cluster + static_cast<uint32_t>(std::countr_zero(mask)));
+            }
+        }
+#else
+        for (uint32_t cluster = firstCluster; cluster < firstCluster + tileCount; ++cluster) {
+            const float dx = std::max(m_MinX[cluster] - light.Position[0], 0.0f) + std::max(light.Position[0] - m_MaxX[cluster], 0.0f);
+            const float dy = std::max(m_MinY[cluster] - light.Position[1], 0.0f) + std::max(light.Position[1] - m_MaxY[cluster], 0.0f);
+            const float dz = std::max(m_MinZ[cluster] - light.Position[2], 0.0f) + std::max(light.Position[2] - m_MaxZ[cluster], 0.0f);
+            if (dx * dx + dy * dy + dz * dz <= light.Radius * light.Radius) {
+                addLight(cluster);
+            }
+        }
+#endif
+    }
+
+    uint32_t LightBinner::GetTileX(const float ndcX) const {
+        const float tile = std::floor((ndcX * 0.5f + 0.5f) * static_cast<float>(m_Settings.TileCountX));
+        return static_cast<uint32_t>(std::clamp(tile, 0.0f, static_cast<float>(m_Settings.TileCountX - 1)));
+    }
+
+    uint32_t LightBinner::GetTileY(const float ndcY) const {
+        const float tile = std::floor((0.5f - ndcY * 0.5f) * static_cast<float>(m_Settings.TileCountY));
+        return static_cast<uint32_t>(std::clamp(tile, 0.0f, static_cast<float>(m_Settings.TileCountY - 1)));
+    }
+}
@@ -0,0 +1,43 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/Renderer/IndirectDrawBuilder.hpp>
+
+#include <cstring>
+#include <stdexcept>
+
+namespace D3D12Engine {
+    IndirectDrawBuilder::IndirectDrawBuilder(const uint32_t maxCommandCount)
+        : m_MaxCommandCount(maxCommandCount) {
+        m_Commands.reserve(maxCommandCount);
+    }
+
+    void IndirectDrawBuilder::Reset() {
+        m_Commands.clear();
+    }
+
+    bool IndirectDrawBuilder::Add(const VertexAttributeTransform& positionTransform, const IndirectDrawArguments& arguments) {
+        if (m_Commands.size() == m_MaxCommandCount) {
+            return false;
+        }
+
+        m_Commands.push_back({positionTransform, arguments});
+
+        return true;
+    }
+
+    void IndirectDrawBuilder::Write(const std::span<uint8_t> destination) const {
+        if (destination.size() < GetBufferSize()) {
+            throw std::invalid_argument("Indirect argument buffer is too small.");
+        }
+
+        // The destination is usually write combined upload memory: write it sequentially
+        // and never read it back. Slots past the count are left as they are, the GPU
+        // doesn't read them.
+        std::memcpy(destination.data(), m_Commands.data(), m_Commands.size() * CommandStride);
+
+        const uint32_t count = GetCommandCount();
+        std::memcpy(destination.data() + GetCountOffset(), &count, sizeof(count));
+    }
+}
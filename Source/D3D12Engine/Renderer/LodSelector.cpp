@@ -0,0 +1,70 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/Renderer/LodSelector.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace D3D12Engine {
+    LodSelector::LodSelector(const LodSelectorSettings& settings)
+        : m_Settings(settings) {
+    }
+
+    void LodSelector::SetView(const std::array<float, 3>& cameraPosition, const float verticalFov, const float viewportHeight) {
+        m_CameraPosition = cameraPosition;
+        m_ProjectionScale = viewportHeight / (2.0f * std::tan(verticalFov * 0.5f));
+    }
+
+    uint32_t LodSelector::Select(const std::span<const MeshLod> lods, const LodInstance& instance, const uint32_t currentLod) const {
+        if (lods.empty()) {
+            return 0;
+        }
+
+        const float pixelsPerError = GetPixelsPerError(instance);
+        const auto lodCount = static_cast<uint32_t>(lods.size());
+        const uint32_t lod = std::min(currentLod, lodCount - 1);
+
+        // Too coarse: refine to the coarsest LOD within the limit.
+        if (lods[lod].Error * pixelsPerError > m_Settings.MaxPixelError * (1.0f + m_Settings.Hysteresis)) {
+            uint32_t refined = lod;
+            while (refined > 0 && lods[refined].Error * pixelsPerError > m_Settings.MaxPixelError) {
+                refined--;
+            }
+
+            return refined;
+        }
+
+        // Coarser LODs are only taken once they are comfortably within the limit.
+        const float coarsenLimit = m_Settings.MaxPixelError * (1.0f - m_Settings.Hysteresis);
+        uint32_t coarsened = lod;
+        while (coarsened + 1 < lodCount && lods[coarsened + 1].Error * pixelsPerError <= coarsenLimit) {
+            coarsened++;
+        }
+
+        return coarsened;
+    }
+
+    void LodSelector::Select(const std::span<const MeshLod> lods, const std::span<const LodInstance> instances, const std::span<uint8_t> currentLods) const {
+        if (currentLods.size() != instances.size()) {
+            throw std::invalid_argument("LOD selection needs one current LOD per instance.");
+        }
+
+        for (size_t i = 0; i < instances.size(); ++i) {
+            currentLods[i] = static_cast<uint8_t>(Select(lods, instances[i], currentLods[i]));
+        }
+    }
+
+    float LodSelector::GetPixelsPerError(const LodInstance& instance) const {
+        const float dx = instance.Center[0] - m_CameraPosition[0];
+        const float dy = instance.Center[1] - m_CameraPosition[1];
+        const float dz = instance.Center[2] - m_CameraPosition[2];
+
+        // Distance to the closest point of the bounds, clamped so objects around the camera get LOD 0.
+        const float distance = std::max(std::sqrt(dx * dx + dy * dy + dz * dz) - instance.Radius, 1e-4f);
+
+        return instance.Radius * m_ProjectionScale / distance;
+    }
+}
@@ -0,0 +1,81 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/Renderer/SceneRenderer.hpp>
+
+namespace D3D12Engine {
+    void SceneRenderer::RecordFrame(CommandRecorder& recorder, ResourceStateTracker& states, const SceneFrame& frame) {
+        const float sceneWidth = static_cast<float>(frame.SceneSize.Width);
+        const float sceneHeight = static_cast<float>(frame.SceneSize.Height);
+        const ScissorRect sceneRect{0, 0, static_cast<int32_t>(frame.SceneSize.Width), static_cast<int32_t>(frame.SceneSize.Height)};
+
+        // Render the scene into the part of the scene color target chosen by the resolution controller.
+        states.Require(frame.SceneColor, ResourceState::RenderTarget);
+        states.FlushBarriers(recorder);
+
+        recorder.SetViewport({0.0f, 0.0f, sceneWidth, sceneHeight});
+        recorder.SetScissorRect(sceneRect);
+        recorder.SetRenderTarget(frame.SceneColor);
+        recorder.ClearRenderTarget(frame.SceneColor, ClearColor, &sceneRect);
+
+        if (frame.ScenePipeline.IsValid()) {
+            recorder.SetPipeline(frame.ScenePipeline);
+
+            for (const SceneDraw& draw : frame.Draws) {
+                states.Require(draw.VertexBuffer.Buffer, ResourceState::VertexAndConstantBuffer);
+                states.FlushBarriers(recorder);
+
+                recorder.SetRootConstants(PositionTransformRootIndex, std::span<const float>(draw.PositionTransform.Scale), 0);
+                recorder.SetRootConstants(PositionTransformRootIndex, std::span<const float>(draw.PositionTransform.Offset), 4);
+                recorder.SetVertexBuffer(draw.VertexBuffer);
+                recorder.Draw(draw.VertexCount);
+            }
+
+            if (const SceneIndirectDraws* pIndirect = frame.pIndirectDraws; pIndirect && pIndirect->Signature.IsValid()) {
+                states.Require(pIndirect->VertexBuffer.Buffer, ResourceState::VertexAndConstantBuffer);
+                states.Require(pIndirect->ArgumentBuffer, ResourceState::IndirectArgument);
+                states.Require(pIndirect->CountBuffer, ResourceState::IndirectArgument);
+                states.FlushBarriers(recorder);
+
+                recorder.SetVertexBuffer(pIndirect->VertexBuffer);
+                recorder.ExecuteIndirect(pIndirect->Signature, pIndirect->MaxCommandCount,
+                                         pIndirect->ArgumentBuffer, pIndirect->ArgumentOffset,
+                                         pIndirect->CountBuffer, pIndirect->CountOffset);
+            }
+        }
+
+        // The scene will be sampled and the back buffer used as a render target, both
+        // transitions go in the same barrier call.
+        states.Require(frame.SceneColor, ResourceState::PixelShaderResource);
+        states.Require(frame.BackBuffer, ResourceState::RenderTarget);
+        states.FlushBarriers(recorder);
+
+        recorder.SetViewport({0.0f, 0.0f, static_cast<float>(frame.OutputSize.Width), static_cast<float>(frame.OutputSize.Height)});
+        recorder.SetScissorRect({0, 0, static_cast<int32_t>(frame.OutputSize.Width), static_cast<int32_t>(frame.OutputSize.Height)});
+        recorder.SetRenderTarget(frame.BackBuffer);
+
+        // Upscale the scene to the back buffer.
+        if (frame.UpscalePipeline.IsValid()) {
+            const float targetWidth = static_cast<float>(frame.SceneTargetSize.Width);
+            const float targetHeight = static_cast<float>(frame.SceneTargetSize.Height);
+            const float upscaleConstants[] = {
+                sceneWidth / targetWidth,
+                sceneHeight / targetHeight,
+                (sceneWidth - 0.5f) / targetWidth,
+                (sceneHeight - 0.5f) / targetHeight
+            };
+
+            recorder.SetPipeline(frame.UpscalePipeline);
+            recorder.SetShaderResource(SceneColorRootIndex, frame.SceneColor);
+            recorder.SetRootConstants(UpscaleConstantsRootIndex, std::span<const float>(upscaleConstants));
+            recorder.Draw(3);
+        } else {
+            recorder.ClearRenderTarget(frame.BackBuffer, ClearColor);
+        }
+
+        // The back buffer will now be used to present.
+        states.Require(frame.BackBuffer, ResourceState::Present);
+        states.FlushBarriers(recorder);
+    }
+}
@@ -0,0 +1,97 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/Scene/Archetype.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <stdexcept>
+
+namespace D3D12Engine {
+    Archetype::Archetype(const ComponentMask mask)
+        : m_Mask(mask),
+          m_ChunkCapacity(0),
+          m_RowCount(0) {
+        std::ranges::fill(m_ComponentOffsets, NoOffset);
+
+        uint32_t rowSize = sizeof(Entity);
+        for (ComponentMask bits = mask; bits != 0; bits &= bits - 1) {
+            const auto component = static_cast<ComponentId>(std::countr_zero(bits));
+            m_ComponentIds.push_back(component);
+            m_ComponentSizes.push_back(ComponentTypes::GetInfo(component).Size);
+            rowSize += m_ComponentSizes.back();
+        }
+
+        // Lay the arrays out for the most rows that fit once aligned.
+        for (uint32_t capacity = static_cast<uint32_t>(ChunkSize / rowSize); capacity > 0; --capacity) {
+            size_t offset = sizeof(Entity) * capacity;
+            for (size_t i = 0; i < m_ComponentIds.size(); ++i) {
+                const size_t alignment = ComponentTypes::GetInfo(m_ComponentIds[i]).Alignment;
+                offset = (offset + alignment - 1) / alignment * alignment;
+                m_ComponentOffsets[m_ComponentIds[i]] = static_cast<uint32_t>(offset);
+                offset += static_cast<size_t>(m_ComponentSizes[i]) * capacity;
+            }
+
+            if (offset <= ChunkSize) {
+                m_ChunkCapacity = capacity;
+                break;
+            }
+        }
+
+        if (m_ChunkCapacity == 0) {
+            throw std::invalid_argument("Archetype components don't fit in a chunk.");
+        }
+    }
+
+    uint32_t Archetype::AddRow(const Entity entity) {
+        const uint32_t row = m_RowCount;
+        const uint32_t chunk = row / m_ChunkCapacity;
+        const uint32_t chunkRow = row % m_ChunkCapacity;
+
+        if (chunk == m_Chunks.size()) {
+            m_Chunks.push_back(std::make_unique<Chunk>());
+        }
+
+        m_RowCount++;
+
+        std::byte* pData = m_Chunks[chunk]->Data;
+        reinterpret_cast<Entity*>(pData)[chunkRow] = entity;
+        for (size_t i = 0; i < m_ComponentIds.size(); ++i) {
+            std::memset(pData + m_ComponentOffsets[m_ComponentIds[i]] + static_cast<size_t>(chunkRow) * m_ComponentSizes[i], 0, m_ComponentSizes[i]);
+        }
+
+        return row;
+    }
+
+    Entity Archetype::RemoveRow(const uint32_t row) {
+        const uint32_t last = m_RowCount - 1;
+        Entity moved;
+
+        if (row != last) {
+            std::byte* pDestination = m_Chunks[row / m_ChunkCapacity]->Data;
+            const std::byte* pSource = m_Chunks[last / m_ChunkCapacity]->Data;
+            const uint32_t destinationRow = row % m_ChunkCapacity;
+            const uint32_t sourceRow = last % m_ChunkCapacity;
+
+            moved = reinterpret_cast<const Entity*>(pSource)[sourceRow];
+            reinterpret_cast<Entity*>(pDestination)[destinationRow] = moved;
+            for (size_t i = 0; i < m_ComponentIds.size(); ++i) {
+                const uint32_t offset = m_ComponentOffsets[m_ComponentIds[i]];
+                const uint32_t size = m_ComponentSizes[i];
+                std::memcpy(pDestination + offset + static_cast<size_t>(destinationRow) * size,
+                            pSource + offset + static_cast<size_t>(sourceRow) * size, size);
+            }
+        }
+
+        m_RowCount--;
+
+        // Keep one empty chunk around so an entity going back and forth doesn't allocate.
+        if (m_Chunks.size() > GetChunkCount() + 1) {
+            m_Chunks.pop_back();
+        }
+
+        return moved;
+    }
+}
@@ -0,0 +1,31 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/Scene/Entity.hpp>
+
+#include <mutex>
+#include <stdexcept>
+
+namespace D3D12Engine {
+    namespace {
+        std::mutex g_ComponentMutex;
+        ComponentInfo g_ComponentInfos[MaxComponentTypes];
+        uint32_t g_ComponentCount = 0;
+    }
+
+    ComponentInfo ComponentTypes::GetInfo(const ComponentId id) {
+        // Written once before the id is handed out, never modified afterwards.
+        return g_ComponentInfos[id];
+    }
+
+    ComponentId ComponentTypes::Register(const uint32_t size, const uint32_t alignment) {
+        std::lock_guard lock(g_ComponentMutex);
+        if (g_ComponentCount == MaxComponentTypes) {
+            throw std::runtime_error("Too many component types.");
+        }
+
+        g_ComponentInfos[g_ComponentCount] = {size, alignment};
+        return g_ComponentCount++;
+    }
+}
@@ -0,0 +1,106 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/Scene/EntityCommandBuffer.hpp>
+
+#include <D3D12Engine/Scene/EntityRegistry.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <stdexcept>
+
+namespace D3D12Engine {
+    namespace {
+        // Each recording gets its own placeholders, so stale and foreign ones can be told apart.
+        uint32_t GetNextPlaceholderGeneration() {
+            static std::atomic<uint32_t> s_NextRecording = 0;
+            const uint32_t recording = s_NextRecording.fetch_add(1, std::memory_order_relaxed);
+
+            return Entity::PlaceholderGeneration | (recording % Entity::PlaceholderGeneration);
+        }
+    }
+
+    EntityCommandBuffer::EntityCommandBuffer()
+        : m_PlaceholderGeneration(GetNextPlaceholderGeneration()) {
+    }
+
+    void EntityCommandBuffer::Destroy(const Entity entity) {
+        Record(CommandType::Destroy, entity, 0, {});
+    }
+
+    void EntityCommandBuffer::Playback(EntityRegistry& registry) {
+        std::lock_guard lock(m_Mutex);
+
+        // Entities created so far, by placeholder index.
+        std::vector<Entity> created;
+        created.reserve(m_CreateCount);
+
+        for (const Command& command : m_Commands) {
+            const Entity target = command.Target.IsPlaceholder() ? created[command.Target.Index] : command.Target;
+            if (command.Type != CommandType::Create && !registry.IsAlive(target)) {
+                continue;
+            }
+
+            const std::byte* pData = m_Data.data() + command.DataOffset;
+            switch (command.Type) {
+            case CommandType::Create: {
+                const Entity entity = registry.Create(command.Mask);
+                created.push_back(entity);
+                for (ComponentMask bits = command.Mask; bits != 0; bits &= bits - 1) {
+                    const auto component = static_cast<ComponentId>(std::countr_zero(bits));
+                    const uint32_t size = ComponentTypes::GetInfo(component).Size;
+                    std::memcpy(registry.GetComponent(entity, component), pData, size);
+                    pData += size;
+                }
+                break;
+            }
+            case CommandType::Destroy:
+                registry.Destroy(target);
+                break;
+            case CommandType::Add: {
+                const auto component = static_cast<ComponentId>(std::countr_zero(command.Mask));
+                std::memcpy(registry.AddComponent(target, component), pData, ComponentTypes::GetInfo(component).Size);
+                break;
+            }
+            case CommandType::Remove:
+                registry.RemoveComponent(target, static_cast<ComponentId>(std::countr_zero(command.Mask)));
+                break;
+            }
+        }
+
+        m_Commands.clear();
+        m_Data.clear();
+        m_CreateCount = 0;
+        m_PlaceholderGeneration = GetNextPlaceholderGeneration();
+    }
+
+    void EntityCommandBuffer::Clear() {
+        std::lock_guard lock(m_Mutex);
+        m_Commands.clear();
+        m_Data.clear();
+        m_CreateCount = 0;
+        m_PlaceholderGeneration = GetNextPlaceholderGeneration();
+    }
+
+    Entity EntityCommandBuffer::Record(const CommandType type, const Entity target, const ComponentMask mask, const std::span<ComponentData> components) {
+        // Playback reads the values back by increasing id.
+        std::ranges::sort(components, {}, &ComponentData::Id);
+
+        std::lock_guard lock(m_Mutex);
+        // Placeholders are numbered in recording order, a valid one was created by an earlier command.
+        if (target.IsPlaceholder() && (target.Generation != m_PlaceholderGeneration || target.Index >= m_CreateCount)) {
+            throw std::invalid_argument("Placeholder entity of another command buffer, or of an earlier playback.");
+        }
+
+        m_Commands.push_back({type, target, mask, m_Data.size()});
+
+        for (const ComponentData& component : components) {
+            const auto* pBytes = static_cast<const std::byte*>(component.pData);
+            m_Data.insert(m_Data.end(), pBytes, pBytes + ComponentTypes::GetInfo(component.Id).Size);
+        }
+
+        return type == CommandType::Create ? Entity{m_CreateCount++, m_PlaceholderGeneration} : target;
+    }
+}
@@ -0,0 +1,153 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/Scene/EntityRegistry.hpp>
+
+#include <cstring>
+
+namespace D3D12Engine {
+    EntityRegistry::EntityRegistry()
+        : m_EntityCount(0) {
+        // Entities without components live in the first archetype.
+        GetArchetype(0);
+    }
+
+    Entity EntityRegistry::Create(const ComponentMask mask) {
+        const uint32_t archetype = GetArchetype(mask);
+
+        Entity entity;
+        if (!m_FreeIndices.empty()) {
+            entity.Index = m_FreeIndices.back();
+            m_FreeIndices.pop_back();
+        } else {
+            entity.Index = static_cast<uint32_t>(m_Entities.size());
+            m_Entities.push_back({0, NoArchetype, 0});
+        }
+
+        EntityRecord& record = m_Entities[entity.Index];
+        entity.Generation = record.Generation;
+        record.Archetype = archetype;
+        record.Row = m_Archetypes[archetype].pArchetype->AddRow(entity);
+        m_EntityCount++;
+
+        return entity;
+    }
+
+    void EntityRegistry::Destroy(const Entity entity) {
+        const EntityRecord& record = GetRecord(entity);
+
+        if (const Entity moved = m_Archetypes[record.Archetype].pArchetype->RemoveRow(record.Row); moved.IsValid()) {
+            m_Entities[moved.Index].Row = record.Row;
+        }
+
+        EntityRecord& freed = m_Entities[entity.Index];
+        freed.Generation = (freed.Generation + 1) % Entity::PlaceholderGeneration;
+        freed.Archetype = NoArchetype;
+        m_FreeIndices.push_back(entity.Index);
+        m_EntityCount--;
+    }
+
+    void* EntityRegistry::AddComponent(const Entity entity, const ComponentId component) {
+        const EntityRecord& record = GetRecord(entity);
+
+        if (!m_Archetypes[record.Archetype].pArchetype->Has(component)) {
+            MoveEntity(entity, GetArchetypeWith(record.Archetype, component));
+        }
+
+        return m_Archetypes[record.Archetype].pArchetype->GetComponent(record.Row, component);
+    }
+
+    void EntityRegistry::RemoveComponent(const Entity entity, const ComponentId component) {
+        const EntityRecord& record = GetRecord(entity);
+
+        if (m_Archetypes[record.Archetype].pArchetype->Has(component)) {
+            MoveEntity(entity, GetArchetypeWithout(record.Archetype, component));
+        }
+    }
+
+    void* EntityRegistry::GetComponent(const Entity entity, const ComponentId component) const {
+        const EntityRecord& record = GetRecord(entity);
+        return m_Archetypes[record.Archetype].pArchetype->GetComponent(record.Row, component);
+    }
+
+    const EntityRegistry::EntityRecord& EntityRegistry::GetRecord(const Entity entity) const {
+        if (!IsAlive(entity)) {
+            throw std::invalid_argument("Entity was destroyed.");
+        }
+
+        return m_Entities[entity.Index];
+    }
+
+    uint32_t EntityRegistry::GetArchetype(const ComponentMask mask) {
+        if (const auto it = m_ArchetypeIndices.find(mask); it != m_ArchetypeIndices.end()) {
+            return it->second;
+        }
+
+        ArchetypeNode node;
+        node.pArchetype = std::make_unique<Archetype>(mask);
+        node.AddEdges.fill(NoArchetype);
+        node.RemoveEdges.fill(NoArchetype);
+
+        const auto index = static_cast<uint32_t>(m_Archetypes.size());
+        m_Archetypes.push_back(std::move(node));
+        m_ArchetypeIndices.emplace(mask, index);
+
+        return index;
+    }
+
+    uint32_t EntityRegistry::GetArchetypeWith(const uint32_t archetype, const ComponentId component) {
+        uint32_t edge = m_Archetypes[archetype].AddEdges[component];
+        if (edge == NoArchetype) {
+            edge = GetArchetype(m_Archetypes[archetype].pArchetype->GetMask() | ComponentMask{1} << component);
+            m_Archetypes[archetype].AddEdges[component] = edge;
+            m_Archetypes[edge].RemoveEdges[component] = archetype;
+        }
+
+        return edge;
+    }
+
+    uint32_t EntityRegistry::GetArchetypeWithout(const uint32_t archetype, const ComponentId component) {
+        uint32_t edge = m_Archetypes[archetype].RemoveEdges[component];
+        if (edge == NoArchetype) {
+            edge = GetArchetype(m_Archetypes[archetype].pArchetype->GetMask() & ~(ComponentMask{1} << component));
+            m_Archetypes[archetype].RemoveEdges[component] = edge;
+            m_Archetypes[edge].AddEdges[component] = archetype;
+        }
+
+        return edge;
+    }
+
+    void EntityRegistry::MoveEntity(const Entity entity, const uint32_t destination) {
+        EntityRecord& record = m_Entities[entity.Index];
+        Archetype& source = *m_Archetypes[record.Archetype].pArchetype;
+        Archetype& target = *m_Archetypes[destination].pArchetype;
+
+        const uint32_t row = target.AddRow(entity);
+        for (const ComponentId component : source.GetComponentIds()) {
+            if (void* pDestination = target.GetComponent(row, component)) {
+                std::memcpy(pDestination, source.GetComponent(record.Row, component), ComponentTypes::GetInfo(component).Size);
+            }
+        }
+
+        if (const Entity moved = source.RemoveRow(record.Row); moved.IsValid()) {
+            m_Entities[moved.Index].Row = record.Row;
+        }
+
+        record.Archetype = destination;
+        record.Row = row;
+    }
+
+    void EntityRegistry::GatherChunks(const ComponentMask mask, std::vector<ChunkRef>& chunks) const {
+        for (const ArchetypeNode& node : m_Archetypes) {
+            const Archetype& archetype = *node.pArchetype;
+            if ((archetype.GetMask() & mask) != mask) {
+                continue;
+            }
+
+            for (uint32_t chunk = 0; chunk < archetype.GetChunkCount(); ++chunk) {
+                chunks.push_back({&archetype, chunk});
+            }
+        }
+    }
+}
@@ -0,0 +1,99 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/Streaming/AsyncFileBackend.hpp>
+
+#include <fstream>
+
+namespace D3D12Engine {
+    AsyncFileBackend::AsyncFileBackend()
+        : m_Worker([this](const std::stop_token& stopToken) { WorkerMain(stopToken); }) {
+    }
+
+    AsyncFileBackend::~AsyncFileBackend() {
+        m_Worker.request_stop();
+        m_Condition.notify_all();
+    }
+
+    void AsyncFileBackend::Submit(StreamingReadRequest request) {
+        {
+            std::lock_guard lock(m_Mutex);
+            m_Pending.push_back(std::move(request));
+        }
+
+        m_Condition.notify_one();
+    }
+
+    void AsyncFileBackend::Cancel(const uint64_t requestId) {
+        std::lock_guard lock(m_Mutex);
+        if (std::erase_if(m_Pending, [&](const StreamingReadRequest& request) { return request.Id == requestId; }) > 0) {
+            return;
+        }
+
+        if (std::erase_if(m_Completed, [&](const StreamingReadResult& result) { return result.Id == requestId; }) > 0) {
+            return;
+        }
+
+        // Only the read in progress is left to cancel, unknown ids are already gone.
+        if (m_ReadingId == requestId) {
+            m_ReadingCancelled = true;
+        }
+    }
+
+    void AsyncFileBackend::Poll(std::vector<StreamingReadResult>& results) {
+        std::lock_guard lock(m_Mutex);
+        for (auto& result : m_Completed) {
+            results.push_back(std::move(result));
+        }
+
+        m_Completed.clear();
+    }
+
+    void AsyncFileBackend::WorkerMain(const std::stop_token& stopToken) {
+        while (true) {
+            StreamingReadRequest request;
+            {
+                std::unique_lock lock(m_Mutex);
+                if (!m_Condition.wait(lock, stopToken, [this] { return !m_Pending.empty(); })) {
+                    return;
+                }
+
+                request = std::move(m_Pending.front());
+                m_Pending.pop_front();
+
+                m_ReadingId = request.Id;
+                m_ReadingCancelled = false;
+            }
+
+            StreamingReadResult result = Read(request);
+
+            std::lock_guard lock(m_Mutex);
+            if (!m_ReadingCancelled) {
+                m_Completed.push_back(std::move(result));
+            }
+
+            m_ReadingId.reset();
+        }
+    }
+
+    StreamingReadResult AsyncFileBackend::Read(const StreamingReadRequest& request) {
+        StreamingReadResult result{request.Id, false, {}};
+
+        std::ifstream file(request.Path, std::ios::binary);
+        if (!file) {
+            return result;
+        }
+
+        result.Data.resize(request.Size);
+        file.seekg(static_cast<std::streamoff>(request.Offset));
+        file.read(reinterpret_cast<char*>(result.Data.data()), static_cast<std::streamsize>(request.Size));
+        result.Succeeded = static_cast<uint64_t>(file.gcount()) == request.Size;
+
+        if (!result.Succeeded) {
+            result.Data.clear();
+        }
+
+        return result;
+    }
+}
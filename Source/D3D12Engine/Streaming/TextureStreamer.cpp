@@ -0,0 +1,361 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/Streaming/TextureStreamer.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <queue>
+#include <ranges>
+#include <stdexcept>
+
+namespace D3D12Engine {
+    TextureStreamer::TextureStreamer(StreamingFileBackend& fileBackend, StreamingDevice& device, const TextureStreamerSettings& settings)
+        : m_FileBackend(fileBackend),
+          m_Device(device),
+          m_Settings(settings) {
+    }
+
+    TextureStreamer::~TextureStreamer() {
+        for (const auto& requestId : m_PendingReads | std::views::keys) {
+            m_FileBackend.Cancel(requestId);
+        }
+
+        for (StreamedTextureId id = 0; id < m_Textures.size(); id++) {
+            if (m_Textures[id].Registered) {
+                m_Device.DestroyTexture(id);
+            }
+        }
+    }
+
+    StreamedTextureId TextureStreamer::RegisterTexture(std::filesystem::path path, DdsLayout layout) {
+        if (layout.Mips.empty()) {
+            throw std::runtime_error("Cannot stream a texture without mips.");
+        }
+
+        StreamedTextureId id;
+        if (!m_FreeIds.empty()) {
+            id = m_FreeIds.back();
+            m_FreeIds.pop_back();
+        } else {
+            id = static_cast<StreamedTextureId>(m_Textures.size());
+            m_Textures.emplace_back();
+        }
+
+        const uint32_t mipCount = layout.GetMipCount();
+
+        // The pinned tail starts at the first mip small enough, or at the last one.
+        uint32_t pinnedMip = mipCount - 1;
+        for (uint32_t mip = 0; mip < mipCount; mip++) {
+            if (std::max(layout.Mips[mip].Width, layout.Mips[mip].Height) <= m_Settings.PinnedMipDimension) {
+                pinnedMip = mip;
+                break;
+            }
+        }
+
+        auto& texture = m_Textures[id];
+        texture.Path = std::move(path);
+        texture.Layout = std::move(layout);
+        texture.ResidentMip = mipCount;
+        texture.PinnedMip = pinnedMip;
+        texture.RequestedMip = mipCount;
+        texture.WantedMip = pinnedMip;
+        texture.LastRequestedFrame = m_FrameIndex;
+        texture.PendingRequest = 0;
+        texture.FailedReads = 0;
+        texture.RetryFrame = 0;
+        texture.Registered = true;
+        texture.LoadFailed = false;
+
+        m_Device.CreateTexture(id, texture.Layout);
+
+        // The tail is contiguous in the file and small, load it in one read right away.
+        IssueRead(id, pinnedMip, mipCount - 1);
+
+        return id;
+    }
+
+    void TextureStreamer::UnregisterTexture(const StreamedTextureId id) {
+        auto& texture = m_Textures[id];
+        if (!texture.Registered) {
+            return;
+        }
+
+        if (texture.PendingRequest != 0) {
+            const auto it = m_PendingReads.find(texture.PendingRequest);
+            m_Stats.PendingBytes -= it->second.Size;
+            m_Stats.RequestsInFlight--;
+            m_PendingReads.erase(it);
+            m_FileBackend.Cancel(texture.PendingRequest);
+        }
+
+        for (uint32_t mip = texture.ResidentMip; mip < texture.Layout.GetMipCount(); mip++) {
+            m_Stats.ResidentBytes -= texture.Layout.Mips[mip].ByteSize;
+        }
+
+        m_Device.DestroyTexture(id);
+
+        texture = StreamedTexture{};
+        m_FreeIds.push_back(id);
+    }
+
+    void TextureStreamer::RequestMip(const StreamedTextureId id, const float desiredMip) {
+        auto& texture = m_Textures[id];
+        const float maxMip = static_cast<float>(texture.Layout.GetMipCount() - 1);
+        const auto mip = static_cast<uint32_t>(std::clamp(std::floor(desiredMip), 0.0f, maxMip));
+
+        texture.RequestedMip = std::min(texture.RequestedMip, mip);
+        texture.LastRequestedFrame = m_FrameIndex;
+    }
+
+    void TextureStreamer::RequestScreenSize(const StreamedTextureId id, const float projectedWidth, const float projectedHeight) {
+        const auto& texture = m_Textures[id];
+        RequestMip(id, ComputeDesiredMip(texture.Layout.Width, texture.Layout.Height, projectedWidth, projectedHeight));
+    }
+
+    void TextureStreamer::Update() {
+        ProcessCompletedReads();
+        UpdateWantedMips();
+        ScheduleReads();
+
+        // The budget may have been lowered, or pinned tails pushed us over it.
+        if (m_Stats.ResidentBytes + m_Stats.PendingBytes > m_Settings.BudgetBytes) {
+            EvictFor(0, true, InvalidTexture);
+        }
+
+        m_FrameIndex++;
+    }
+
+    void TextureStreamer::SetBudget(const uint64_t budgetBytes) {
+        m_Settings.BudgetBytes = budgetBytes;
+    }
+
+    void TextureStreamer::ResetLoadFailure(const StreamedTextureId id) {
+        auto& texture = m_Textures[id];
+        texture.FailedReads = 0;
+        texture.RetryFrame = 0;
+        texture.LoadFailed = false;
+    }
+
+    float TextureStreamer::ComputeDesiredMip(const uint32_t textureWidth, const uint32_t textureHeight,
+                                             const float projectedWidth, const float projectedHeight) {
+        if (projectedWidth <= 0.0f || projectedHeight <= 0.0f) {
+            return std::numeric_limits<float>::max();
+        }
+
+        const float ratio = std::max(static_cast<float>(textureWidth) / projectedWidth,
+                                     static_cast<float>(textureHeight) / projectedHeight);
+
+        return ratio <= 1.0f ? 0.0f : std::log2(ratio);
+    }
+
+    void TextureStreamer::ProcessCompletedReads() {
+        m_CompletedReads.clear();
+        m_FileBackend.Poll(m_CompletedReads);
+
+        for (const auto& result : m_CompletedReads) {
+            const auto it = m_PendingReads.find(result.Id);
+            if (it == m_PendingReads.end()) {
+                // The texture was unregistered while the read was in flight.
+                continue;
+            }
+
+            const PendingRead read = it->second;
+            m_PendingReads.erase(it);
+            m_Stats.PendingBytes -= read.Size;
+            m_Stats.RequestsInFlight--;
+
+            auto& texture = m_Textures[read.Texture];
+            texture.PendingRequest = 0;
+
+            if (!result.Succeeded || result.Data.size() != read.Size) {
+                m_Stats.FailedReads++;
+                texture.FailedReads++;
+                if (texture.FailedReads > m_Settings.MaxReadRetries) {
+                    texture.LoadFailed = true;
+                } else {
+                    texture.RetryFrame = m_FrameIndex + (uint64_t{m_Settings.RetryDelayFrames} << (texture.FailedReads - 1));
+                }
+
+                continue;
+            }
+
+            texture.FailedReads = 0;
+
+            // Upload from the coarsest mip so the resident range stays contiguous.
+            const uint64_t baseOffset = texture.Layout.Mips[read.FirstMip].FileOffset;
+            for (uint32_t mip = read.LastMip + 1; mip-- > read.FirstMip;) {
+                const auto& level = texture.Layout.Mips[mip];
+                const std::span data(result.Data.data() + (level.FileOffset - baseOffset), level.ByteSize);
+                m_Device.UploadMip(read.Texture, mip, data);
+            }
+
+            texture.ResidentMip = read.FirstMip;
+            m_Stats.ResidentBytes += read.Size;
+            m_Stats.MipsLoaded += read.LastMip - read.FirstMip + 1;
+        }
+    }
+
+    void TextureStreamer::UpdateWantedMips() {
+        for (auto& texture : m_Textures) {
+            if (!texture.Registered) {
+                continue;
+            }
+
+            // Wanted mips are sticky, an unrequested texture keeps its mips until it is
+            // either stale or the budget needs them.
+            if (texture.RequestedMip < texture.Layout.GetMipCount()) {
+                texture.WantedMip = texture.RequestedMip;
+            }
+
+            texture.RequestedMip = texture.Layout.GetMipCount();
+        }
+    }
+
+    void TextureStreamer::ScheduleReads() {
+        struct Candidate {
+            StreamedTextureId Id;
+            uint32_t Deficit;
+            uint64_t LastRequestedFrame;
+            uint64_t Size;
+        };
+
+        std::vector<Candidate> candidates;
+        for (StreamedTextureId id = 0; id < m_Textures.size(); id++) {
+            const auto& texture = m_Textures[id];
+            if (!texture.Registered || texture.LoadFailed || texture.PendingRequest != 0 || m_FrameIndex < texture.RetryFrame) {
+                continue;
+            }
+
+            // The pinned tail failed to load, read it again like on registration before
+            // streaming anything finer.
+            if (texture.ResidentMip > texture.PinnedMip) {
+                IssueRead(id, texture.PinnedMip, texture.Layout.GetMipCount() - 1);
+                continue;
+            }
+
+            if (texture.ResidentMip <= texture.WantedMip) {
+                continue;
+            }
+
+            if (m_FrameIndex - texture.LastRequestedFrame > m_Settings.EvictionGraceFrames) {
+                continue;
+            }
+
+            candidates.push_back({id, texture.ResidentMip - texture.WantedMip, texture.LastRequestedFrame,
+                                  texture.Layout.Mips[texture.ResidentMip - 1].ByteSize});
+        }
+
+        // Biggest quality deficit first, then most recently used, then cheapest.
+        std::ranges::sort(candidates, [](const Candidate& a, const Candidate& b) {
+            if (a.Deficit != b.Deficit) {
+                return a.Deficit > b.Deficit;
+            }
+
+            if (a.LastRequestedFrame != b.LastRequestedFrame) {
+                return a.LastRequestedFrame > b.LastRequestedFrame;
+            }
+
+            return a.Size < b.Size;
+        });
+
+        for (const auto& candidate : candidates) {
+            if (m_Stats.RequestsInFlight >= m_Settings.MaxRequestsInFlight) {
+                break;
+            }
+
+            // Always let at least one read through so huge mips can't starve.
+            if (m_Stats.RequestsInFlight > 0 && m_Stats.PendingBytes + candidate.Size > m_Settings.MaxBytesInFlight) {
+                continue;
+            }
+
+            if (!EvictFor(candidate.Size, false, candidate.Id)) {
+                continue;
+            }
+
+            const uint32_t mip = m_Textures[candidate.Id].ResidentMip - 1;
+            IssueRead(candidate.Id, mip, mip);
+        }
+    }
+
+    void TextureStreamer::IssueRead(const StreamedTextureId id, const uint32_t firstMip, const uint32_t lastMip) {
+        auto& texture = m_Textures[id];
+        const auto& first = texture.Layout.Mips[firstMip];
+        const auto& last = texture.Layout.Mips[lastMip];
+        const uint64_t size = last.FileOffset + last.ByteSize - first.FileOffset;
+
+        const uint64_t requestId = m_NextRequestId++;
+        m_PendingReads.emplace(requestId, PendingRead{id, firstMip, lastMip, size});
+        m_Stats.PendingBytes += size;
+        m_Stats.RequestsInFlight++;
+        texture.PendingRequest = requestId;
+
+        m_FileBackend.Submit({requestId, texture.Path, first.FileOffset, size});
+    }
+
+    bool TextureStreamer::EvictFor(const uint64_t bytesNeeded, const bool allowRecent, const StreamedTextureId exclude) {
+        const auto fits = [&] {
+            return m_Stats.ResidentBytes + m_Stats.PendingBytes + bytesNeeded <= m_Settings.BudgetBytes;
+        };
+
+        if (fits()) {
+            return true;
+        }
+
+        struct Victim {
+            StreamedTextureId Id;
+            int64_t Excess;
+            uint64_t LastRequestedFrame;
+        };
+
+        // Mips finer than wanted go first, then the least recently requested textures.
+        const auto compare = [](const Victim& a, const Victim& b) {
+            if (a.Excess != b.Excess) {
+                return a.Excess < b.Excess;
+            }
+
+            return a.LastRequestedFrame > b.LastRequestedFrame;
+        };
+
+        const auto makeVictim = [](const StreamedTextureId id, const StreamedTexture& texture) {
+            return Victim{id, static_cast<int64_t>(texture.WantedMip) - static_cast<int64_t>(texture.ResidentMip),
+                          texture.LastRequestedFrame};
+        };
+
+        std::priority_queue<Victim, std::vector<Victim>, decltype(compare)> victims(compare);
+        for (StreamedTextureId id = 0; id < m_Textures.size(); id++) {
+            if (id != exclude && IsEvictable(m_Textures[id], allowRecent)) {
+                victims.push(makeVictim(id, m_Textures[id]));
+            }
+        }
+
+        while (!fits() && !victims.empty()) {
+            const StreamedTextureId id = victims.top().Id;
+            victims.pop();
+
+            auto& texture = m_Textures[id];
+            m_Device.EvictMip(id, texture.ResidentMip);
+            m_Stats.ResidentBytes -= texture.Layout.Mips[texture.ResidentMip].ByteSize;
+            m_Stats.MipsEvicted++;
+            texture.ResidentMip++;
+
+            if (IsEvictable(texture, allowRecent)) {
+                victims.push(makeVictim(id, texture));
+            }
+        }
+
+        return fits();
+    }
+
+    bool TextureStreamer::IsEvictable(const StreamedTexture& texture, const bool allowRecent) const {
+        if (!texture.Registered || texture.PendingRequest != 0 || texture.ResidentMip >= texture.PinnedMip) {
+            return false;
+        }
+
+        return allowRecent ||
+               texture.ResidentMip < texture.WantedMip ||
+               m_FrameIndex - texture.LastRequestedFrame > m_Settings.EvictionGraceFrames;
+    }
+}
@@ -0,0 +1,220 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/Assets/AssetLoader.hpp>
+#include <D3D12Engine/Core/BoundedQueue.hpp>
+
+#include <TestCheck.hpp>
+
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <utility>
+
+namespace {
+    using namespace D3D12Engine;
+
+    std::filesystem::path WriteFile(const std::string& name, const std::string& contents) {
+        const std::filesystem::path path = std::filesystem::temp_directory_path() / name;
+        std::ofstream(path, std::ios::binary) << contents;
+
+        return path;
+    }
+
+    std::unique_ptr<std::string> DecodeString(const std::span<const std::byte> data) {
+        return std::make_unique<std::string>(reinterpret_cast<const char*>(data.data()), data.size());
+    }
+
+    void TestQueueOrder() {
+        // Greatest first, equal keys in insertion order through the second member.
+        using Item = std::pair<int, int>;
+        const auto compare = [](const Item& a, const Item& b) {
+            return a.first != b.first ? a.first < b.first : a.second > b.second;
+        };
+
+        BoundedQueue<Item, decltype(compare)> queue(4, compare);
+        DE_CHECK(queue.TryPush({1, 0}));
+        DE_CHECK(queue.TryPush({3, 1}));
+        DE_CHECK(queue.TryPush({1, 2}));
+        DE_CHECK(queue.TryPush({3, 3}));
+        DE_CHECK(!queue.TryPush({9, 4}));
+        DE_CHECK(queue.GetSize() == 4);
+
+        DE_CHECK(queue.TryPop() == Item(3, 1));
+        DE_CHECK(queue.TryPop() == Item(3, 3));
+        DE_CHECK(queue.TryPop() == Item(1, 0));
+
+        DE_CHECK(queue.TryPush({2, 5}));
+        DE_CHECK(queue.TakeAll().size() == 2);
+        DE_CHECK(!queue.TryPop());
+
+        // Once closed, pushes fail and pops drain what is left.
+        DE_CHECK(queue.TryPush({1, 6}));
+        queue.Close();
+        DE_CHECK(!queue.Push({1, 7}));
+        DE_CHECK(queue.Pop() == Item(1, 6));
+        DE_CHECK(!queue.Pop());
+    }
+
+    void TestQueueMoveOnly() {
+        BoundedQueue<std::unique_ptr<int>, std::greater<>> queue(0);
+        for (int i = 0; i < 8; i++) {
+            DE_CHECK(queue.Push(std::make_unique<int>(i)));
+        }
+
+        // Values move out of the heap, compared through the pointers here, only ownership matters.
+        int count = 0;
+        while (auto value = queue.TryPop()) {
+            DE_CHECK(*value != nullptr);
+            count++;
+        }
+
+        DE_CHECK(count == 8);
+    }
+
+    void TestQueueBlocksWhenFull() {
+        BoundedQueue<int> queue(1);
+        DE_CHECK(queue.Push(1));
+
+        std::thread producer([&] { DE_CHECK(queue.Push(2)); });
+        DE_CHECK(queue.Pop() == 1);
+        DE_CHECK(queue.Pop() == 2);
+        producer.join();
+    }
+
+    void TestLoadsAndUploads() {
+        const auto path = WriteFile("D3D12EngineAssetLoaderTests.txt", "payload");
+
+        AssetLoader loader;
+        bool uploaded = false;
+        const auto handle = loader.Load<std::string>(path, AssetPriority::Normal, DecodeString,
+                                                     [&](std::string& asset) { uploaded = asset == "payload"; });
+        loader.Wait(handle.GetRequest());
+
+        DE_CHECK(handle.IsReady());
+        DE_CHECK(uploaded);
+        DE_CHECK(handle.Get() && *handle.Get() == "payload");
+
+        const auto missing = loader.Load<std::string>(path.string() + ".missing", AssetPriority::Normal, DecodeString);
+        loader.Wait(missing.GetRequest());
+        DE_CHECK(missing.GetState() == AssetState::Failed);
+        DE_CHECK(!missing.GetError().empty());
+
+        // A directory opens on some platforms, it fails like a missing file instead of aborting the reader.
+        const auto directory = loader.Load<std::string>(std::filesystem::temp_directory_path(), AssetPriority::Normal, DecodeString);
+        loader.Wait(directory.GetRequest());
+        DE_CHECK(directory.GetState() == AssetState::Failed);
+        DE_CHECK(!directory.GetError().empty());
+
+        const auto rejected = loader.Load<std::string>(path, AssetPriority::Normal,
+                                                       [](std::span<const std::byte>) { return std::unique_ptr<std::string>(); });
+        loader.Wait(rejected.GetRequest());
+        DE_CHECK(rejected.GetState() == AssetState::Failed);
+
+        DE_CHECK(loader.GetStats().Completed == 1);
+        DE_CHECK(loader.GetStats().Failed == 3);
+
+        std::filesystem::remove(path);
+    }
+
+    void TestShutdownCancelsQueuedWork() {
+        const auto path = WriteFile("D3D12EngineAssetLoaderShutdown.txt", "payload");
+
+        std::vector<AssetHandle<std::string>> handles;
+        std::atomic<bool> release = false;
+        std::atomic<uint32_t> decodeCount = 0;
+        std::optional<AssetLoader> loader;
+        loader.emplace(AssetLoaderSettings{.DecodeThreadCount = 1, .ReadQueueCapacity = 64, .DecodeQueueCapacity = 2, .UploadQueueCapacity = 2});
+
+        // The single decoder stalls on the first asset, the rest piles up in the queues.
+        const auto decode = [&](const std::span<const std::byte> data) {
+            decodeCount++;
+            while (!release) {
+                std::this_thread::yield();
+            }
+
+            return DecodeString(data);
+        };
+
+        for (uint32_t i = 0; i < 32; i++) {
+            handles.push_back(loader->Load<std::string>(path, AssetPriority::Normal, decode));
+        }
+
+        while (decodeCount == 0) {
+            std::this_thread::yield();
+        }
+
+        // Lets the decoder go once the destructor started tearing the queues down.
+        std::jthread releaser([&] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            release = true;
+        });
+
+        loader.reset();
+
+        // Everything reached a final state, and nothing queued was decoded.
+        uint32_t cancelled = 0;
+        for (const auto& handle : handles) {
+            DE_CHECK(handle.IsDone());
+            cancelled += handle.GetState() == AssetState::Cancelled;
+        }
+
+        DE_CHECK(decodeCount == 1);
+        DE_CHECK(cancelled == handles.size());
+
+        std::filesystem::remove(path);
+    }
+
+    void TestFullReadQueueRejects() {
+        const auto path = WriteFile("D3D12EngineAssetLoaderFull.txt", "payload");
+
+        std::atomic<bool> release = false;
+        const auto decode = [&](const std::span<const std::byte> data) {
+            while (!release) {
+                std::this_thread::yield();
+            }
+
+            return DecodeString(data);
+        };
+
+        AssetLoader loader({.DecodeThreadCount = 1, .ReadQueueCapacity = 4, .DecodeQueueCapacity = 2, .UploadQueueCapacity = 2});
+
+        // At most one decoding, two waiting for a decoder, one held by the reader and four queued.
+        std::vector<AssetHandle<std::string>> handles;
+        for (uint32_t i = 0; i < 16; i++) {
+            handles.push_back(loader.Load<std::string>(path, AssetPriority::Normal, decode));
+        }
+
+        uint32_t rejected = 0;
+        for (const auto& handle : handles) {
+            if (handle.GetState() == AssetState::Failed) {
+                DE_CHECK(!handle.GetError().empty());
+                rejected++;
+            }
+        }
+
+        DE_CHECK(rejected >= 8);
+
+        release = true;
+        for (const auto& handle : handles) {
+            loader.Wait(handle.GetRequest());
+        }
+
+        DE_CHECK(loader.GetStats().Completed + rejected == handles.size());
+
+        std::filesystem::remove(path);
+    }
+}
+
+int main() {
+    TestQueueOrder();
+    TestQueueMoveOnly();
+    TestQueueBlocksWhenFull();
+    TestLoadsAndUploads();
+    TestShutdownCancelsQueuedWork();
+    TestFullReadQueueRejects();
+
+    return D3D12Engine::Tests::GetExitCode();
+}
@@ -0,0 +1,190 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/Core/DynamicResolution.hpp>
+
+#include <TestCheck.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <random>
+#include <span>
+#include <vector>
+
+namespace {
+    using namespace D3D12Engine;
+
+    // GPU whose frame time is a fixed cost plus a cost proportional to the shaded area,
+    // reported two frames late like timestamp queries are, with some measurement noise.
+    class SimulatedGpu {
+    public:
+        explicit SimulatedGpu(const double noiseMs)
+            : m_Random(42),
+              m_Noise(0.0, noiseMs) {
+        }
+
+        double Render(const float scale, const double fullResolutionMs) {
+            m_InFlight.push_back(FixedCostMs + fullResolutionMs * scale * scale + m_Noise(m_Random));
+            if (m_InFlight.size() <= Latency) {
+                return m_InFlight.front();
+            }
+
+            const double measured = m_InFlight.front();
+            m_InFlight.pop_front();
+
+            return measured;
+        }
+
+    private:
+        static constexpr double FixedCostMs = 1.0;
+        static constexpr size_t Latency = 2;
+
+        std::mt19937 m_Random;
+        std::normal_distribution<double> m_Noise;
+        std::deque<double> m_InFlight;
+    };
+
+    struct TraceResult {
+        std::vector<float> Scales;
+        std::vector<double> FrameTimes;
+    };
+
+    // Runs the controller on a load trace, one full resolution cost per frame.
+    TraceResult RunTrace(DynamicResolutionController& controller, const std::vector<double>& trace, const double noiseMs = 0.2) {
+        SimulatedGpu gpu(noiseMs);
+        TraceResult result;
+        for (const double fullResolutionMs : trace) {
+            const double measured = gpu.Render(controller.GetScale(), fullResolutionMs);
+            result.FrameTimes.push_back(1.0 + fullResolutionMs * controller.GetScale() * controller.GetScale());
+            result.Scales.push_back(controller.Update(measured));
+        }
+
+        return result;
+    }
+
+    std::vector<double> MakeTrace(std::initializer_list<std::pair<uint32_t, double>> phases) {
+        std::vector<double> trace;
+        for (const auto& [frameCount, fullResolutionMs] : phases) {
+            trace.insert(trace.end(), frameCount, fullResolutionMs);
+        }
+
+        return trace;
+    }
+
+    // Times the scale changes direction in the given frames, a settled controller doesn't.
+    uint32_t CountReversals(const std::vector<float>& scales, const size_t first, const size_t last) {
+        uint32_t reversals = 0;
+        float previousDelta = 0.0f;
+        for (size_t frame = first + 1; frame < last; frame++) {
+            const float delta = scales[frame] - scales[frame - 1];
+            if (delta == 0.0f) {
+                continue;
+            }
+
+            reversals += previousDelta * delta < 0.0f;
+            previousDelta = delta;
+        }
+
+        return reversals;
+    }
+
+    float GetRange(const std::vector<float>& values, const size_t first, const size_t last) {
+        const auto [min, max] = std::ranges::minmax(std::span(values).subspan(first, last - first));
+        return max - min;
+    }
+
+    void TestConvergesUnderLoad() {
+        DynamicResolutionController controller;
+        const double target = controller.GetSettings().TargetFrameTimeMs;
+
+        // Full resolution takes 21 ms, the area has to shrink to about 0.62.
+        const TraceResult result = RunTrace(controller, MakeTrace({{200, 20.0}}));
+
+        const size_t settled = 120;
+        for (size_t frame = settled; frame < result.FrameTimes.size(); frame++) {
+            DE_CHECK(std::abs(result.FrameTimes[frame] - target) / target < 0.1);
+        }
+
+        DE_CHECK(CountReversals(result.Scales, settled, result.Scales.size()) <= 2);
+        DE_CHECK(GetRange(result.Scales, settled, result.Scales.size()) < 0.02f);
+    }
+
+    void TestSaturatesAtTheBounds() {
+        DynamicResolutionController controller;
+        const DynamicResolutionSettings& settings = controller.GetSettings();
+
+        // Cheap scene, stays at full resolution.
+        TraceResult result = RunTrace(controller, MakeTrace({{100, 6.0}}));
+        DE_CHECK(std::ranges::all_of(result.Scales, [&](const float scale) { return scale == settings.MaxScale; }));
+
+        // Heavier than the target even at the lowest scale, bottoms out there and stays.
+        result = RunTrace(controller, MakeTrace({{200, 80.0}}));
+        DE_CHECK(result.Scales.back() == settings.MinScale);
+        DE_CHECK(GetRange(result.Scales, 100, 200) == 0.0f);
+
+        // And recovers all the way once the load is gone, no integral wind-up to unwind.
+        result = RunTrace(controller, MakeTrace({{150, 6.0}}));
+        DE_CHECK(result.Scales.back() == settings.MaxScale);
+    }
+
+    void TestFollowsLoadChanges() {
+        DynamicResolutionController controller;
+        const double target = controller.GetSettings().TargetFrameTimeMs;
+
+        // Load spikes up then drops, the scale must follow both ways without ringing.
+        const TraceResult result = RunTrace(controller, MakeTrace({{150, 16.0}, {150, 28.0}, {150, 18.0}}));
+
+        for (const size_t phaseEnd : {150u, 300u, 450u}) {
+            const size_t settled = phaseEnd - 50;
+            DE_CHECK(std::abs(result.FrameTimes[phaseEnd - 1] - target) / target < 0.1);
+            DE_CHECK(CountReversals(result.Scales, settled, phaseEnd) <= 2);
+        }
+
+        // The per-frame step is bounded, no frame jumps in resolution.
+        const float maxStep = controller.GetSettings().MaxAreaStep;
+        for (size_t frame = 1; frame < result.Scales.size(); frame++) {
+            const float previousArea = result.Scales[frame - 1] * result.Scales[frame - 1];
+            const float area = result.Scales[frame] * result.Scales[frame];
+            DE_CHECK(std::abs(area - previousArea) <= maxStep * previousArea + 1e-5f);
+        }
+    }
+
+    void TestIgnoresNoise() {
+        // Noise within the deadband once settled doesn't make the scale dither.
+        DynamicResolutionController controller;
+        const TraceResult result = RunTrace(controller, MakeTrace({{400, 20.0}}), 0.4);
+
+        DE_CHECK(CountReversals(result.Scales, 200, 400) <= 4);
+        DE_CHECK(GetRange(result.Scales, 200, 400) < 0.03f);
+    }
+
+    void TestRenderSize() {
+        DynamicResolutionController controller({.MinScale = 0.5f, .SizeGranularity = 8});
+        RenderSize size = controller.ComputeRenderSize(1920, 1080);
+        DE_CHECK(size.Width == 1920 && size.Height == 1080);
+
+        RunTrace(controller, MakeTrace({{300, 200.0}}));
+        size = controller.ComputeRenderSize(1920, 1080);
+        DE_CHECK(size.Width == 960 && size.Height == 544);
+        DE_CHECK(size.Width % 8 == 0 && size.Height % 8 == 0);
+
+        // Never rounds to zero or above the output.
+        size = controller.ComputeRenderSize(6, 3);
+        DE_CHECK(size.Width >= 1 && size.Width <= 6 && size.Height >= 1 && size.Height <= 3);
+
+        controller.Reset();
+        DE_CHECK(controller.GetScale() == controller.GetSettings().MaxScale);
+    }
+}
+
+int main() {
+    TestConvergesUnderLoad();
+    TestSaturatesAtTheBounds();
+    TestFollowsLoadChanges();
+    TestIgnoresNoise();
+    TestRenderSize();
+
+    return D3D12Engine::Tests::GetExitCode();
+}
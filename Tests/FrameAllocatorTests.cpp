@@ -0,0 +1,251 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/Core/FixedBlockResource.hpp>
+#include <D3D12Engine/Core/LinearArena.hpp>
+#include <D3D12Engine/Core/ScratchArena.hpp>
+
+#include <TestCheck.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <list>
+#include <map>
+#include <new>
+#include <string>
+#include <vector>
+
+namespace {
+    // Every allocation of the process goes through the operators below.
+    size_t g_AllocationCount = 0;
+
+    void* CountedAllocate(const size_t size, const size_t alignment) {
+        g_AllocationCount++;
+
+        // aligned_alloc wants a multiple of the alignment, and something to return for 0.
+        const size_t alignedSize = ((size > 0 ? size : 1) + alignment - 1) & ~(alignment - 1);
+        if (void* p = std::aligned_alloc(alignment, alignedSize)) {
+            return p;
+        }
+
+        throw std::bad_alloc();
+    }
+}
+
+void* operator new(const size_t size) {
+    return CountedAllocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void* operator new[](const size_t size) {
+    return CountedAllocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void* operator new(const size_t size, const std::align_val_t alignment) {
+    return CountedAllocate(size, std::max(static_cast<size_t>(alignment), size_t{__STDCPP_DEFAULT_NEW_ALIGNMENT__}));
+}
+
+void* operator new[](const size_t size, const std::align_val_t alignment) {
+    return CountedAllocate(size, std::max(static_cast<size_t>(alignment), size_t{__STDCPP_DEFAULT_NEW_ALIGNMENT__}));
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void* p, size_t) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::align_val_t) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void* p, std::align_val_t) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, size_t, std::align_val_t) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void* p, size_t, std::align_val_t) noexcept {
+    std::free(p);
+}
+
+namespace {
+    using namespace D3D12Engine;
+
+    constexpr uint32_t WarmupFrameCount = 8;
+    constexpr uint32_t SteadyFrameCount = 100;
+
+    // Runs frames until the allocators settled, then returns what the following frames allocated.
+    template <typename Frame>
+    size_t CountSteadyStateAllocations(Frame&& frame) {
+        for (uint32_t i = 0; i < WarmupFrameCount; i++) {
+            frame(i);
+        }
+
+        const size_t before = g_AllocationCount;
+        for (uint32_t i = 0; i < SteadyFrameCount; i++) {
+            frame(WarmupFrameCount + i);
+        }
+
+        return g_AllocationCount - before;
+    }
+
+    struct Transition {
+        uint32_t Resource;
+        uint32_t Before;
+        uint32_t After;
+    };
+
+    void TestCounting() {
+        // Makes sure the replacement is the one in use, or every other check would pass for nothing.
+        const size_t before = g_AllocationCount;
+        std::vector<int> values(100);
+        DE_CHECK(g_AllocationCount == before + 1);
+    }
+
+    void TestLinearArena() {
+        LinearArena arena(1024);
+
+        auto* pAligned = static_cast<std::byte*>(arena.Allocate(3, 1));
+        DE_CHECK(reinterpret_cast<uintptr_t>(arena.Allocate(16, 64)) % 64 == 0);
+        DE_CHECK(arena.GetUsed() == 80);
+
+        // Rewinding drops what came after the marker, overflow included.
+        const LinearArena::Marker marker = arena.GetMarker();
+        static_cast<void>(arena.NewArray<uint32_t>(1000));
+        DE_CHECK(arena.GetUsed() == 80 + 4000);
+        arena.Rewind(marker);
+        DE_CHECK(arena.GetUsed() == 80);
+        DE_CHECK(arena.Allocate(1, 1) == pAligned + 80);
+
+        // The block grows to the high water mark at the next reset.
+        DE_CHECK(arena.GetHighWaterMark() == 80 + 4000);
+        static_cast<void>(arena.NewArray<uint32_t>(1000));
+        arena.Reset();
+        DE_CHECK(arena.GetUsed() == 0);
+        DE_CHECK(arena.GetCapacity() >= 80 + 4000);
+
+        // Over-aligned allocations always overflow, the block being big enough or not.
+        for (uint32_t i = 0; i < 100; i++) {
+            DE_CHECK(reinterpret_cast<uintptr_t>(arena.Allocate(16, 128)) % 128 == 0);
+            DE_CHECK(arena.GetMarker().OverflowCount == 1);
+            arena.Reset();
+            DE_CHECK(arena.GetUsed() == 0 && arena.GetMarker().OverflowCount == 0);
+        }
+
+        // So do allocations pushed past the end of the block by their padding alone.
+        const size_t capacity = arena.GetCapacity();
+        static_cast<void>(arena.Allocate(capacity - 8, 1));
+        static_cast<void>(arena.Allocate(8, 64));
+        DE_CHECK(arena.GetMarker().OverflowCount == 1);
+        arena.Reset();
+        DE_CHECK(arena.GetUsed() == 0 && arena.GetMarker().OverflowCount == 0);
+
+        // Frames of varying size, pmr containers that grow through the arena.
+        LinearArena frameArena(1024);
+        const size_t allocations = CountSteadyStateAllocations([&](const uint32_t frame) {
+            frameArena.Reset();
+
+            std::pmr::vector<Transition> transitions(&frameArena);
+            for (uint32_t i = 0; i < 500 + frame % 7 * 100; i++) {
+                transitions.push_back({i, 0, 1});
+            }
+
+            const std::pmr::string name("debug names of the resources of this frame", &frameArena);
+            static_cast<void>(frameArena.New<Transition>(Transition{0, 1, 2}));
+            static_cast<void>(frameArena.NewArray<float>(256));
+        });
+
+        DE_CHECK(allocations == 0);
+        DE_CHECK(frameArena.GetCapacity() >= frameArena.GetHighWaterMark());
+    }
+
+    size_t BuildName(const uint32_t depth, const size_t length) {
+        const ScratchArena scratch;
+        std::pmr::string name(length, 'a', scratch.GetResource());
+        if (depth == 0) {
+            return name.size();
+        }
+
+        return name.size() + BuildName(depth - 1, length);
+    }
+
+    void TestScratchArena() {
+        // Nested scopes, deep enough to overflow the thread arena on the first call.
+        const size_t length = ScratchArena::ThreadCapacity / 4;
+        const size_t allocations = CountSteadyStateAllocations([&](uint32_t) {
+            DE_CHECK(BuildName(5, length) == 6 * length);
+        });
+
+        DE_CHECK(allocations == 0);
+
+        // Inner scopes give their memory back to the outer one.
+        const ScratchArena outer;
+        const size_t used = outer.GetArena().GetUsed();
+        {
+            const ScratchArena inner;
+            static_cast<void>(inner.GetArena().Allocate(1000));
+        }
+
+        DE_CHECK(outer.GetArena().GetUsed() == used);
+    }
+
+    void TestFixedBlockResource() {
+        FixedBlockResource resource(64, alignof(std::max_align_t), 32);
+
+        // Freed blocks are reused first.
+        void* pFirst = resource.allocate(48, 8);
+        resource.deallocate(pFirst, 48, 8);
+        DE_CHECK(resource.allocate(48, 8) == pFirst);
+        DE_CHECK(resource.GetBlockCount() == 32);
+        DE_CHECK(resource.GetFreeBlockCount() == 31);
+        resource.deallocate(pFirst, 48, 8);
+
+        // Node churn: a live set that keeps the same size while its entries change.
+        std::pmr::map<uint32_t, Transition> live(&resource);
+        std::pmr::list<uint32_t> order(&resource);
+        const size_t allocations = CountSteadyStateAllocations([&](const uint32_t frame) {
+            for (uint32_t i = 0; i < 200; i++) {
+                const uint32_t key = frame * 200 + i;
+                live.emplace(key, Transition{key, 0, 1});
+                order.push_back(key);
+            }
+
+            while (order.size() > 1000) {
+                live.erase(order.front());
+                order.pop_front();
+            }
+        });
+
+        DE_CHECK(allocations == 0);
+        DE_CHECK(live.size() == 1000);
+
+        // Blocks too small for the request go upstream.
+        const size_t blockCount = resource.GetBlockCount();
+        void* pLarge = resource.allocate(4096, 8);
+        resource.deallocate(pLarge, 4096, 8);
+        DE_CHECK(resource.GetBlockCount() == blockCount);
+    }
+}
+
+int main() {
+    TestCounting();
+    TestLinearArena();
+    TestScratchArena();
+    TestFixedBlockResource();
+
+    return D3D12Engine::Tests::GetExitCode();
+}
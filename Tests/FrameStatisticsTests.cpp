@@ -0,0 +1,185 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/Core/Benchmark.hpp>
+#include <D3D12Engine/Core/ScriptedCamera.hpp>
+
+#include <TestCheck.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+    using namespace D3D12Engine;
+
+    bool IsNear(const double a, const double b) {
+        return std::abs(a - b) <= 1e-9 * std::max(1.0, std::abs(b));
+    }
+
+    void TestPercentiles() {
+        // 1 to 101: rank p lands exactly on p + 1.
+        std::vector<double> values;
+        for (uint32_t i = 101; i >= 1; i--) {
+            values.push_back(i);
+        }
+
+        const StatisticSummary summary = FrameStatistics::Summarize(values);
+        DE_CHECK(std::ranges::is_sorted(values));
+        DE_CHECK(summary.Min == 1.0 && summary.Max == 101.0);
+        DE_CHECK(IsNear(summary.Mean, 51.0));
+        DE_CHECK(IsNear(summary.P50, 51.0) && IsNear(summary.P95, 96.0) && IsNear(summary.P99, 100.0));
+
+        // Between ranks the closest two are interpolated: rank 0.95 * 3 = 2.85 of {10, 20, 30, 40}.
+        const double four[] = {10.0, 20.0, 30.0, 40.0};
+        DE_CHECK(IsNear(FrameStatistics::Percentile(four, 95.0), 38.5));
+        DE_CHECK(IsNear(FrameStatistics::Percentile(four, 50.0), 25.0));
+        DE_CHECK(FrameStatistics::Percentile(four, 0.0) == 10.0);
+        DE_CHECK(FrameStatistics::Percentile(four, 100.0) == 40.0);
+        DE_CHECK(FrameStatistics::Percentile(four, 150.0) == 40.0);
+        DE_CHECK(FrameStatistics::Percentile(four, -5.0) == 10.0);
+
+        const double one[] = {7.0};
+        DE_CHECK(FrameStatistics::Percentile(one, 99.0) == 7.0);
+        DE_CHECK(FrameStatistics::Percentile({}, 50.0) == 0.0);
+        DE_CHECK(FrameStatistics::Summarize(std::span<double>()).Max == 0.0);
+
+        // Percentiles never decrease and stay within the values.
+        std::mt19937 random(17);
+        std::lognormal_distribution<double> frameTimes(2.8, 0.3);
+        std::vector<double> samples(1000);
+        std::ranges::generate(samples, [&] { return frameTimes(random); });
+        std::ranges::sort(samples);
+        double previous = samples.front();
+        for (double percentile = 0.0; percentile <= 100.0; percentile += 0.5) {
+            const double value = FrameStatistics::Percentile(samples, percentile);
+            DE_CHECK(value >= previous && value <= samples.back());
+            previous = value;
+        }
+    }
+
+    void TestAggregation() {
+        FrameStatistics statistics;
+        for (uint32_t i = 0; i < 100; i++) {
+            statistics.Add({16.0 + i % 10, 4.0 + i % 5, 10.0, 1000 + static_cast<uint64_t>(i * 37 % 100)});
+        }
+
+        // Each timing is summarized on its own.
+        DE_CHECK(statistics.GetFrameCount() == 100);
+        DE_CHECK(statistics.Summarize(&FrameSample::FrameMs).Max == 25.0);
+        DE_CHECK(IsNear(statistics.Summarize(&FrameSample::FrameMs).Mean, 20.5));
+        DE_CHECK(IsNear(statistics.Summarize(&FrameSample::CpuMs).Mean, 6.0));
+        DE_CHECK(statistics.Summarize(&FrameSample::GpuMs).P99 == 10.0);
+        DE_CHECK(statistics.GetPeakMemory() == 1099);
+
+        // Summaries don't reorder the samples.
+        DE_CHECK(statistics.GetSamples()[1].FrameMs == 17.0);
+
+        statistics.Clear();
+        DE_CHECK(statistics.GetFrameCount() == 0 && statistics.GetPeakMemory() == 0);
+    }
+
+    void TestBenchmarkRun() {
+        BenchmarkSettings settings;
+        settings.FrameCount = 4;
+        settings.WarmupFrameCount = 2;
+        settings.StepSeconds = 0.5;
+        BenchmarkRun run(settings);
+
+        // Warmup frames advance the simulation but aren't measured, frames past the end are ignored.
+        for (uint32_t i = 0; i < 10; i++) {
+            DE_CHECK(run.GetSimulationTime() == std::min(i, 6u) * 0.5);
+            run.AddFrame({i < 2 ? 100.0 : 10.0 + i, 5.0, 8.0, i < 2 ? 9000u : 1000u + i});
+        }
+
+        DE_CHECK(run.IsFinished());
+        DE_CHECK(run.GetFrameIndex() == 6);
+        DE_CHECK(run.GetStatistics().GetFrameCount() == 4);
+        DE_CHECK(run.GetStatistics().Summarize(&FrameSample::FrameMs).Max == 15.0);
+
+        std::ostringstream report;
+        run.WriteReport(report, {"release \"x64\"\n", "Null\tAdapter", 1920, 1080});
+        const std::string json = report.str();
+        DE_CHECK(json.find("\"build\": \"release \\\"x64\\\"\\n\"") != std::string::npos);
+        DE_CHECK(json.find("\"adapter\": \"Null\\tAdapter\"") != std::string::npos);
+        DE_CHECK(json.find("\"resolution\": {\"width\": 1920, \"height\": 1080}") != std::string::npos);
+        DE_CHECK(json.find("\"frames\": 4,") != std::string::npos);
+        DE_CHECK(json.find("\"frameMs\": {\"min\": 12, \"mean\": 13.5") != std::string::npos);
+        DE_CHECK(json.find("\"memoryBytes\": {\"peak\": 1005, \"final\": 1005}") != std::string::npos);
+
+        // Timings that went wrong don't make the report unparseable.
+        settings.WarmupFrameCount = 0;
+        BenchmarkRun failed(settings);
+        failed.AddFrame({16.0, 5.0, std::numeric_limits<double>::quiet_NaN(), 1000});
+        failed.AddFrame({std::numeric_limits<double>::infinity(), 5.0, 8.0, 1000});
+        failed.AddFrame({17.0, 5.0, 8.0, 1000});
+        std::ostringstream failedReport;
+        failed.WriteReport(failedReport, {});
+        const std::string failedJson = failedReport.str();
+        DE_CHECK(failedJson.find("nan") == std::string::npos && failedJson.find("inf") == std::string::npos);
+        DE_CHECK(failedJson.find("\"frameMs\": {\"min\": 16, \"mean\": null, \"p50\": 17,") != std::string::npos);
+        DE_CHECK(failedJson.find("\"cpuMs\": {\"min\": 5, \"mean\": 5, \"p50\": 5, \"p95\": 5, \"p99\": 5, \"max\": 5}") != std::string::npos);
+        DE_CHECK(failedJson.find("\"gpuMs\": {\"min\": 8, \"mean\": null, \"p50\": 8,") != std::string::npos);
+    }
+
+    void TestSettings() {
+        const std::wstring_view disabled[] = {L"--benchmark-frames=10"};
+        DE_CHECK(!BenchmarkSettings::Parse(disabled));
+
+        const std::wstring_view arguments[] = {L"--benchmark", L"--benchmark-frames=250", L"--benchmark-warmup=0", L"--benchmark-report=out/run.json"};
+        const auto settings = BenchmarkSettings::Parse(arguments);
+        DE_CHECK(settings && settings->FrameCount == 250 && settings->WarmupFrameCount == 0);
+        DE_CHECK(settings && settings->ReportPath == std::filesystem::path("out/run.json"));
+
+        const std::wstring_view zero[] = {L"--benchmark", L"--benchmark-frames=0"};
+        const std::wstring_view invalid[] = {L"--benchmark", L"--benchmark-warmup=1e3"};
+        const std::wstring_view tooLarge[] = {L"--benchmark", L"--benchmark-frames=4294967296"};
+        DE_CHECK_THROWS(BenchmarkSettings::Parse(zero), std::invalid_argument);
+        DE_CHECK_THROWS(BenchmarkSettings::Parse(invalid), std::invalid_argument);
+        DE_CHECK_THROWS(BenchmarkSettings::Parse(tooLarge), std::invalid_argument);
+    }
+
+    void TestScriptedCamera() {
+        const CameraKeyframe keyframes[] = {{0.0, {0.0f, 0.0f, 0.0f}}, {1.0, {1.0f, 2.0f, 0.0f}}, {3.0, {4.0f, 0.0f, 1.0f}}, {4.0, {0.0f, 0.0f, 0.0f}}};
+        const ScriptedCamera camera(keyframes);
+        DE_CHECK(camera.GetDuration() == 4.0);
+
+        // The path goes through the keyframes and loops.
+        for (const CameraKeyframe& keyframe : std::span(keyframes).first(3)) {
+            DE_CHECK(camera.Evaluate(keyframe.Time) == keyframe.Position);
+            DE_CHECK(camera.Evaluate(keyframe.Time + 8.0) == keyframe.Position);
+        }
+
+        DE_CHECK(camera.Evaluate(-1.0) == camera.Evaluate(3.0));
+
+        // And is continuous across the keyframes.
+        for (const double time : {1.0, 3.0}) {
+            const auto before = camera.Evaluate(time - 1e-6);
+            const auto after = camera.Evaluate(time + 1e-6);
+            for (uint32_t axis = 0; axis < 3; axis++) {
+                DE_CHECK(std::abs(before[axis] - after[axis]) < 1e-4f);
+            }
+        }
+
+        DE_CHECK_THROWS(ScriptedCamera(std::span(keyframes).first(1)), std::invalid_argument);
+        DE_CHECK_THROWS(ScriptedCamera(std::span(keyframes).subspan(1)), std::invalid_argument);
+        const CameraKeyframe unordered[] = {{0.0, {}}, {2.0, {}}, {2.0, {}}};
+        DE_CHECK_THROWS(ScriptedCamera{unordered}, std::invalid_argument);
+    }
+}
+
+int main() {
+    TestPercentiles();
+    TestAggregation();
+    TestBenchmarkRun();
+    TestSettings();
+    TestScriptedCamera();
+
+    return D3D12Engine::Tests::GetExitCode();
+}
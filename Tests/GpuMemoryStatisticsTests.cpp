@@ -0,0 +1,211 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/RHI/GpuMemoryStatistics.hpp>
+#include <D3D12Engine/RHI/Null/NullRenderDevice.hpp>
+
+#include <TestCheck.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+    using namespace D3D12Engine;
+
+    const std::filesystem::path g_Directory = std::filesystem::temp_directory_path() / "D3D12EngineGpuMemoryStatisticsTests";
+
+    ResourceHandle CreateBuffer(RenderDevice& device, const uint64_t size, const MemoryType memory, const BufferUsage usage = BufferUsage::Generic) {
+        BufferDesc desc;
+        desc.Size = size;
+        desc.Memory = memory;
+        desc.Usage = usage;
+        return device.CreateBuffer(desc);
+    }
+
+    ResourceHandle CreateTexture(RenderDevice& device, const uint32_t width, const uint32_t height, const TextureUsage usage) {
+        TextureDesc desc;
+        desc.Width = width;
+        desc.Height = height;
+        desc.Usage = usage;
+        return device.CreateTexture(desc);
+    }
+
+    // The categories add up to the total, and so do their allocation counts.
+    void CheckTotal(const GpuMemoryStatistics& statistics) {
+        uint64_t bytes = 0;
+        uint32_t allocations = 0;
+        for (uint32_t i = 0; i < static_cast<uint32_t>(GpuMemoryCategory::Count); i++) {
+            bytes += statistics.GetUsage(static_cast<GpuMemoryCategory>(i)).CurrentBytes;
+            allocations += statistics.GetUsage(static_cast<GpuMemoryCategory>(i)).AllocationCount;
+        }
+
+        DE_CHECK(statistics.GetTotalUsage().CurrentBytes == bytes);
+        DE_CHECK(statistics.GetTotalUsage().AllocationCount == allocations);
+        DE_CHECK(statistics.GetTotalUsage().PeakBytes >= bytes);
+    }
+
+    void TestCategories() {
+        BufferDesc desc;
+        desc.Usage = BufferUsage::Vertex;
+        DE_CHECK(GetMemoryCategory(desc) == GpuMemoryCategory::VertexBuffer);
+        desc.Usage = BufferUsage::Index;
+        desc.Memory = MemoryType::Default;
+        DE_CHECK(GetMemoryCategory(desc) == GpuMemoryCategory::IndexBuffer);
+
+        // Other buffers go by their memory type.
+        desc.Usage = BufferUsage::Generic;
+        DE_CHECK(GetMemoryCategory(desc) == GpuMemoryCategory::Buffer);
+        desc.Memory = MemoryType::Upload;
+        DE_CHECK(GetMemoryCategory(desc) == GpuMemoryCategory::UploadBuffer);
+        desc.Memory = MemoryType::Readback;
+        DE_CHECK(GetMemoryCategory(desc) == GpuMemoryCategory::ReadbackBuffer);
+
+        DE_CHECK(GetMemoryCategory(TextureUsage::ShaderResource) == GpuMemoryCategory::Texture);
+        DE_CHECK(GetMemoryCategory(TextureUsage::ShaderResource | TextureUsage::RenderTarget) == GpuMemoryCategory::RenderTarget);
+
+        DE_CHECK(GetCategoryName(GpuMemoryCategory::DescriptorHeap) == "descriptorHeap");
+        DE_CHECK(GetCategoryName(GpuMemoryCategory::Count) == "unknown");
+    }
+
+    void TestAggregation() {
+        NullRenderDevice device;
+        const GpuMemoryStatistics& statistics = device.GetMemoryStatistics();
+
+        const ResourceHandle vertices = CreateBuffer(device, 4096, MemoryType::Upload, BufferUsage::Vertex);
+        const ResourceHandle indices = CreateBuffer(device, 1024, MemoryType::Upload, BufferUsage::Index);
+        const ResourceHandle arguments = CreateBuffer(device, 640, MemoryType::Upload);
+        const ResourceHandle readback = CreateBuffer(device, 256, MemoryType::Readback);
+        const ResourceHandle scratch = CreateBuffer(device, 8192, MemoryType::Default);
+        const ResourceHandle albedo = CreateTexture(device, 64, 32, TextureUsage::ShaderResource);
+        const ResourceHandle target = CreateTexture(device, 128, 64, TextureUsage::RenderTarget | TextureUsage::ShaderResource);
+
+        DE_CHECK(statistics.GetUsage(GpuMemoryCategory::VertexBuffer).CurrentBytes == 4096);
+        DE_CHECK(statistics.GetUsage(GpuMemoryCategory::IndexBuffer).CurrentBytes == 1024);
+        DE_CHECK(statistics.GetUsage(GpuMemoryCategory::UploadBuffer).CurrentBytes == 640);
+        DE_CHECK(statistics.GetUsage(GpuMemoryCategory::ReadbackBuffer).CurrentBytes == 256);
+        DE_CHECK(statistics.GetUsage(GpuMemoryCategory::Buffer).CurrentBytes == 8192);
+        DE_CHECK(statistics.GetUsage(GpuMemoryCategory::Texture).CurrentBytes == 64 * 32 * 4);
+        DE_CHECK(statistics.GetUsage(GpuMemoryCategory::RenderTarget).CurrentBytes == 128 * 64 * 4);
+        DE_CHECK(statistics.GetTotalUsage().AllocationCount == 7);
+        DE_CHECK(statistics.GetAllocationSize(albedo) == 64 * 32 * 4);
+        CheckTotal(statistics);
+
+        // Releases lower the current bytes, the peaks stay.
+        const uint64_t peak = statistics.GetTotalUsage().CurrentBytes;
+        device.DestroyResource(scratch);
+        device.DestroyResource(target);
+        DE_CHECK(statistics.GetUsage(GpuMemoryCategory::Buffer).CurrentBytes == 0);
+        DE_CHECK(statistics.GetUsage(GpuMemoryCategory::Buffer).PeakBytes == 8192);
+        DE_CHECK(statistics.GetUsage(GpuMemoryCategory::RenderTarget).AllocationCount == 0);
+        DE_CHECK(statistics.GetTotalUsage().PeakBytes == peak);
+        DE_CHECK(statistics.GetAllocationSize(scratch) == 0);
+        CheckTotal(statistics);
+
+        // A reused handle is recorded with its new size and category.
+        const ResourceHandle reused = CreateBuffer(device, 512, MemoryType::Upload, BufferUsage::Vertex);
+        DE_CHECK(reused.Index == target.Index || reused.Index == scratch.Index);
+        DE_CHECK(statistics.GetAllocationSize(reused) == 512);
+        DE_CHECK(statistics.GetUsage(GpuMemoryCategory::VertexBuffer).AllocationCount == 2);
+        CheckTotal(statistics);
+
+        for (const ResourceHandle resource : {vertices, indices, arguments, readback, albedo, reused}) {
+            device.DestroyResource(resource);
+        }
+
+        DE_CHECK(statistics.GetTotalUsage().CurrentBytes == 0 && statistics.GetTotalUsage().AllocationCount == 0);
+        DE_CHECK(statistics.GetTotalUsage().PeakBytes == peak);
+        CheckTotal(statistics);
+    }
+
+    void TestRecording() {
+        GpuMemoryStatistics statistics;
+        statistics.RecordAllocation({3}, GpuMemoryCategory::Texture, 100);
+        DE_CHECK_THROWS(statistics.RecordAllocation({3}, GpuMemoryCategory::Texture, 100), std::invalid_argument);
+        DE_CHECK_THROWS(statistics.RecordRelease({2}), std::invalid_argument);
+        DE_CHECK_THROWS(statistics.RecordRelease({30}), std::invalid_argument);
+        statistics.RecordRelease({3});
+        DE_CHECK_THROWS(statistics.RecordRelease({3}), std::invalid_argument);
+
+        // Memory living as long as the device has no handle.
+        statistics.RecordAllocation(GpuMemoryCategory::DescriptorHeap, 32 * 1024);
+        DE_CHECK(statistics.GetUsage(GpuMemoryCategory::DescriptorHeap).AllocationCount == 1);
+        DE_CHECK(statistics.GetTotalUsage().CurrentBytes == 32 * 1024);
+        CheckTotal(statistics);
+
+        // Transient memory adds up within a frame, the largest frame is kept.
+        for (const uint64_t frameBytes : {300u, 1000u, 200u}) {
+            statistics.BeginFrame();
+            statistics.RecordTransient(frameBytes / 2);
+            statistics.RecordTransient(frameBytes / 2);
+            DE_CHECK(statistics.GetFrameTransientBytes() == frameBytes);
+        }
+
+        DE_CHECK(statistics.GetPeakFrameTransientBytes() == 1000);
+        DE_CHECK(statistics.GetFrameCount() == 3);
+
+        statistics.SetBudget({4000, 1000, 2000, 0}, {16000, 10, 8000, 0});
+        DE_CHECK(statistics.GetLocalBudget().Budget == 4000 && statistics.GetNonLocalBudget().CurrentUsage == 10);
+    }
+
+    void TestReport() {
+        GpuMemoryStatistics statistics;
+        statistics.RecordAllocation({0}, GpuMemoryCategory::VertexBuffer, 4096);
+        statistics.RecordAllocation({1}, GpuMemoryCategory::RenderTarget, 8192);
+        statistics.RecordRelease({1});
+        statistics.BeginFrame();
+        statistics.RecordTransient(640);
+        statistics.SetBudget({1 << 30, 12288, 1 << 29, 0}, {});
+
+        std::ostringstream stream;
+        statistics.WriteReport(stream);
+        const std::string report = stream.str();
+        DE_CHECK(report.find("\"frames\": 1,") != std::string::npos);
+        DE_CHECK(report.find("\"total\": {\"current\": 4096, \"peak\": 12288, \"allocations\": 1}") != std::string::npos);
+        DE_CHECK(report.find("\"vertexBuffer\": {\"current\": 4096, \"peak\": 4096, \"allocations\": 1}") != std::string::npos);
+        DE_CHECK(report.find("\"renderTarget\": {\"current\": 0, \"peak\": 8192, \"allocations\": 0}") != std::string::npos);
+        DE_CHECK(report.find("\"transient\": {\"frame\": 640, \"peakFrame\": 640}") != std::string::npos);
+        DE_CHECK(report.find("\"local\": {\"budget\": 1073741824, \"currentUsage\": 12288") != std::string::npos);
+
+        std::filesystem::create_directories(g_Directory);
+        const std::filesystem::path path = g_Directory / "gpu_memory.json";
+        statistics.WriteReport(path);
+        std::ifstream file(path);
+        DE_CHECK(std::string(std::istreambuf_iterator<char>(file), {}) == report);
+        DE_CHECK_THROWS(statistics.WriteReport(g_Directory / "missing" / "gpu_memory.json"), std::runtime_error);
+    }
+
+    void TestSettings() {
+        const std::wstring_view disabled[] = {L"--benchmark"};
+        DE_CHECK(!GpuMemoryReportSettings::Parse(disabled));
+
+        const std::wstring_view defaults[] = {L"--memory-report"};
+        const auto settings = GpuMemoryReportSettings::Parse(defaults);
+        DE_CHECK(settings && settings->Path == "gpu_memory.json" && settings->IntervalSeconds == 5.0);
+
+        const std::wstring_view path[] = {L"--memory-report=out/memory.json"};
+        DE_CHECK(GpuMemoryReportSettings::Parse(path)->Path == std::filesystem::path("out/memory.json"));
+
+        const std::wstring_view empty[] = {L"--memory-report="};
+        DE_CHECK_THROWS(GpuMemoryReportSettings::Parse(empty), std::invalid_argument);
+    }
+}
+
+int main() {
+    std::filesystem::remove_all(g_Directory);
+
+    TestCategories();
+    TestAggregation();
+    TestRecording();
+    TestReport();
+    TestSettings();
+
+    std::filesystem::remove_all(g_Directory);
+
+    return D3D12Engine::Tests::GetExitCode();
+}
@@ -0,0 +1,183 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/Core/InputEventQueue.hpp>
+#include <D3D12Engine/Core/SpscRing.hpp>
+
+#include <TestCheck.hpp>
+
+#include <cmath>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+    using namespace D3D12Engine;
+
+    void TestRing() {
+        DE_CHECK_THROWS(SpscRing<uint32_t>(0), std::invalid_argument);
+
+        SpscRing<uint32_t> ring(5);
+        DE_CHECK(ring.GetCapacity() == 8);
+        DE_CHECK(ring.Peek() == nullptr && !ring.TryPop());
+
+        // Fills up, then gives the oldest element back first.
+        for (uint32_t i = 0; i < 8; i++) {
+            DE_CHECK(ring.TryPush(i));
+        }
+
+        DE_CHECK(!ring.TryPush(8));
+        DE_CHECK(ring.GetSize() == 8);
+        DE_CHECK(ring.Peek() != nullptr && *ring.Peek() == 0);
+        ring.Pop();
+        DE_CHECK(ring.TryPush(8));
+        DE_CHECK(!ring.TryPush(9));
+
+        // Many times around the ring, with the size going up and down.
+        uint32_t next = 1;
+        uint32_t pushed = 9;
+        for (uint32_t round = 0; round < 1000; round++) {
+            for (uint32_t i = 0; i < round % 5 && ring.TryPush(pushed); i++) {
+                pushed++;
+            }
+
+            for (uint32_t i = 0; i < round % 4; i++) {
+                if (const auto value = ring.TryPop()) {
+                    DE_CHECK(*value == next);
+                    next++;
+                }
+            }
+
+            DE_CHECK(ring.GetSize() == pushed - next);
+        }
+    }
+
+    void TestRingThreads(const uint32_t count) {
+        SpscRing<uint64_t> ring(64);
+
+        // Small enough to be full or empty often, both sides go through their slow paths.
+        std::thread producer([&] {
+            for (uint64_t i = 0; i < count; i++) {
+                while (!ring.TryPush(i * 3 + 1)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+
+        uint64_t expected = 0;
+        bool inOrder = true;
+        while (expected < count) {
+            if (const auto value = ring.TryPop()) {
+                inOrder &= *value == expected * 3 + 1;
+                expected++;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+
+        producer.join();
+        DE_CHECK(inOrder);
+        DE_CHECK(ring.GetSize() == 0);
+    }
+
+    InputEvent MakeEvent(const double time, const uint32_t id) {
+        return {time, 0x0200, id, 0};
+    }
+
+    void TestStepBucketing() {
+        constexpr double Step = 1.0 / 60.0;
+        InputEventQueue queue;
+
+        // 50 events at 1 ms intervals, received while the simulation was at 0.
+        queue.Synchronize(10.0, 0.0);
+        for (uint32_t i = 0; i < 50; i++) {
+            queue.Push(MakeEvent(10.0 + i * 0.001, i));
+        }
+
+        DE_CHECK(std::abs(queue.ToSimulationTime(10.5) - 0.5) < 1e-12);
+        DE_CHECK(std::abs(queue.ToTime(0.5) - 10.5) < 1e-12);
+
+        // Each step gets the events received before it ends, at their own time.
+        uint32_t next = 0;
+        const uint32_t expectedCounts[] = {17, 17, 16};
+        for (uint32_t step = 0; step < 3; step++) {
+            const size_t count = queue.DrainStep(step * Step, (step + 1) * Step, [&](const InputEvent& event, const double time) {
+                DE_CHECK(event.WParam == next);
+                DE_CHECK(time >= step * Step && time <= (step + 1) * Step);
+                DE_CHECK(std::abs(time - next * 0.001) < 1e-9);
+                next++;
+            });
+
+            DE_CHECK(count == expectedCounts[step]);
+        }
+
+        // Events after the last step wait for the next one.
+        queue.Push(MakeEvent(10.06, 50));
+        DE_CHECK(queue.DrainStep(3 * Step, 3 * Step + 0.005, [](const InputEvent&, double) {}) == 0);
+        DE_CHECK(queue.GetPendingCount() == 1);
+
+        // The simulation fell behind and was re-anchored: the late event belongs to an old step,
+        // the step it's drained in reports it at its start.
+        queue.Synchronize(10.2, 0.1);
+        double reported = -1.0;
+        DE_CHECK(queue.DrainStep(0.2, 0.2 + Step, [&](const InputEvent&, const double time) { reported = time; }) == 1);
+        DE_CHECK(reported == 0.2);
+        DE_CHECK(queue.GetPendingCount() == 0);
+    }
+
+    void TestDroppedEvents() {
+        InputEventQueue queue(4);
+        for (uint32_t i = 0; i < 6; i++) {
+            DE_CHECK(queue.Push(MakeEvent(i, i)) == (i < 4));
+        }
+
+        DE_CHECK(queue.GetPendingCount() == 4);
+        DE_CHECK(queue.GetDroppedCount() == 2);
+
+        // Draining makes room again.
+        DE_CHECK(queue.DrainStep(0.0, 1.5, [](const InputEvent&, double) {}) == 2);
+        DE_CHECK(queue.Push(MakeEvent(4, 4)));
+        DE_CHECK(queue.GetDroppedCount() == 2);
+    }
+
+    void TestQueueThreads() {
+        constexpr uint32_t EventCount = 20'000;
+        InputEventQueue queue(256);
+
+        // The window thread stamps events with increasing times, the simulation drains
+        // step after step until it saw all of them.
+        std::thread window([&] {
+            for (uint32_t i = 0; i < EventCount; i++) {
+                while (!queue.Push(MakeEvent(i * 0.0001, i))) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+
+        uint32_t next = 0;
+        bool inOrder = true;
+        for (uint32_t step = 0; next < EventCount; step++) {
+            queue.DrainStep(step * 0.001, (step + 1) * 0.001, [&](const InputEvent& event, const double time) {
+                inOrder &= event.WParam == next && time <= (step + 1) * 0.001;
+                next++;
+            });
+
+            std::this_thread::yield();
+        }
+
+        window.join();
+        DE_CHECK(inOrder);
+        DE_CHECK(queue.GetPendingCount() == 0);
+    }
+}
+
+int main() {
+    TestRing();
+    TestRingThreads(200'000);
+    TestStepBucketing();
+    TestDroppedEvents();
+    TestQueueThreads();
+
+    return D3D12Engine::Tests::GetExitCode();
+}
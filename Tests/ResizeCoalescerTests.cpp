@@ -0,0 +1,143 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/Core/ResizeCoalescer.hpp>
+
+#include <TestCheck.hpp>
+
+#include <optional>
+#include <vector>
+
+namespace {
+    using namespace D3D12Engine;
+
+    struct AppliedResize {
+        WindowSize Size;
+        double Time;
+    };
+
+    struct DragResult {
+        std::vector<AppliedResize> Applied;
+        WindowSize LastSize;
+        double LastEventTime;
+    };
+
+    // A window dragged from its size by growing both axes every event, polled once per frame.
+    DragResult SimulateDrag(ResizeCoalescer& coalescer, const double eventInterval, const double duration,
+                            const double frameInterval, double& time) {
+        DragResult result{{}, coalescer.GetCurrentSize(), time};
+        const WindowSize start = coalescer.GetCurrentSize();
+        double nextEvent = time;
+        uint32_t step = 0;
+
+        for (const double end = time + duration; time < end; time += frameInterval) {
+            while (nextEvent <= time) {
+                step++;
+                result.LastSize = {start.Width + step, start.Height + step};
+                result.LastEventTime = nextEvent;
+                coalescer.OnResize(result.LastSize, nextEvent);
+                nextEvent += eventInterval;
+            }
+
+            if (const auto size = coalescer.Poll(time)) {
+                result.Applied.push_back({*size, time});
+            }
+        }
+
+        return result;
+    }
+
+    void TestAppliesImmediatelyOutsideDrags() {
+        ResizeCoalescer coalescer({800, 600});
+        DE_CHECK(!coalescer.Poll(0.0));
+
+        coalescer.OnResize({1024, 768}, 1.0);
+        coalescer.OnResize({1280, 720}, 1.0);
+        DE_CHECK(coalescer.Poll(1.0) == WindowSize(1280, 720));
+        DE_CHECK(coalescer.GetCurrentSize() == WindowSize(1280, 720));
+        DE_CHECK(!coalescer.Poll(1.1));
+
+        // Minimizing reports a zero size, and same-size notifications change nothing.
+        coalescer.OnResize({0, 0}, 2.0);
+        coalescer.OnResize({1280, 720}, 2.0);
+        DE_CHECK(!coalescer.Poll(2.0));
+
+        // Going back to the current size cancels what was pending.
+        coalescer.OnResize({640, 480}, 3.0);
+        coalescer.OnResize({1280, 720}, 3.0);
+        DE_CHECK(!coalescer.Poll(3.0));
+    }
+
+    void TestCoalescesDrags() {
+        const ResizeCoalescerSettings settings;
+        ResizeCoalescer coalescer({800, 600}, settings);
+        double time = 10.0;
+
+        // Two seconds of dragging, a notification every 8 ms and a frame every 16 ms.
+        coalescer.OnBeginInteractiveResize();
+        const DragResult drag = SimulateDrag(coalescer, 0.008, 2.0, 0.016, time);
+        const auto& applied = drag.Applied;
+
+        // Instead of 250 resizes, about one per MaxIntervalSeconds so the image keeps up.
+        DE_CHECK(applied.size() >= 7 && applied.size() <= 9);
+        for (size_t i = 1; i < applied.size(); i++) {
+            const double interval = applied[i].Time - applied[i - 1].Time;
+            DE_CHECK(interval >= settings.MaxIntervalSeconds - 1e-9);
+            // The interval starts at the first change after a resize, which the next frame sees.
+            DE_CHECK(interval <= settings.MaxIntervalSeconds + 2 * 0.016 + 1e-9);
+        }
+
+        // The drag pauses with the button still down, the last size lands once it settled.
+        std::optional<WindowSize> settled;
+        double settledTime = 0.0;
+        for (; time < 13.0 && !settled; time += 0.016) {
+            settled = coalescer.Poll(time);
+            settledTime = time;
+        }
+
+        DE_CHECK(settled == drag.LastSize);
+        DE_CHECK(settledTime - drag.LastEventTime <= settings.SettleTimeSeconds + 0.016 + 1e-9);
+
+        coalescer.OnEndInteractiveResize();
+        DE_CHECK(!coalescer.Poll(time));
+    }
+
+    void TestReleaseAppliesPendingSize() {
+        ResizeCoalescer coalescer({800, 600});
+        double time = 0.0;
+
+        coalescer.OnBeginInteractiveResize();
+        SimulateDrag(coalescer, 0.008, 0.1, 0.016, time);
+        coalescer.OnResize({1000, 700}, time);
+        DE_CHECK(!coalescer.Poll(time));
+
+        // Letting go of the border applies the final size right away.
+        coalescer.OnEndInteractiveResize();
+        DE_CHECK(coalescer.Poll(time) == WindowSize(1000, 700));
+        DE_CHECK(!coalescer.IsInteractive());
+    }
+
+    void TestSlowEventsApplyEach() {
+        // Events further apart than the settle time are each worth a resize.
+        ResizeCoalescer coalescer({800, 600});
+        double time = 0.0;
+
+        coalescer.OnBeginInteractiveResize();
+        const auto applied = SimulateDrag(coalescer, 0.1, 1.0, 0.016, time).Applied;
+
+        DE_CHECK(applied.size() == 10);
+        for (size_t i = 0; i < applied.size(); i++) {
+            DE_CHECK(applied[i].Size == WindowSize(801 + static_cast<uint32_t>(i), 601 + static_cast<uint32_t>(i)));
+        }
+    }
+}
+
+int main() {
+    TestAppliesImmediatelyOutsideDrags();
+    TestCoalescesDrags();
+    TestReleaseAppliesPendingSize();
+    TestSlowEventsApplyEach();
+
+    return D3D12Engine::Tests::GetExitCode();
+}
@@ -0,0 +1,280 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/RHI/Null/NullCommandRecorder.hpp>
+#include <D3D12Engine/RHI/ResourceStateTracker.hpp>
+
+#include <TestCheck.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+    using namespace D3D12Engine;
+
+    // Barriers recorded into a stream, read back one flush at a time.
+    class BarrierRecorder {
+    public:
+        BarrierRecorder() : m_Recorder(m_Stream) {}
+
+        std::vector<ResourceTransition> Flush(ResourceStateTracker& states) {
+            m_Stream.Reset();
+            states.FlushBarriers(m_Recorder);
+
+            std::vector<ResourceTransition> transitions;
+            m_Stream.ForEach([&](RecordedCommand, const std::span<const std::byte> payload) {
+                const size_t count = (payload.size() - sizeof(RecordedCommands::ResourceBarrier)) / sizeof(ResourceTransition);
+                transitions.resize(count);
+                std::memcpy(transitions.data(), payload.data() + sizeof(RecordedCommands::ResourceBarrier), count * sizeof(ResourceTransition));
+            });
+
+            DE_CHECK(m_Stream.GetCommandCount() <= 1);
+            return transitions;
+        }
+
+    private:
+        CommandStream m_Stream;
+        NullCommandRecorder m_Recorder;
+    };
+
+    struct Requirement {
+        ResourceHandle Resource;
+        ResourceState State;
+        uint32_t Subresource;
+    };
+
+    // What the GPU sees: every transition must start from the actual state, and every
+    // command must find its resources in the states it asked for.
+    class StateModel {
+    public:
+        void Add(const ResourceHandle resource, const ResourceState state, const uint32_t subresourceCount) {
+            m_States.resize(std::max<size_t>(m_States.size(), resource.Index + 1));
+            m_States[resource.Index].assign(subresourceCount, state);
+        }
+
+        void Apply(const ResourceTransition& transition) {
+            for (ResourceState& state : GetStates(transition.Resource, transition.Subresource)) {
+                DE_CHECK(state == transition.Before);
+                state = transition.After;
+            }
+        }
+
+        void CheckRequirement(const Requirement& requirement) {
+            for (const ResourceState state : GetStates(requirement.Resource, requirement.Subresource)) {
+                if (IsReadOnlyState(requirement.State)) {
+                    DE_CHECK(IsReadOnlyState(state) && (state & requirement.State) == requirement.State);
+                } else {
+                    DE_CHECK(state == requirement.State);
+                }
+            }
+        }
+
+        void CheckRegistry(const ResourceStateRegistry& registry) const {
+            for (uint32_t index = 0; index < m_States.size(); index++) {
+                for (uint32_t i = 0; i < m_States[index].size(); i++) {
+                    DE_CHECK(registry.GetState({index}, i) == m_States[index][i]);
+                }
+            }
+        }
+
+    private:
+        std::span<ResourceState> GetStates(const ResourceHandle resource, const uint32_t subresource) {
+            std::vector<ResourceState>& states = m_States[resource.Index];
+            if (subresource == ResourceTransition::AllSubresources) {
+                return states;
+            }
+
+            return std::span(states).subspan(subresource, 1);
+        }
+
+        std::vector<std::vector<ResourceState>> m_States;
+    };
+
+    void TestMerging() {
+        ResourceStateRegistry registry;
+        const ResourceHandle a{0};
+        const ResourceHandle b{1};
+        registry.Register(a, ResourceState::PixelShaderResource);
+        registry.Register(b, ResourceState::PixelShaderResource);
+
+        BarrierRecorder recorder;
+        ResourceStateTracker states(registry);
+
+        // First uses aren't barriers, they wait for Resolve().
+        states.Require(a, ResourceState::RenderTarget);
+        states.Require(b, ResourceState::RenderTarget);
+        DE_CHECK(recorder.Flush(states).empty());
+
+        // Going there and back before the flush cancels out, whatever was queued in between.
+        states.Require(a, ResourceState::PixelShaderResource);
+        states.Require(b, ResourceState::PixelShaderResource);
+        states.Require(a, ResourceState::RenderTarget);
+        DE_CHECK(states.GetPendingBarriers().size() == 1);
+        states.Require(b, ResourceState::RenderTarget);
+        DE_CHECK(states.GetPendingBarriers().empty());
+
+        // Successive transitions of a resource merge into one.
+        states.Require(b, ResourceState::UnorderedAccess);
+        states.Require(a, ResourceState::CopyDest);
+        states.Require(b, ResourceState::PixelShaderResource);
+        const auto merged = recorder.Flush(states);
+        DE_CHECK(merged.size() == 2);
+        DE_CHECK(merged[0].Resource == b && merged[0].Before == ResourceState::RenderTarget && merged[0].After == ResourceState::PixelShaderResource);
+        DE_CHECK(merged[1].Resource == a && merged[1].After == ResourceState::CopyDest);
+
+        // Reads combine, a later read of either kind needs nothing.
+        states.Require(b, ResourceState::NonPixelShaderResource);
+        states.Require(b, ResourceState::PixelShaderResource);
+        const auto combined = recorder.Flush(states);
+        DE_CHECK(combined.size() == 1);
+        DE_CHECK(combined[0].After == (ResourceState::PixelShaderResource | ResourceState::NonPixelShaderResource));
+        DE_CHECK(states.GetBarrierCount() == 3);
+        DE_CHECK(states.GetBarrierBatchCount() == 2);
+
+        std::pmr::vector<ResourceTransition> transitions;
+        states.Resolve(transitions);
+        DE_CHECK(transitions.size() == 2);
+        DE_CHECK(registry.GetState(a) == ResourceState::CopyDest);
+    }
+
+    void TestSubresources() {
+        ResourceStateRegistry registry;
+        const ResourceHandle texture{0};
+        registry.Register(texture, ResourceState::PixelShaderResource, 4);
+
+        BarrierRecorder recorder;
+        ResourceStateTracker states(registry);
+        states.Require(texture, ResourceState::PixelShaderResource);
+
+        // Mips 0 and 1 written, then mip 0 read: the last transition can't merge into the first
+        // with another mip's in between.
+        states.Require(texture, ResourceState::RenderTarget, 0);
+        states.Require(texture, ResourceState::RenderTarget, 1);
+        states.Require(texture, ResourceState::CopySource, 0);
+        const auto transitions = recorder.Flush(states);
+        DE_CHECK(transitions.size() == 3);
+        DE_CHECK(transitions[0].Subresource == 0 && transitions[0].After == ResourceState::RenderTarget);
+        DE_CHECK(transitions[2].Subresource == 0 && transitions[2].Before == ResourceState::RenderTarget);
+
+        // The mips are in different states, each gets its own transition.
+        states.Require(texture, ResourceState::CopyDest);
+        const auto mips = recorder.Flush(states);
+        DE_CHECK(mips.size() == 4);
+        DE_CHECK(mips[1].Subresource == 1 && mips[1].Before == ResourceState::RenderTarget);
+
+        // Once the mips agree again, one transition covers them all.
+        states.Require(texture, ResourceState::RenderTarget);
+        const auto whole = recorder.Flush(states);
+        DE_CHECK(whole.size() == 1 && whole[0].Subresource == ResourceTransition::AllSubresources);
+
+        // Unflushed barriers can't be resolved.
+        states.Require(texture, ResourceState::CopyDest, 2);
+        std::pmr::vector<ResourceTransition> resolved;
+        DE_CHECK_THROWS(states.Resolve(resolved), std::runtime_error);
+    }
+
+    // Command lists of random commands recorded up front, then submitted in order and
+    // replayed against the model.
+    void TestRandomLists(const uint32_t resourceCount, const uint32_t commandCount, const uint32_t seed) {
+        constexpr ResourceState States[] = {ResourceState::RenderTarget, ResourceState::UnorderedAccess, ResourceState::PixelShaderResource,
+                                            ResourceState::NonPixelShaderResource, ResourceState::CopyDest, ResourceState::CopySource,
+                                            ResourceState::IndirectArgument};
+        constexpr uint32_t ListCount = 4;
+
+        std::mt19937 random(seed);
+        ResourceStateRegistry registry;
+        StateModel model;
+        std::vector<uint32_t> subresourceCounts;
+        for (uint32_t i = 0; i < resourceCount; i++) {
+            const uint32_t subresourceCount = i % 3 == 0 ? 4 : 1;
+            const ResourceState state = States[random() % std::size(States)];
+            registry.Register({i}, state, subresourceCount);
+            model.Add({i}, state, subresourceCount);
+            subresourceCounts.push_back(subresourceCount);
+        }
+
+        struct Command {
+            std::vector<Requirement> Requirements;
+            std::vector<ResourceTransition> Barriers;
+            bool Flushed = false;
+        };
+
+        std::vector<std::unique_ptr<ResourceStateTracker>> lists;
+        std::vector<std::vector<Command>> commands(ListCount);
+        BarrierRecorder recorder;
+        for (uint32_t list = 0; list < ListCount; list++) {
+            lists.push_back(std::make_unique<ResourceStateTracker>(registry));
+            for (uint32_t i = 0; i < commandCount; i++) {
+                Command command;
+                const uint32_t first = random() % resourceCount;
+                for (uint32_t resource = first; resource < std::min<uint32_t>(first + 1 + random() % 8, resourceCount); resource++) {
+                    const bool whole = subresourceCounts[resource] == 1 || random() % 2;
+                    const uint32_t subresource = whole ? ResourceTransition::AllSubresources : random() % subresourceCounts[resource];
+                    command.Requirements.push_back({{resource}, States[random() % std::size(States)], subresource});
+                    lists[list]->Require({resource}, command.Requirements.back().State, subresource);
+                }
+
+                // Some commands share a barrier batch with the next one.
+                command.Flushed = random() % 4 != 0 || i + 1 == commandCount;
+                if (command.Flushed) {
+                    command.Barriers = recorder.Flush(*lists[list]);
+                }
+
+                commands[list].push_back(std::move(command));
+            }
+        }
+
+        for (uint32_t list = 0; list < ListCount; list++) {
+            std::pmr::vector<ResourceTransition> transitions;
+            lists[list]->Resolve(transitions);
+            for (const ResourceTransition& transition : transitions) {
+                model.Apply(transition);
+            }
+
+            // A batch only runs once the commands sharing it were recorded, check them after it.
+            std::vector<Requirement> waiting;
+            for (const Command& command : commands[list]) {
+                waiting.insert(waiting.end(), command.Requirements.begin(), command.Requirements.end());
+                if (!command.Flushed) {
+                    continue;
+                }
+
+                for (const ResourceTransition& transition : command.Barriers) {
+                    DE_CHECK(transition.Before != transition.After);
+                    model.Apply(transition);
+                }
+
+                // Only the last requirement of each subresource in the batch holds afterwards.
+                for (size_t i = 0; i < waiting.size(); i++) {
+                    const bool overridden = std::any_of(waiting.begin() + static_cast<ptrdiff_t>(i) + 1, waiting.end(), [&](const Requirement& later) {
+                        return later.Resource == waiting[i].Resource;
+                    });
+
+                    if (!overridden) {
+                        model.CheckRequirement(waiting[i]);
+                    }
+                }
+
+                waiting.clear();
+            }
+        }
+
+        model.CheckRegistry(registry);
+    }
+}
+
+int main() {
+    TestMerging();
+    TestSubresources();
+    TestRandomLists(16, 200, 1);
+    TestRandomLists(64, 500, 2);
+    // Large batches, where merging has to stay cheap.
+    TestRandomLists(20'000, 50, 3);
+
+    return D3D12Engine::Tests::GetExitCode();
+}
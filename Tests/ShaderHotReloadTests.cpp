@@ -0,0 +1,197 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/Assets/ShaderHotReloader.hpp>
+
+#include <TestCheck.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace {
+    using namespace D3D12Engine;
+
+    const std::filesystem::path g_Directory = std::filesystem::temp_directory_path() / "D3D12EngineShaderHotReloadTests";
+
+    // Write times are set explicitly, back to back writes could otherwise share a timestamp.
+    void WriteFile(const std::filesystem::path& path, const std::string& contents, const int64_t second) {
+        std::filesystem::create_directories(path.parent_path());
+        std::ofstream(path, std::ios::binary) << contents;
+        std::filesystem::last_write_time(path, std::filesystem::file_time_type(std::chrono::seconds(1'700'000'000 + second)));
+    }
+
+    std::vector<std::filesystem::path> Poll(FileWatcher& watcher) {
+        std::vector<std::filesystem::path> changed;
+        watcher.Poll(changed);
+        return changed;
+    }
+
+    std::vector<std::filesystem::path> Sorted(std::vector<std::filesystem::path> paths) {
+        std::ranges::sort(paths);
+        return paths;
+    }
+
+    void TestFindIncludes() {
+        const std::string source = "#include \"common.hlsli\"\n"
+                                   "  #  include <lighting/brdf.hlsli>\n"
+                                   "// #include \"commented.hlsli\"\n"
+                                   "/* #include \"block.hlsli\"\n"
+                                   "#include \"still_block.hlsli\" */ #include \"after_block.hlsli\"\n"
+                                   "float x; #include \"mid_line.hlsli\"\n"
+                                   "#include \"unterminated.hlsli\n"
+                                   "#define INCLUDE_X\n"
+                                   "#if 0\n"
+                                   "#include \"disabled.hlsli\"\n"
+                                   "#endif\n";
+
+        // Directives after a block comment on the same line are still at the start of it, and
+        // conditional compilation isn't evaluated.
+        const std::vector<std::string> expected = {"common.hlsli", "lighting/brdf.hlsli", "after_block.hlsli", "disabled.hlsli"};
+        DE_CHECK(ShaderDependencyGraph::FindIncludes(source) == expected);
+        DE_CHECK(ShaderDependencyGraph::FindIncludes("").empty());
+        DE_CHECK(ShaderDependencyGraph::FindIncludes("/* unterminated").empty());
+
+        const std::filesystem::path resolved = ShaderDependencyGraph::ResolveInclude("shaders/passes/scene.hlsl", "../common/./math.hlsli");
+        DE_CHECK(resolved == ShaderDependencyGraph::Normalize("shaders/common/math.hlsli"));
+    }
+
+    void TestDependencyGraph() {
+        ShaderDependencyGraph graph;
+        graph.AddProgram("scene.hlsl");
+        graph.AddProgram("upscale.hlsl");
+        graph.AddProgram("lonely.hlsl");
+
+        // Diamond through common, with an include cycle the walk has to end.
+        const std::filesystem::path sceneIncludes[] = {"common.hlsli", "lighting.hlsli"};
+        const std::filesystem::path lightingIncludes[] = {"common.hlsli", "math.hlsli"};
+        const std::filesystem::path mathIncludes[] = {"lighting.hlsli"};
+        const std::filesystem::path upscaleIncludes[] = {"./sub/../common.hlsli"};
+        graph.SetIncludes("scene.hlsl", sceneIncludes);
+        graph.SetIncludes("lighting.hlsli", lightingIncludes);
+        graph.SetIncludes("math.hlsli", mathIncludes);
+        graph.SetIncludes("upscale.hlsl", upscaleIncludes);
+        DE_CHECK(graph.GetFileCount() == 6);
+
+        const auto affected = [&](const std::filesystem::path& file) {
+            return Sorted(graph.GetAffectedPrograms({&file, 1}));
+        };
+
+        DE_CHECK(affected("common.hlsli") == Sorted({"scene.hlsl", "upscale.hlsl"}));
+        DE_CHECK(affected("math.hlsli") == std::vector<std::filesystem::path>{"scene.hlsl"});
+        DE_CHECK(affected("lonely.hlsl") == std::vector<std::filesystem::path>{"lonely.hlsl"});
+        DE_CHECK(affected("unknown.hlsli").empty());
+
+        // Includes are replaced, the edges that went away don't count anymore.
+        graph.SetIncludes("scene.hlsl", std::span(sceneIncludes).first(1));
+        DE_CHECK(affected("math.hlsli").empty());
+        DE_CHECK(affected("common.hlsli") == Sorted({"scene.hlsl", "upscale.hlsl"}));
+    }
+
+    void TestDebounce() {
+        const std::filesystem::path path = g_Directory / "watched.hlsl";
+        const std::filesystem::path missing = g_Directory / "created_later.hlsl";
+        WriteFile(path, "v1", 0);
+
+        FileWatcher watcher;
+        watcher.Watch(path);
+        watcher.Watch(path);
+        watcher.Watch(missing);
+        DE_CHECK(watcher.GetWatchCount() == 2);
+        DE_CHECK(Poll(watcher).empty());
+
+        // A change is reported once it held for a whole poll.
+        WriteFile(path, "v2", 1);
+        DE_CHECK(Poll(watcher).empty());
+        DE_CHECK(Poll(watcher) == std::vector{path});
+        DE_CHECK(Poll(watcher).empty());
+
+        // A file saved in several steps is reported once, after the last one.
+        WriteFile(path, "v3, partial", 2);
+        DE_CHECK(Poll(watcher).empty());
+        WriteFile(path, "v3, partial then complete", 3);
+        DE_CHECK(Poll(watcher).empty());
+        DE_CHECK(Poll(watcher) == std::vector{path});
+
+        // Changed and changed back between polls, nothing to report.
+        WriteFile(path, "v4", 4);
+        DE_CHECK(Poll(watcher).empty());
+        WriteFile(path, "v3, partial then complete", 3);
+        DE_CHECK(Poll(watcher).empty());
+        DE_CHECK(Poll(watcher).empty());
+
+        // Creation and removal are changes too.
+        WriteFile(missing, "new", 5);
+        std::filesystem::remove(path);
+        DE_CHECK(Poll(watcher).empty());
+        DE_CHECK(Sorted(Poll(watcher)) == Sorted({path, missing}));
+
+        watcher.Unwatch(path);
+        WriteFile(path, "back", 6);
+        DE_CHECK(Poll(watcher).empty());
+        DE_CHECK(Poll(watcher).empty());
+        DE_CHECK(!watcher.IsWatching(path) && watcher.IsWatching(missing));
+    }
+
+    void TestHotReloader() {
+        const std::filesystem::path directory = g_Directory / "reload";
+        const std::filesystem::path scene = ShaderDependencyGraph::Normalize(directory / "scene.hlsl");
+        const std::filesystem::path upscale = ShaderDependencyGraph::Normalize(directory / "upscale.hlsl");
+        WriteFile(directory / "scene.hlsl", "#include \"common/lighting.hlsli\"\n", 0);
+        WriteFile(directory / "upscale.hlsl", "#include \"common/math.hlsli\"\n", 0);
+        WriteFile(directory / "common/lighting.hlsli", "#include \"math.hlsli\"\n", 0);
+        WriteFile(directory / "common/math.hlsli", "float Square(float x) { return x * x; }\n", 0);
+
+        ShaderHotReloader reloader({0.25});
+        reloader.AddProgram(directory / "scene.hlsl");
+        reloader.AddProgram(directory / "upscale.hlsl");
+        DE_CHECK(reloader.GetDependencies().GetFileCount() == 4);
+
+        double time = 0.0;
+        // Polls until something is reported or a second went by.
+        const auto poll = [&] {
+            for (const double end = time + 1.0; time < end; time += 0.05) {
+                if (const auto programs = reloader.Poll(time); !programs.empty()) {
+                    return Sorted({programs.begin(), programs.end()});
+                }
+            }
+
+            return std::vector<std::filesystem::path>{};
+        };
+
+        DE_CHECK(poll().empty());
+
+        // Two polls of a quarter second: seen after at most half a second.
+        const double changeTime = time;
+        WriteFile(directory / "common/math.hlsli", "float Square(float x) { return x * x * 1.0; }\n", 1);
+        DE_CHECK(poll() == Sorted({scene, upscale}));
+        DE_CHECK(time - changeTime <= 0.5 + 1e-9);
+
+        // A file gaining an include starts watching it, the same change rebuilds the program.
+        WriteFile(directory / "common/shadows.hlsli", "float Shadow() { return 1.0; }\n", 1);
+        WriteFile(directory / "scene.hlsl", "#include \"common/lighting.hlsli\"\n#include \"common/shadows.hlsli\"\n", 2);
+        DE_CHECK(poll() == std::vector{scene});
+        DE_CHECK(reloader.GetDependencies().GetFileCount() == 5);
+
+        WriteFile(directory / "common/shadows.hlsli", "float Shadow() { return 0.5; }\n", 3);
+        DE_CHECK(poll() == std::vector{scene});
+        DE_CHECK(poll().empty());
+    }
+}
+
+int main() {
+    std::filesystem::remove_all(g_Directory);
+
+    TestFindIncludes();
+    TestDependencyGraph();
+    TestDebounce();
+    TestHotReloader();
+
+    std::filesystem::remove_all(g_Directory);
+
+    return D3D12Engine::Tests::GetExitCode();
+}
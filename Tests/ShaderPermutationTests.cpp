@@ -0,0 +1,177 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/Assets/ShaderPermutation.hpp>
+
+#include <TestCheck.hpp>
+
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+    using namespace D3D12Engine;
+
+    // NORMAL_MAP needs TANGENTS, PARALLAX needs NORMAL_MAP, SKINNING and MORPHING need each other.
+    ShaderPermutationSpace MakeSpace() {
+        return ShaderPermutationSpace({{"ALPHA_TEST", 0},
+                                       {"TANGENTS", 0},
+                                       {"NORMAL_MAP", 1u << 1},
+                                       {"PARALLAX", 1u << 2},
+                                       {"SKINNING", 1u << 5},
+                                       {"MORPHING", 1u << 4}});
+    }
+
+    ShaderPermutationKey MakeKey(const ShaderPermutationSpace& space, std::initializer_list<std::string_view> defines) {
+        return space.MakeKey(std::span(defines.begin(), defines.size()));
+    }
+
+    // Smallest set holding the key and closed under the requirements, by repeated passes.
+    uint32_t GetExpectedBits(const ShaderPermutationSpace& space, uint32_t bits) {
+        for (uint32_t previous = ~bits; previous != bits;) {
+            previous = bits;
+            for (uint32_t i = 0; i < space.GetFeatureCount(); i++) {
+                if (bits & (1u << i)) {
+                    bits |= space.GetFeature(i).Requires;
+                }
+            }
+        }
+
+        return bits;
+    }
+
+    void TestKeyEncoding() {
+        const ShaderPermutationSpace space = MakeSpace();
+        DE_CHECK(space.GetFeatureCount() == 6 && space.GetPermutationCount() == 64);
+
+        // Bits follow the declaration order, whatever the order of the defines.
+        DE_CHECK(MakeKey(space, {}).Bits == 0);
+        DE_CHECK(MakeKey(space, {"ALPHA_TEST"}).Bits == 0b1);
+        DE_CHECK(MakeKey(space, {"TANGENTS", "ALPHA_TEST"}) == MakeKey(space, {"ALPHA_TEST", "TANGENTS", "ALPHA_TEST"}));
+
+        // Requirements come along, through chains and cycles.
+        DE_CHECK(MakeKey(space, {"PARALLAX"}).Bits == 0b1110);
+        DE_CHECK(MakeKey(space, {"MORPHING"}).Bits == 0b110000);
+        DE_CHECK(MakeKey(space, {"NORMAL_MAP", "SKINNING"}).Bits == 0b110110);
+
+        const std::vector<ShaderDefine> defines = space.GetDefines({0b1000});
+        DE_CHECK(defines.size() == 3);
+        DE_CHECK(defines[0].Name == "TANGENTS" && defines[1].Name == "NORMAL_MAP" && defines[2].Name == "PARALLAX");
+        DE_CHECK(std::ranges::all_of(defines, [](const ShaderDefine& define) { return define.Value == "1"; }));
+
+        DE_CHECK_THROWS(MakeKey(space, {"PARALLAX", "TESSELLATION"}), std::invalid_argument);
+        DE_CHECK_THROWS(space.Normalize({1u << 6}), std::invalid_argument);
+        DE_CHECK_THROWS(space.GetDefines({~0u}), std::invalid_argument);
+    }
+
+    void TestNormalize() {
+        // Every key against the closure computed the slow way: normalized keys hold their
+        // features' requirements and nothing else.
+        const ShaderPermutationSpace space = MakeSpace();
+        for (uint32_t bits = 0; bits < space.GetPermutationCount(); bits++) {
+            const ShaderPermutationKey normalized = space.Normalize({bits});
+            DE_CHECK(normalized.Bits == GetExpectedBits(space, bits));
+            DE_CHECK(space.Normalize(normalized) == normalized);
+        }
+
+        // Random chains over the whole key, requirements pointing both ways, some features
+        // only reached after several others.
+        std::mt19937 random(5);
+        std::vector<ShaderFeature> features;
+        for (uint32_t i = 0; i < ShaderPermutationSpace::MaxFeatureCount; i++) {
+            features.push_back({"FEATURE_" + std::to_string(i), random() % 4 != 0 ? 1u << random() % 32 : 0});
+        }
+
+        const ShaderPermutationSpace large(features);
+        DE_CHECK(large.GetPermutationCount() == uint64_t{1} << 32);
+        for (uint32_t i = 0; i < 2000; i++) {
+            const uint32_t bits = 1u << random() % 32 | 1u << random() % 32;
+            DE_CHECK(large.Normalize({bits}).Bits == GetExpectedBits(large, bits));
+        }
+
+        DE_CHECK(large.Normalize({~0u}).Bits == ~0u);
+    }
+
+    void TestInvalidSpaces() {
+        std::vector<ShaderFeature> tooMany(ShaderPermutationSpace::MaxFeatureCount + 1);
+        for (uint32_t i = 0; i < tooMany.size(); i++) {
+            tooMany[i].Define = "FEATURE_" + std::to_string(i);
+        }
+
+        DE_CHECK_THROWS(ShaderPermutationSpace(tooMany), std::invalid_argument);
+        DE_CHECK_THROWS(ShaderPermutationSpace({{"A", 0}, {"B", 0}, {"A", 0}}), std::invalid_argument);
+        DE_CHECK_THROWS(ShaderPermutationSpace({{"A", 1u << 2}, {"B", 0}}), std::invalid_argument);
+
+        // A feature can require itself, it changes nothing.
+        const ShaderPermutationSpace self({{"A", 1u << 0}});
+        DE_CHECK(self.Normalize({1}).Bits == 1);
+    }
+
+    void TestReachability() {
+        const ShaderPermutationSpace space = MakeSpace();
+
+        // Materials referring to the same variant in different ways compile it once.
+        const ShaderPermutationKey referenced[] = {MakeKey(space, {"PARALLAX"}), {0b1000}, {0b1110}, {0b10000}, {0b100000}, {0},
+                                                   MakeKey(space, {"ALPHA_TEST"}), {0}};
+        const std::vector<ShaderPermutationKey> reachable = space.GetReachableKeys(referenced);
+        const std::vector<ShaderPermutationKey> expected = {{0}, {0b1}, {0b1110}, {0b110000}};
+        DE_CHECK(reachable == expected);
+        DE_CHECK(space.GetReachableKeys({}).empty());
+
+        // Whatever is referenced, each variant needed is there once and no other is.
+        std::mt19937 random(9);
+        std::vector<ShaderPermutationKey> keys(300);
+        std::ranges::generate(keys, [&] { return ShaderPermutationKey{static_cast<uint32_t>(random() % space.GetPermutationCount())}; });
+        const std::vector<ShaderPermutationKey> pruned = space.GetReachableKeys(keys);
+        DE_CHECK(std::ranges::is_sorted(pruned) && std::ranges::adjacent_find(pruned) == pruned.end());
+        DE_CHECK(pruned.size() < space.GetPermutationCount());
+
+        for (const ShaderPermutationKey key : keys) {
+            DE_CHECK(std::ranges::binary_search(pruned, space.Normalize(key)));
+        }
+
+        for (const ShaderPermutationKey key : pruned) {
+            DE_CHECK(space.Normalize(key) == key);
+            DE_CHECK(std::ranges::any_of(keys, [&](const ShaderPermutationKey referencedKey) { return space.Normalize(referencedKey) == key; }));
+        }
+
+        const ShaderPermutationKey invalid[] = {{0}, {1u << 7}};
+        DE_CHECK_THROWS(space.GetReachableKeys(invalid), std::invalid_argument);
+    }
+
+    void TestVariantTable() {
+        ShaderVariantTable<std::string> table;
+        for (const uint32_t bits : {12u, 3u, 40u, 0u, 7u}) {
+            table.Insert({bits}, "variant " + std::to_string(bits));
+        }
+
+        DE_CHECK(table.GetSize() == 5);
+        DE_CHECK(std::ranges::is_sorted(table.GetKeys()));
+        DE_CHECK(table.Find({40}) != nullptr && *table.Find({40}) == "variant 40");
+        DE_CHECK(table.Find({5}) == nullptr && table.Find({41}) == nullptr);
+
+        // The variant of a key already there is replaced, the variants follow their keys.
+        table.Insert({3}, "recompiled");
+        DE_CHECK(table.GetSize() == 5);
+        DE_CHECK(table.GetVariants()[1] == "recompiled");
+
+        const ShaderVariantTable<std::string>& constTable = table;
+        DE_CHECK(constTable.Find({0}) != nullptr && *constTable.Find({0}) == "variant 0");
+        for (size_t i = 0; i < constTable.GetSize(); i++) {
+            DE_CHECK(constTable.Find(constTable.GetKeys()[i]) == &constTable.GetVariants()[i]);
+        }
+    }
+}
+
+int main() {
+    TestKeyEncoding();
+    TestNormalize();
+    TestInvalidSpaces();
+    TestReachability();
+    TestVariantTable();
+
+    return D3D12Engine::Tests::GetExitCode();
+}
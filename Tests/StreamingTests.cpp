@@ -0,0 +1,310 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/Assets/DdsFile.hpp>
+#include <D3D12Engine/Streaming/AsyncFileBackend.hpp>
+#include <D3D12Engine/Streaming/TextureStreamer.hpp>
+
+#include <TestCheck.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <thread>
+
+namespace {
+    using namespace D3D12Engine;
+
+    // Completes reads only when told to, so every test decides what the IO does and when.
+    class FakeFileBackend final : public StreamingFileBackend {
+    public:
+        void Submit(StreamingReadRequest request) override {
+            Pending.push_back(std::move(request));
+        }
+
+        void Cancel(const uint64_t requestId) override {
+            Cancelled.push_back(requestId);
+            std::erase_if(Pending, [&](const StreamingReadRequest& request) { return request.Id == requestId; });
+        }
+
+        void Poll(std::vector<StreamingReadResult>& results) override {
+            for (auto& result : Completed) {
+                results.push_back(std::move(result));
+            }
+
+            Completed.clear();
+        }
+
+        // Finishes every pending read, the data is filled with the low byte of the file offset.
+        void CompleteAll(const bool succeeded = true) {
+            for (const auto& request : Pending) {
+                StreamingReadResult result{request.Id, succeeded, {}};
+                if (succeeded) {
+                    result.Data.assign(request.Size, static_cast<std::byte>(request.Offset));
+                }
+
+                Completed.push_back(std::move(result));
+            }
+
+            Pending.clear();
+        }
+
+        std::vector<StreamingReadRequest> Pending;
+        std::vector<StreamingReadResult> Completed;
+        std::vector<uint64_t> Cancelled;
+    };
+
+    class FakeStreamingDevice final : public StreamingDevice {
+    public:
+        void CreateTexture(const StreamedTextureId id, const DdsLayout& layout) override {
+            Textures[id] = layout.GetMipCount();
+        }
+
+        void DestroyTexture(const StreamedTextureId id) override {
+            Textures.erase(id);
+        }
+
+        void UploadMip(const StreamedTextureId id, const uint32_t mip, const std::span<const std::byte> data) override {
+            // Mips have to arrive from the coarsest one and grow the resident range by one.
+            DE_CHECK(Textures.contains(id));
+            DE_CHECK(mip + 1 == Textures[id]);
+            DE_CHECK(!data.empty());
+            Textures[id] = mip;
+        }
+
+        void EvictMip(const StreamedTextureId id, const uint32_t mip) override {
+            DE_CHECK(mip == Textures[id]);
+            Textures[id] = mip + 1;
+        }
+
+        // Finest resident mip of each live texture, the mip count when nothing is resident.
+        std::map<StreamedTextureId, uint32_t> Textures;
+    };
+
+    DdsLayout MakeLayout(const uint32_t width, const uint32_t height) {
+        DdsLayout layout;
+        layout.Format = TextureFormat::BC1Unorm;
+        layout.Width = width;
+        layout.Height = height;
+        DdsFile::BuildMipChain(layout, std::bit_width(std::max(width, height)), DdsFile::MaxHeaderSize);
+
+        return layout;
+    }
+
+    template <typename T>
+    void PatchHeader(std::vector<std::byte>& bytes, const size_t offset, const T value) {
+        std::memcpy(bytes.data() + offset, &value, sizeof(value));
+    }
+
+    void TestDdsHeader() {
+        DdsLayout layout = MakeLayout(256, 128);
+        std::vector<std::byte> bytes = DdsFile::WriteHeader(layout);
+
+        const DdsLayout parsed = DdsFile::ParseHeader(bytes);
+        DE_CHECK(parsed.Format == TextureFormat::BC1Unorm);
+        DE_CHECK(parsed.GetMipCount() == 9);
+        DE_CHECK(parsed.Mips.back().Width == 1 && parsed.Mips.back().Height == 1);
+        DE_CHECK(parsed.GetTotalByteSize() == layout.GetTotalByteSize());
+
+        // Offsets in the file: magic, then Size, Flags, Height, Width, Pitch, Depth and MipMapCount.
+        constexpr size_t HeightOffset = 12;
+        constexpr size_t WidthOffset = 16;
+        constexpr size_t MipCountOffset = 28;
+
+        std::vector<std::byte> tooManyMips = bytes;
+        PatchHeader(tooManyMips, MipCountOffset, 10u);
+        DE_CHECK_THROWS(DdsFile::ParseHeader(tooManyMips), std::runtime_error);
+
+        std::vector<std::byte> noWidth = bytes;
+        PatchHeader(noWidth, WidthOffset, 0u);
+        DE_CHECK_THROWS(DdsFile::ParseHeader(noWidth), std::runtime_error);
+
+        std::vector<std::byte> noHeight = bytes;
+        PatchHeader(noHeight, HeightOffset, 0u);
+        DE_CHECK_THROWS(DdsFile::ParseHeader(noHeight), std::runtime_error);
+
+        DE_CHECK_THROWS(DdsFile::ParseHeader(std::span(bytes).first(64)), std::runtime_error);
+    }
+
+    void TestStreamsToRequestedMip() {
+        FakeFileBackend backend;
+        FakeStreamingDevice device;
+        TextureStreamer streamer(backend, device, {.PinnedMipDimension = 16});
+
+        const StreamedTextureId id = streamer.RegisterTexture("texture.dds", MakeLayout(256, 256));
+        DE_CHECK(backend.Pending.size() == 1);
+
+        // The 16x16 and smaller tail comes in one read.
+        backend.CompleteAll();
+        streamer.Update();
+        DE_CHECK(streamer.GetResidentMip(id) == 4);
+        DE_CHECK(device.Textures[id] == 4);
+
+        for (uint32_t frame = 0; frame < 16 && streamer.GetResidentMip(id) > 0; frame++) {
+            streamer.RequestMip(id, 0.0f);
+            backend.CompleteAll();
+            streamer.Update();
+        }
+
+        DE_CHECK(streamer.GetResidentMip(id) == 0);
+        DE_CHECK(streamer.GetStats().MipsLoaded == 9);
+        DE_CHECK(streamer.GetStats().ResidentBytes == MakeLayout(256, 256).GetTotalByteSize());
+    }
+
+    void TestEvictsOverBudget() {
+        FakeFileBackend backend;
+        FakeStreamingDevice device;
+        TextureStreamer streamer(backend, device, {.PinnedMipDimension = 16});
+
+        const StreamedTextureId id = streamer.RegisterTexture("texture.dds", MakeLayout(256, 256));
+        for (uint32_t frame = 0; frame < 16; frame++) {
+            streamer.RequestMip(id, 0.0f);
+            backend.CompleteAll();
+            streamer.Update();
+        }
+
+        DE_CHECK(streamer.GetResidentMip(id) == 0);
+
+        // Nothing but the pinned tail fits anymore, it stays even though it is over budget.
+        streamer.SetBudget(1);
+        streamer.Update();
+        DE_CHECK(streamer.GetResidentMip(id) == 4);
+        DE_CHECK(device.Textures[id] == 4);
+        DE_CHECK(streamer.GetStats().MipsEvicted == 4);
+    }
+
+    void TestRetriesFailedReads() {
+        FakeFileBackend backend;
+        FakeStreamingDevice device;
+        const TextureStreamerSettings settings{.PinnedMipDimension = 16, .MaxReadRetries = 2, .RetryDelayFrames = 4};
+        TextureStreamer streamer(backend, device, settings);
+
+        const StreamedTextureId id = streamer.RegisterTexture("texture.dds", MakeLayout(256, 256));
+
+        // The tail read fails, then is retried after 4 frames.
+        backend.CompleteAll(false);
+        streamer.Update();
+        DE_CHECK(backend.Pending.empty());
+        DE_CHECK(!streamer.HasLoadFailed(id));
+
+        for (uint32_t frame = 0; frame < 3; frame++) {
+            streamer.Update();
+        }
+
+        DE_CHECK(backend.Pending.empty());
+        streamer.Update();
+        DE_CHECK(backend.Pending.size() == 1);
+
+        // The second retry waits twice as long.
+        backend.CompleteAll(false);
+        streamer.Update();
+        for (uint32_t frame = 0; frame < 7; frame++) {
+            streamer.Update();
+        }
+
+        DE_CHECK(backend.Pending.empty());
+        streamer.Update();
+        DE_CHECK(backend.Pending.size() == 1);
+
+        // Out of retries, the texture stops streaming until it is reset.
+        backend.CompleteAll(false);
+        streamer.Update();
+        DE_CHECK(streamer.HasLoadFailed(id));
+        DE_CHECK(streamer.GetStats().FailedReads == 3);
+
+        for (uint32_t frame = 0; frame < 64; frame++) {
+            streamer.Update();
+        }
+
+        DE_CHECK(backend.Pending.empty());
+
+        streamer.ResetLoadFailure(id);
+        streamer.Update();
+        DE_CHECK(backend.Pending.size() == 1);
+
+        backend.CompleteAll();
+        streamer.Update();
+        DE_CHECK(!streamer.HasLoadFailed(id));
+        DE_CHECK(streamer.GetResidentMip(id) == 4);
+    }
+
+    void TestUnregisterCancelsReads() {
+        FakeFileBackend backend;
+        FakeStreamingDevice device;
+        TextureStreamer streamer(backend, device);
+
+        const StreamedTextureId id = streamer.RegisterTexture("texture.dds", MakeLayout(256, 256));
+        DE_CHECK(backend.Pending.size() == 1);
+        const uint64_t requestId = backend.Pending.front().Id;
+
+        streamer.UnregisterTexture(id);
+        DE_CHECK(backend.Cancelled == std::vector<uint64_t>{requestId});
+        DE_CHECK(backend.Pending.empty());
+        DE_CHECK(device.Textures.empty());
+        DE_CHECK(streamer.GetStats().RequestsInFlight == 0);
+        DE_CHECK(streamer.GetStats().PendingBytes == 0);
+    }
+
+    void TestAsyncFileBackend() {
+        const std::filesystem::path path = std::filesystem::temp_directory_path() / "D3D12EngineStreamingTests.bin";
+        {
+            std::ofstream file(path, std::ios::binary);
+            for (uint32_t i = 0; i < 4096; i++) {
+                file.put(static_cast<char>(i));
+            }
+        }
+
+        {
+            AsyncFileBackend backend;
+
+            // Cancelled requests never come back, whether they were queued, being read or done.
+            constexpr uint64_t RequestCount = 64;
+            for (uint64_t id = 1; id <= RequestCount; id++) {
+                backend.Submit({id, path, id, 16});
+            }
+
+            for (uint64_t id = 1; id <= RequestCount; id += 2) {
+                backend.Cancel(id);
+            }
+
+            backend.Cancel(1000);
+
+            // A missing file fails, and being last it completes after everything else.
+            backend.Submit({RequestCount + 1, path.string() + ".missing", 0, 16});
+
+            std::vector<StreamingReadResult> results;
+            while (results.empty() || results.back().Id != RequestCount + 1) {
+                backend.Poll(results);
+                std::this_thread::yield();
+            }
+
+            DE_CHECK(!results.back().Succeeded);
+            results.pop_back();
+
+            for (const auto& result : results) {
+                DE_CHECK(result.Id % 2 == 0);
+                DE_CHECK(result.Succeeded);
+                DE_CHECK(result.Data.size() == 16);
+                DE_CHECK(result.Data.front() == static_cast<std::byte>(result.Id));
+            }
+
+            DE_CHECK(results.size() == RequestCount / 2);
+        }
+
+        std::filesystem::remove(path);
+    }
+}
+
+int main() {
+    TestDdsHeader();
+    TestStreamsToRequestedMip();
+    TestEvictsOverBudget();
+    TestRetriesFailedReads();
+    TestUnregisterCancelsReads();
+    TestAsyncFileBackend();
+
+    return D3D12Engine::Tests::GetExitCode();
+}
@@ -0,0 +1,52 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef DE_TESTS_TESTCHECK_HPP
+#define DE_TESTS_TESTCHECK_HPP
+
+#include <cstdio>
+#include <cstdlib>
+
+namespace D3D12Engine::Tests {
+    inline int g_FailureCount = 0;
+
+    inline void ReportFailure(const char* expression, const char* file, const int line) {
+        std::fprintf(stderr, "%s:%d: check failed: %s\n", file, line, expression);
+        g_FailureCount++;
+    }
+
+    // Exit code of a test binary, checks keep going after a failure so one run reports them all.
+    inline int GetExitCode() {
+        if (g_FailureCount > 0) {
+            std::fprintf(stderr, "%d check(s) failed.\n", g_FailureCount);
+            return EXIT_FAILURE;
+        }
+
+        return EXIT_SUCCESS;
+    }
+}
+
+#define DE_CHECK(expression)                                                          \
+    do {                                                                              \
+        if (!(expression)) {                                                          \
+            ::D3D12Engine::Tests::ReportFailure(#expression, __FILE__, __LINE__);     \
+        }                                                                             \
+    } while (false)
+
+#define DE_CHECK_THROWS(expression, exception)                                                      \
+    do {                                                                                            \
+        bool thrown = false;                                                                        \
+        try {                                                                                       \
+            static_cast<void>(expression);                                                          \
+        } catch (const exception&) {                                                                \
+            thrown = true;                                                                          \
+        }                                                                                           \
+        if (!thrown) {                                                                              \
+            ::D3D12Engine::Tests::ReportFailure(#expression " throws " #exception, __FILE__, __LINE__); \
+        }                                                                                           \
+    } while (false)
+
+#endif // DE_TESTS_TESTCHECK_HPP
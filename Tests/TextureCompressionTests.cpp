@@ -0,0 +1,200 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/Assets/BlockCompressor.hpp>
+#include <D3D12Engine/Assets/MipChainGenerator.hpp>
+#include <D3D12Engine/Assets/TextureCooker.hpp>
+#include <D3D12Engine/Core/JobSystem.hpp>
+
+#include <TestCheck.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+    using namespace D3D12Engine;
+
+    TextureImage MakeImage(const uint32_t width, const uint32_t height, const uint32_t seed) {
+        // Smooth gradients with a little noise, like most albedo and normal maps.
+        std::mt19937 random(seed);
+        std::uniform_int_distribution<int> noise(-3, 3);
+        TextureImage image{width, height, {}};
+        for (uint32_t y = 0; y < height; y++) {
+            for (uint32_t x = 0; x < width; x++) {
+                const int values[4] = {static_cast<int>(x * 2), static_cast<int>(y * 3), static_cast<int>(64 + x + y), static_cast<int>(255 - x)};
+                for (const int value : values) {
+                    image.Pixels.push_back(static_cast<uint8_t>(std::clamp(value + noise(random), 0, 255)));
+                }
+            }
+        }
+
+        return image;
+    }
+
+    TextureImage MakeSolidImage(const uint32_t width, const uint32_t height, const uint8_t (&color)[4]) {
+        TextureImage image{width, height, {}};
+        for (uint32_t i = 0; i < width * height; i++) {
+            image.Pixels.insert(image.Pixels.end(), std::begin(color), std::end(color));
+        }
+
+        return image;
+    }
+
+    TextureImage RoundTrip(const TextureImage& image, const TextureFormat format, JobSystem* pJobSystem = nullptr) {
+        std::vector<std::byte> blocks(GetSurfaceByteSize(format, image.Width, image.Height));
+        BlockCompressor::Compress(image, format, blocks, pJobSystem);
+        return BlockCompressor::Decompress(blocks, format, image.Width, image.Height);
+    }
+
+    int GetMaxError(const TextureImage& reference, const TextureImage& image, const uint32_t channelCount) {
+        int maxError = 0;
+        for (size_t i = 0; i < reference.Pixels.size(); i++) {
+            if (i % 4 < channelCount) {
+                maxError = std::max(maxError, std::abs(reference.Pixels[i] - image.Pixels[i]));
+            }
+        }
+
+        return maxError;
+    }
+
+    void TestSolidBlocks() {
+        std::mt19937 random(3);
+        for (uint32_t i = 0; i < 200; i++) {
+            const uint8_t color[4] = {static_cast<uint8_t>(random()), static_cast<uint8_t>(random()), static_cast<uint8_t>(random()),
+                                      static_cast<uint8_t>(random())};
+            const TextureImage block = MakeSolidImage(4, 4, color);
+
+            // BC1 is limited by its 565 endpoints, BC4 and BC7 mode 6 endpoints hold 8 bits.
+            DE_CHECK(GetMaxError(block, RoundTrip(block, TextureFormat::BC1Unorm), 3) <= 4);
+            DE_CHECK(GetMaxError(block, RoundTrip(block, TextureFormat::BC5Unorm), 2) == 0);
+            DE_CHECK(GetMaxError(block, RoundTrip(block, TextureFormat::BC7Unorm), 4) <= 1);
+        }
+    }
+
+    void TestImageQuality() {
+        // 13x7 has partial edge blocks.
+        for (const auto& [width, height] : {std::pair{64u, 64u}, std::pair{13u, 7u}}) {
+            const TextureImage image = MakeImage(width, height, width);
+
+            const TextureImage bc1 = RoundTrip(image, TextureFormat::BC1Unorm);
+            const TextureImage bc5 = RoundTrip(image, TextureFormat::BC5Unorm);
+            const TextureImage bc7 = RoundTrip(image, TextureFormat::BC7Unorm);
+            DE_CHECK(bc1.Width == width && bc1.Height == height && bc1.Pixels.size() == image.Pixels.size());
+
+            const double bc1Psnr = TextureCooker::ComputePsnr(image, bc1, 3);
+            const double bc7Psnr = TextureCooker::ComputePsnr(image, bc7, 3);
+            DE_CHECK(bc1Psnr > 37.0);
+            DE_CHECK(TextureCooker::ComputePsnr(image, bc5, 2) > 50.0);
+            DE_CHECK(bc7Psnr > 40.0 && bc7Psnr >= bc1Psnr);
+            DE_CHECK(TextureCooker::ComputePsnr(image, bc7, 4) > 40.0);
+
+            // BC1 and BC5 don't store the channels they don't encode.
+            for (size_t i = 0; i < image.Pixels.size(); i += 4) {
+                DE_CHECK(bc1.Pixels[i + 3] == 255);
+                DE_CHECK(bc5.Pixels[i + 2] == 0 && bc5.Pixels[i + 3] == 255);
+            }
+        }
+
+        // The job system only changes who encodes each block row.
+        const TextureImage image = MakeImage(40, 36, 1);
+        JobSystem jobs(3);
+        for (const TextureFormat format : {TextureFormat::BC1Unorm, TextureFormat::BC5Unorm, TextureFormat::BC7Unorm}) {
+            DE_CHECK(RoundTrip(image, format).Pixels == RoundTrip(image, format, &jobs).Pixels);
+        }
+    }
+
+    void TestCompressionErrors() {
+        const TextureImage image = MakeImage(8, 8, 2);
+        std::vector<std::byte> blocks(GetSurfaceByteSize(TextureFormat::BC7Unorm, 8, 8));
+
+        DE_CHECK_THROWS(BlockCompressor::Compress(image, TextureFormat::BC3Unorm, blocks), std::invalid_argument);
+        DE_CHECK_THROWS(BlockCompressor::Compress(image, TextureFormat::BC7Unorm, std::span(blocks).first(48)), std::invalid_argument);
+        DE_CHECK_THROWS(BlockCompressor::Decompress(std::span(blocks).first(48), TextureFormat::BC7Unorm, 8, 8), std::invalid_argument);
+
+        // Zeroed bytes aren't a mode 6 block.
+        const std::byte zeros[16] = {};
+        uint8_t pixels[BlockCompressor::BlockPixelCount * 4];
+        DE_CHECK_THROWS(BlockCompressor::DecodeBlock(TextureFormat::BC7Unorm, zeros, pixels), std::runtime_error);
+        DE_CHECK(!BlockCompressor::IsSupported(TextureFormat::BC3Unorm) && BlockCompressor::IsSupported(TextureFormat::BC5Unorm));
+    }
+
+    const uint8_t* GetPixel(const TextureImage& image, const uint32_t x, const uint32_t y) {
+        return &image.Pixels[(static_cast<size_t>(y) * image.Width + x) * 4];
+    }
+
+    void TestMipSizes() {
+        DE_CHECK(MipChainGenerator::GetFullMipCount(1, 1) == 1);
+        DE_CHECK(MipChainGenerator::GetFullMipCount(256, 1) == 9);
+        DE_CHECK(MipChainGenerator::GetFullMipCount(5, 3) == 3);
+
+        const std::vector<TextureImage> mips = MipChainGenerator::Generate(MakeImage(5, 3, 4));
+        DE_CHECK(mips.size() == 3);
+        DE_CHECK(mips[1].Width == 2 && mips[1].Height == 1 && mips[2].Width == 1 && mips[2].Height == 1);
+        DE_CHECK(mips[0].Pixels == MakeImage(5, 3, 4).Pixels);
+
+        DE_CHECK(MipChainGenerator::Generate(MakeImage(64, 32, 4), {.MaxMipCount = 2}).size() == 2);
+        DE_CHECK_THROWS(MipChainGenerator::Generate(TextureImage{4, 4, std::vector<uint8_t>(60)}), std::invalid_argument);
+        DE_CHECK_THROWS(MipChainGenerator::Generate(TextureImage{}), std::invalid_argument);
+    }
+
+    void TestMipFiltering() {
+        // A constant image stays constant, odd sizes included.
+        const uint8_t color[4] = {90, 140, 200, 255};
+        for (const TextureImage& mip : MipChainGenerator::Generate(MakeSolidImage(7, 5, color), {.Srgb = true})) {
+            DE_CHECK(GetMaxError(MakeSolidImage(mip.Width, mip.Height, color), mip, 4) <= 1);
+        }
+
+        // Every texel of an odd axis contributes: the last column of 3 weighs a quarter.
+        const TextureImage row{3, 1, {0, 0, 0, 255, 0, 0, 0, 255, 255, 255, 255, 255}};
+        const std::vector<TextureImage> rowMips = MipChainGenerator::Generate(row);
+        DE_CHECK(rowMips.size() == 2 && rowMips[1].Pixels[0] == 64);
+
+        // Even axes average pairs, in linear space for sRGB images.
+        const TextureImage checker{2, 2, {0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 0, 0, 255}};
+        DE_CHECK(MipChainGenerator::Generate(checker)[1].Pixels[0] == 128);
+        const uint8_t srgbGray = MipChainGenerator::Generate(checker, {.Srgb = true})[1].Pixels[0];
+        DE_CHECK(srgbGray >= 187 && srgbGray <= 189);
+
+        // Transparent texels don't bleed their color.
+        const TextureImage cutout{2, 1, {255, 255, 255, 255, 255, 0, 0, 0}};
+        const TextureImage cutoutMip = MipChainGenerator::Generate(cutout)[1];
+        DE_CHECK(cutoutMip.Pixels[0] == 255 && cutoutMip.Pixels[1] == 255 && cutoutMip.Pixels[3] == 128);
+
+        // Normal maps stay unit length.
+        const std::vector<TextureImage> normalMips = MipChainGenerator::Generate(MakeImage(9, 6, 5), {.NormalMap = true});
+        for (const TextureImage& mip : std::span(normalMips).subspan(1)) {
+            for (uint32_t y = 0; y < mip.Height; y++) {
+                for (uint32_t x = 0; x < mip.Width; x++) {
+                    float length = 0.0f;
+                    for (uint32_t channel = 0; channel < 3; channel++) {
+                        const float value = GetPixel(mip, x, y)[channel] / 255.0f * 2.0f - 1.0f;
+                        length += value * value;
+                    }
+
+                    DE_CHECK(std::abs(std::sqrt(length) - 1.0f) < 0.02f);
+                }
+            }
+        }
+
+        JobSystem jobs(3);
+        const TextureImage image = MakeImage(67, 45, 6);
+        const std::vector<TextureImage> single = MipChainGenerator::Generate(image, {.Srgb = true});
+        const std::vector<TextureImage> parallel = MipChainGenerator::Generate(image, {.Srgb = true}, &jobs);
+        DE_CHECK(std::ranges::equal(single, parallel, [](const TextureImage& a, const TextureImage& b) { return a.Pixels == b.Pixels; }));
+    }
+}
+
+int main() {
+    TestSolidBlocks();
+    TestImageQuality();
+    TestCompressionErrors();
+    TestMipSizes();
+    TestMipFiltering();
+
+    return D3D12Engine::Tests::GetExitCode();
+}
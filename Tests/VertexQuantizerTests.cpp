@@ -0,0 +1,204 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/RHI/VertexLayout.hpp>
+#include <D3D12Engine/RHI/VertexQuantizer.hpp>
+
+#include <TestCheck.hpp>
+
+#include <cmath>
+#include <cstring>
+#include <numbers>
+#include <random>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+namespace {
+    using namespace D3D12Engine;
+    using namespace D3D12Engine::VertexEncoding;
+
+    using FullLayout = VertexLayout<VertexAttribute<"POSITION", VertexFormat::R32G32B32Float>,
+                                    VertexAttribute<"NORMAL", VertexFormat::R32G32B32Float>,
+                                    VertexAttribute<"TEXCOORD", VertexFormat::R32G32Float>,
+                                    VertexAttribute<"COLOR", VertexFormat::R32G32B32A32Float>>;
+
+    using CompactLayout = VertexLayout<VertexAttribute<"POSITION", VertexFormat::R16G16B16A16Snorm>,
+                                       VertexAttribute<"NORMAL", VertexFormat::R8G8B8A8Snorm>,
+                                       VertexAttribute<"TEXCOORD", VertexFormat::R16G16Float>,
+                                       VertexAttribute<"COLOR", VertexFormat::R8G8B8A8Unorm>>;
+
+    static_assert(FullLayout::Stride == 48);
+    static_assert(CompactLayout::Stride == 20);
+    static_assert(CompactLayout::Offsets == std::array<uint32_t, 4>{0, 8, 12, 16});
+
+    void TestHalfRoundTrip() {
+        // Every half decodes to a float that encodes back to the same bits, NaNs stay NaNs.
+        for (uint32_t bits = 0; bits <= 0xffff; bits++) {
+            const auto half = static_cast<uint16_t>(bits);
+            const float value = HalfToFloat(half);
+            if (std::isnan(value)) {
+                DE_CHECK(std::isnan(HalfToFloat(FloatToHalf(value))));
+                continue;
+            }
+
+            DE_CHECK(FloatToHalf(value) == half);
+        }
+
+        // Normal range: relative error at most half an ulp, 2^-11.
+        std::mt19937 random(7);
+        std::uniform_real_distribution<float> exponent(-14.0f, 15.9f);
+        for (uint32_t i = 0; i < 100'000; i++) {
+            const float value = std::exp2(exponent(random)) * (i % 2 ? -1.0f : 1.0f);
+            const float decoded = HalfToFloat(FloatToHalf(value));
+            DE_CHECK(std::abs(decoded - value) <= std::abs(value) * std::exp2(-11.0f));
+        }
+
+        // Denormal range: absolute error at most half the smallest denormal, 2^-25.
+        std::uniform_real_distribution<float> tiny(-std::exp2(-14.0f), std::exp2(-14.0f));
+        for (uint32_t i = 0; i < 100'000; i++) {
+            const float value = tiny(random);
+            DE_CHECK(std::abs(HalfToFloat(FloatToHalf(value)) - value) <= std::exp2(-25.0f));
+        }
+
+        // Ties round to even, overflow goes to infinity.
+        DE_CHECK(FloatToHalf(1.0f + std::exp2(-11.0f)) == FloatToHalf(1.0f));
+        DE_CHECK(FloatToHalf(1.0f + 3.0f * std::exp2(-11.0f)) == FloatToHalf(1.0f + std::exp2(-9.0f)));
+        DE_CHECK(HalfToFloat(FloatToHalf(65504.0f)) == 65504.0f);
+        DE_CHECK(std::isinf(HalfToFloat(FloatToHalf(65520.0f))));
+        DE_CHECK(std::isinf(HalfToFloat(FloatToHalf(-1e9f))));
+        DE_CHECK(std::signbit(HalfToFloat(FloatToHalf(-0.0f))));
+    }
+
+    // Quantizes a sweep of the range and checks the error never exceeds half a step.
+    void CheckNormalizedBound(const VertexComponentType type, const float minimum, const float steps) {
+        const float bound = 0.5f / steps + 1e-7f;
+        float maxError = 0.0f;
+        for (uint32_t i = 0; i <= 200'000; i++) {
+            const float value = minimum + (1.0f - minimum) * static_cast<float>(i) / 200'000.0f;
+            maxError = std::max(maxError, std::abs(QuantizeComponent(type, value) - value));
+        }
+
+        DE_CHECK(maxError <= bound);
+        // The bound is tight, a coarser encoding would show up here.
+        DE_CHECK(maxError >= 0.4f / steps);
+
+        // Out of range values clamp, the ends are exact.
+        DE_CHECK(QuantizeComponent(type, 1.0f) == 1.0f);
+        DE_CHECK(QuantizeComponent(type, 2.0f) == 1.0f);
+        DE_CHECK(QuantizeComponent(type, minimum) == minimum);
+        DE_CHECK(QuantizeComponent(type, minimum - 1.0f) == minimum);
+        DE_CHECK(QuantizeComponent(type, 0.0f) == 0.0f);
+    }
+
+    void TestNormalizedRoundTrip() {
+        CheckNormalizedBound(VertexComponentType::Unorm16, 0.0f, 65535.0f);
+        CheckNormalizedBound(VertexComponentType::Unorm8, 0.0f, 255.0f);
+        CheckNormalizedBound(VertexComponentType::Snorm16, -1.0f, 32767.0f);
+        CheckNormalizedBound(VertexComponentType::Snorm8, -1.0f, 127.0f);
+
+        // The most negative stored value decodes to -1 like on the GPU.
+        constexpr int16_t MostNegative = -32768;
+        std::byte stored[2];
+        std::memcpy(stored, &MostNegative, sizeof(stored));
+        DE_CHECK(DecodeComponent(VertexComponentType::Snorm16, stored) == -1.0f);
+    }
+
+    void TestVertexPadding() {
+        CompactLayout::Vertex vertex{};
+        const float position[3] = {0.5f, -0.25f, 1.0f};
+        vertex.Set<0>(position);
+        vertex.Set<3>(std::span<const float>(position, 2));
+
+        // Missing components come from (0, 0, 0, 1).
+        DE_CHECK(vertex.Get<0>()[3] == 1.0f);
+        DE_CHECK(vertex.Get<3>()[2] == 0.0f && vertex.Get<3>()[3] == 1.0f);
+        DE_CHECK(vertex.Get<3>()[1] == 0.0f);
+        DE_CHECK(std::abs(vertex.Get<0>()[1] + 0.25f) <= 0.5f / 32767.0f);
+
+        // Components the format lacks read back as padding.
+        DE_CHECK(vertex.Get<2>()[2] == 0.0f && vertex.Get<2>()[3] == 1.0f);
+
+        DE_CHECK(std::string_view(CompactLayout::Elements[2].SemanticName) == "TEXCOORD");
+        DE_CHECK(CompactLayout::Elements[3].Offset == 16);
+        DE_CHECK(CompactLayout::Elements[1].Format == VertexFormat::R8G8B8A8Snorm);
+    }
+
+    void TestMeshQuantization() {
+        // A displaced sphere far from the origin, the remap has to center and scale it.
+        constexpr uint32_t Rings = 64;
+        constexpr uint32_t Segments = 128;
+        constexpr size_t FloatsPerVertex = 12;
+        std::vector<float> source;
+        for (uint32_t ring = 0; ring <= Rings; ring++) {
+            for (uint32_t segment = 0; segment <= Segments; segment++) {
+                const float theta = std::numbers::pi_v<float> * static_cast<float>(ring) / Rings;
+                const float phi = 2.0f * std::numbers::pi_v<float> * static_cast<float>(segment) / Segments;
+                const float normal[3] = {std::sin(theta) * std::cos(phi), std::cos(theta), std::sin(theta) * std::sin(phi)};
+                const float radius = 25.0f + std::sin(phi * 5.0f);
+
+                source.insert(source.end(), {1000.0f + normal[0] * radius, 50.0f + normal[1] * radius, -300.0f + normal[2] * radius});
+                source.insert(source.end(), std::begin(normal), std::end(normal));
+                source.insert(source.end(), {static_cast<float>(segment) / Segments * 4.0f, static_cast<float>(ring) / Rings});
+                source.insert(source.end(), {normal[0] * 0.5f + 0.5f, normal[1] * 0.5f + 0.5f, 0.25f, 1.0f});
+            }
+        }
+
+        const size_t vertexCount = source.size() / FloatsPerVertex;
+        const VertexAttributeStream streams[] = {
+            {source.data(), FloatsPerVertex, 3, true},
+            {source.data() + 3, FloatsPerVertex, 3},
+            {source.data() + 6, FloatsPerVertex, 2},
+            {source.data() + 8, FloatsPerVertex, 4},
+        };
+
+        const auto compact = VertexQuantizer<CompactLayout>::Quantize(streams, vertexCount);
+        const auto full = VertexQuantizer<FullLayout>::Quantize(streams, vertexCount);
+
+        // 48 bytes per vertex down to 20, the vertex fetch bandwidth saved.
+        DE_CHECK(full.ByteSize == vertexCount * 48);
+        DE_CHECK(full.SourceByteSize == full.ByteSize);
+        DE_CHECK(compact.ByteSize == vertexCount * 20);
+        DE_CHECK(compact.SourceByteSize * 5 == compact.ByteSize * 12);
+
+        // Float32 is lossless.
+        for (const auto& error : full.Errors) {
+            DE_CHECK(error.MaxError == 0.0f);
+        }
+
+        // Positions: half a step of the remapped range, 52 units over 2 * 32767 steps, plus float rounding.
+        const float extent = 52.0f;
+        DE_CHECK(compact.Errors[0].MaxError <= extent * 0.5f / 32767.0f * 0.5f + 1000.0f * 1e-7f);
+        DE_CHECK(compact.Errors[0].RmsError <= compact.Errors[0].MaxError);
+        DE_CHECK(compact.Transforms[0].Offset[0] > 990.0f && compact.Transforms[0].Offset[0] < 1010.0f);
+
+        // Normals and colors: half a step of their format, texture coordinates: half ulp at 4.
+        DE_CHECK(compact.Errors[1].MaxError <= 0.5f / 127.0f + 1e-6f);
+        DE_CHECK(compact.Errors[3].MaxError <= 0.5f / 255.0f + 1e-6f);
+        DE_CHECK(compact.Errors[2].MaxError <= 4.0f * std::exp2(-11.0f));
+
+        // The reported error matches what decoding with the transform gives back.
+        float maxPositionError = 0.0f;
+        for (size_t vertex = 0; vertex < vertexCount; vertex++) {
+            const auto decoded = compact.Vertices[vertex].Get<0>();
+            for (uint32_t component = 0; component < 3; component++) {
+                const float value = decoded[component] * compact.Transforms[0].Scale[component] + compact.Transforms[0].Offset[component];
+                maxPositionError = std::max(maxPositionError, std::abs(value - source[vertex * FloatsPerVertex + component]));
+            }
+        }
+
+        DE_CHECK(maxPositionError == compact.Errors[0].MaxError);
+
+        DE_CHECK_THROWS(VertexQuantizer<CompactLayout>::Quantize(std::span(streams).first(3), vertexCount), std::invalid_argument);
+    }
+}
+
+int main() {
+    TestHalfRoundTrip();
+    TestNormalizedRoundTrip();
+    TestVertexPadding();
+    TestMeshQuantization();
+
+    return D3D12Engine::Tests::GetExitCode();
+}
@@ -0,0 +1,87 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier 
+// This file is part of D3D12Engine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <D3D12Engine/Assets/ImageFile.hpp>
+#include <D3D12Engine/Assets/TextureCooker.hpp>
+#include <D3D12Engine/Core/JobSystem.hpp>
+
+#include <algorithm>
+#include <iostream>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+namespace {
+    using namespace D3D12Engine;
+
+    struct FormatOption {
+        std::string_view Name;
+        TextureFormat Format;
+    };
+
+    constexpr FormatOption Formats[] = {
+        {"bc1", TextureFormat::BC1Unorm},
+        {"bc1-srgb", TextureFormat::BC1UnormSrgb},
+        {"bc5", TextureFormat::BC5Unorm},
+        {"bc7", TextureFormat::BC7Unorm},
+        {"bc7-srgb", TextureFormat::BC7UnormSrgb},
+    };
+
+    const FormatOption& FindFormat(const std::string_view name) {
+        for (const FormatOption& option : Formats) {
+            if (option.Name == name) {
+                return option;
+            }
+        }
+
+        throw std::invalid_argument("Unknown format " + std::string(name) + ", expected bc1, bc1-srgb, bc5, bc7 or bc7-srgb.");
+    }
+
+    void PrintUsage() {
+        std::cout << "Usage: TextureCooker <input.tga|dds> <output.dds> [--format=bc7-srgb] [--normal-map] [--no-mips] [--threads=N]\n";
+    }
+}
+
+int main(const int argc, char** argv) {
+    try {
+        std::vector<std::string_view> inputs;
+        TextureCookSettings settings;
+        std::optional<uint32_t> threadCount;
+
+        for (int i = 1; i < argc; ++i) {
+            const std::string_view argument = argv[i];
+            if (argument == "--normal-map") {
+                settings.NormalMap = true;
+            } else if (argument == "--no-mips") {
+                settings.GenerateMips = false;
+            } else if (argument.starts_with("--format=")) {
+                settings.Format = FindFormat(argument.substr(9)).Format;
+            } else if (argument.starts_with("--threads=")) {
+                threadCount = static_cast<uint32_t>(std::stoul(std::string(argument.substr(10))));
+            } else if (argument.starts_with("--")) {
+                throw std::invalid_argument("Unknown option " + std::string(argument) + ".");
+            } else {
+                inputs.push_back(argument);
+            }
+        }
+
+        if (inputs.size() != 2) {
+            PrintUsage();
+            return 1;
+        }
+
+        // The calling thread works too, one thread means no worker.
+        JobSystem jobSystem(threadCount ? std::max(*threadCount, 1u) - 1 : JobSystem::GetDefaultWorkerCount());
+        const TextureImage image = ImageFile::Load(inputs[0]);
+
+        const CookedTexture texture = TextureCooker::Cook(image, settings, &jobSystem);
+        TextureCooker::WriteDds(texture, inputs[1]);
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -23,7 +23,7 @@ set_languages("cxx23")
 set_rundir("./bin/$(plat)_$(arch)_$(mode)")
 set_targetdir("./bin/$(plat)_$(arch)_$(mode)")
 set_warnings("allextra")
-set_allowedplats("windows", "mingw")
+set_allowedplats("windows", "mingw", "linux")
 add_cxflags("-Wno-missing-field-initializers -Werror=vla", {tools = {"clang", "gcc"}})
 
 option("override_runtime", {description = "Override VS runtime to MD in release and MDd in debug.", default = true})
@@ -34,27 +34,87 @@ if is_plat("windows") then
   end
 end
 
-add_requires("directx-headers", "directxtk12", "directxtex")
+if is_plat("windows", "mingw") then
+  add_requires("directx-headers", "directxtk12", "directxtex")
+end
 
 rule("cp-resources")
   after_build(function (target) 
     os.cp("Resources", "./bin/$(plat)_$(arch)_$(mode)")
   end)
 
-target(ProjectName) 
-  set_kind("binary")
-  add_rules("cp-resources")
-  
+-- Sources that need Direct3D or Win32, everything else builds everywhere.
+local WindowsSources = {
+  "Source/D3D12Engine/Main.cpp",
+  "Source/D3D12Engine/Application.cpp",
+  "Source/D3D12Engine/Core/Window.cpp",
+  "Source/D3D12Engine/RHI/GpuTimer.cpp",
+  "Source/D3D12Engine/RHI/D3D12/*.cpp"
+}
+
+-- Portable engine code, shared by the engine, the tools, the tests and the benchmarks.
+target(ProjectName .. "Core")
+  set_kind("static")
+
   add_files("Source/**.cpp")
-  
-  for _, ext in ipairs({".hpp", ".inl"}) do
-    add_headerfiles("Include/**" .. ext)
+  remove_files(table.unpack(WindowsSources))
+
+  if is_plat("linux") then
+    add_syslinks("pthread", {public = true})
   end
-  
-  add_rpathdirs("$ORIGIN")
 
-  add_packages("directx-headers", "directxtk12", "directxtex")
-  add_syslinks("d3d12", "dxgi", "D3DCompiler", "user32", "kernel32", "shell32")
-  add_defines("UNICODE", "_UNICODE")
+-- The engine only builds on Windows, the tools also build on Linux machines.
+if is_plat("windows", "mingw") then
+  target(ProjectName) 
+    set_kind("binary")
+    add_rules("cp-resources")
+    add_deps(ProjectName .. "Core")
+    
+    add_files(table.unpack(WindowsSources))
+    
+    for _, ext in ipairs({".hpp", ".inl"}) do
+      add_headerfiles("Include/**" .. ext)
+    end
+    
+    add_rpathdirs("$ORIGIN")
+
+    add_packages("directx-headers", "directxtk12", "directxtex")
+    add_syslinks("d3d12", "dxgi", "D3DCompiler", "user32", "kernel32", "shell32", "psapi")
+    add_defines("UNICODE", "_UNICODE")
+end
+
+-- Offline texture cooker, built from the portable asset code only.
+target("TextureCooker")
+  set_kind("binary")
+  add_deps(ProjectName .. "Core")
+
+  add_files("Tools/TextureCooker/*.cpp")
+
+-- One binary per file, run the tests with `xmake test` and the benchmarks with
+-- `xmake run -g benchmarks`. Benchmarks also run as tests with --quick, which shrinks
+-- their workloads so CI only checks that they still work.
+for _, file in ipairs(os.files("Tests/*.cpp")) do
+  target(path.basename(file))
+    set_kind("binary")
+    set_group("tests")
+    set_default(false)
+    add_deps(ProjectName .. "Core")
+
+    add_files(file)
+    add_includedirs("Tests")
+    add_tests("default")
+end
+
+for _, file in ipairs(os.files("Benchmarks/*.cpp")) do
+  target(path.basename(file))
+    set_kind("binary")
+    set_group("benchmarks")
+    set_default(false)
+    add_deps(ProjectName .. "Core")
+
+    add_files(file)
+    add_includedirs("Benchmarks", "Tests")
+    add_tests("quick", {runargs = "--quick"})
+end
 
-includes("xmake/**.lua")
\ No newline at end of file
+includes("xmake/**.lua")